@@ -1,14 +1,14 @@
 #include "RPGCharacterSubsystem.h"
 #include "Engine/Engine.h"
-#include "HAL/PlatformProcess.h"
-#include "Misc/Paths.h"
+#include "RPGCore/Toolkit/RPGToolkitModule.h"
+#include "RPGCore/Toolkit/RPGToolkitExecutor.h"
 
 void URPGCharacterSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
     Super::Initialize(Collection);
     
     UE_LOG(LogTemp, Warning, TEXT("RPGCharacterSubsystem initializing..."));
-    LoadDLLFunctions();
+    BindToolkitFunctions();
     
     if (bFunctionsLoaded)
     {
@@ -24,45 +24,42 @@ void URPGCharacterSubsystem::Deinitialize()
 {
     UE_LOG(LogTemp, Warning, TEXT("RPGCharacterSubsystem deinitializing..."));
     
-    if (ToolkitDLLHandle)
+    // Return the shared function table - the DLL itself stays mapped
+    // because the Go runtime inside it cannot be safely unloaded.
+    // The executor goes first: its release runs any in-flight character creation.
+    if (Executor)
     {
-        FPlatformProcess::FreeDllHandle(ToolkitDLLHandle);
-        ToolkitDLLHandle = nullptr;
+        FRPGToolkitExecutor::Release(TEXT("RPGCharacterSubsystem"));
+        Executor = nullptr;
+    }
+    
+    if (Toolkit)
+    {
+        FRPGToolkitModule::Release(TEXT("RPGCharacterSubsystem"));
     }
     
     bFunctionsLoaded = false;
-    CreateCharacterCompleteFuncPtr = nullptr;
+    Toolkit = nullptr;
     
     Super::Deinitialize();
 }
 
-void URPGCharacterSubsystem::LoadDLLFunctions()
+void URPGCharacterSubsystem::BindToolkitFunctions()
 {
-    // Use proper UE binary directory (following established pattern)
-    FString BinariesDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("Binaries"), FPlatformProcess::GetBinariesSubdirectory());
-    FString LibraryPath = FPaths::Combine(BinariesDir, TEXT("rpg_toolkit.dll"));
-    LibraryPath = FPaths::ConvertRelativePathToFull(LibraryPath);
-
-    if (!FPaths::FileExists(LibraryPath))
+    Toolkit = FRPGToolkitModule::Acquire(TEXT("RPGCharacterSubsystem"));
+    if (!Toolkit)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Toolkit DLL not found at: %s"), *LibraryPath);
+        UE_LOG(LogTemp, Warning, TEXT("Toolkit DLL not available for character subsystem"));
         return;
     }
 
-    ToolkitDLLHandle = FPlatformProcess::GetDllHandle(*LibraryPath);
-    if (!ToolkitDLLHandle)
-    {
-        UE_LOG(LogTemp, Error, TEXT("Failed to load toolkit DLL from: %s"), *LibraryPath);
-        return;
-    }
-
-    // Load the character creation function
-    CreateCharacterCompleteFuncPtr = (CreateCharacterCompleteFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("CreateCharacterComplete"));
-    
-    if (CreateCharacterCompleteFuncPtr)
+    if (Toolkit->CreateCharacterComplete)
     {
         bFunctionsLoaded = true;
         UE_LOG(LogTemp, Warning, TEXT("Character DLL functions loaded successfully"));
+        
+        // Worker pool for CreateCharacterAsync
+        Executor = FRPGToolkitExecutor::Acquire(TEXT("RPGCharacterSubsystem"));
     }
     else
     {
@@ -84,11 +81,75 @@ FCharacterResult URPGCharacterSubsystem::CreateCharacter(
         return FCharacterResult(TEXT("Character system not available during shutdown"));
     }
 
-    // Convert inputs to C strings (UE-friendly approach)
-    const char* RaceJSON = TCHAR_TO_UTF8(*RaceDataJSON);
-    const char* ClassJSON = TCHAR_TO_UTF8(*ClassDataJSON);
-    const char* BackgroundJSON = TCHAR_TO_UTF8(*BackgroundDataJSON);
-    const char* CharName = TCHAR_TO_UTF8(*CharacterName);
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitGameThreadCall);
+    return CallCreateCharacter(*Toolkit, RaceDataJSON, ClassDataJSON, BackgroundDataJSON, CharacterName,
+        Strength, Dexterity, Constitution, Intelligence, Wisdom, Charisma);
+}
+
+TFuture<FCharacterResult> URPGCharacterSubsystem::CreateCharacterAsync(
+    const FString& RaceDataJSON,
+    const FString& ClassDataJSON,
+    const FString& BackgroundDataJSON,
+    const FString& CharacterName,
+    int32 Strength, int32 Dexterity, int32 Constitution,
+    int32 Intelligence, int32 Wisdom, int32 Charisma)
+{
+    if (!IsSafeToCallFunction() || !Executor)
+    {
+        return MakeFulfilledPromise<FCharacterResult>(FCharacterResult(TEXT("Character system not available during shutdown"))).GetFuture();
+    }
+
+    return Executor->Submit<FCharacterResult>(
+        [RaceDataJSON, ClassDataJSON, BackgroundDataJSON, CharacterName, Strength, Dexterity, Constitution, Intelligence, Wisdom, Charisma](const FRPGToolkitAPI& API)
+        {
+            return CallCreateCharacter(API, RaceDataJSON, ClassDataJSON, BackgroundDataJSON, CharacterName,
+                Strength, Dexterity, Constitution, Intelligence, Wisdom, Charisma);
+        });
+}
+
+void URPGCharacterSubsystem::CreateCharacterAsync(
+    const FString& RaceDataJSON,
+    const FString& ClassDataJSON,
+    const FString& BackgroundDataJSON,
+    const FString& CharacterName,
+    int32 Strength, int32 Dexterity, int32 Constitution,
+    int32 Intelligence, int32 Wisdom, int32 Charisma,
+    TUniqueFunction<void(FCharacterResult)> OnComplete)
+{
+    if (!IsSafeToCallFunction() || !Executor)
+    {
+        OnComplete(FCharacterResult(TEXT("Character system not available during shutdown")));
+        return;
+    }
+
+    Executor->SubmitThen<FCharacterResult>(
+        [RaceDataJSON, ClassDataJSON, BackgroundDataJSON, CharacterName, Strength, Dexterity, Constitution, Intelligence, Wisdom, Charisma](const FRPGToolkitAPI& API)
+        {
+            return CallCreateCharacter(API, RaceDataJSON, ClassDataJSON, BackgroundDataJSON, CharacterName,
+                Strength, Dexterity, Constitution, Intelligence, Wisdom, Charisma);
+        },
+        MoveTemp(OnComplete));
+}
+
+FCharacterResult URPGCharacterSubsystem::CallCreateCharacter(
+    const FRPGToolkitAPI& API,
+    const FString& RaceDataJSON,
+    const FString& ClassDataJSON,
+    const FString& BackgroundDataJSON,
+    const FString& CharacterName,
+    int32 Strength, int32 Dexterity, int32 Constitution,
+    int32 Intelligence, int32 Wisdom, int32 Charisma)
+{
+    if (!API.CreateCharacterComplete)
+    {
+        return FCharacterResult(TEXT("Character system not available during shutdown"));
+    }
+
+    // Convert inputs to C strings - the converters own the buffers for the duration of the call
+    FTCHARToUTF8 RaceJSON(*RaceDataJSON);
+    FTCHARToUTF8 ClassJSON(*ClassDataJSON);
+    FTCHARToUTF8 BackgroundJSON(*BackgroundDataJSON);
+    FTCHARToUTF8 CharName(*CharacterName);
 
     // Output parameters for automatic cleanup pattern
     char* OutID = nullptr;
@@ -107,8 +168,8 @@ FCharacterResult URPGCharacterSubsystem::CreateCharacter(
     char* OutError = nullptr;
 
     // Call the toolkit function with automatic cleanup pattern
-    int Result = CreateCharacterCompleteFuncPtr(
-        RaceJSON, ClassJSON, BackgroundJSON, CharName,
+    int Result = API.CreateCharacterComplete(
+        RaceJSON.Get(), ClassJSON.Get(), BackgroundJSON.Get(), CharName.Get(),
         Strength, Dexterity, Constitution, Intelligence, Wisdom, Charisma,
         &OutID, &OutName, &OutLevel, &OutProficiencyBonus,
         &OutRaceID, &OutClassID, &OutBackgroundID,
@@ -201,10 +262,10 @@ bool URPGCharacterSubsystem::ValidateAbilityScores(int32 Str, int32 Dex, int32 C
 
 bool URPGCharacterSubsystem::IsToolkitLoaded() const
 {
-    return bFunctionsLoaded && CreateCharacterCompleteFuncPtr != nullptr;
+    return bFunctionsLoaded && Toolkit && Toolkit->CreateCharacterComplete != nullptr;
 }
 
-FString URPGCharacterSubsystem::ConvertAndFreeString(ANSICHAR* CStr) const
+FString URPGCharacterSubsystem::ConvertAndFreeString(ANSICHAR* CStr)
 {
     if (!CStr)
     {
@@ -216,7 +277,7 @@ FString URPGCharacterSubsystem::ConvertAndFreeString(ANSICHAR* CStr) const
     return Result;
 }
 
-TArray<FString> URPGCharacterSubsystem::ParseStringArray(const FString& ConcatenatedString) const
+TArray<FString> URPGCharacterSubsystem::ParseStringArray(const FString& ConcatenatedString)
 {
     TArray<FString> Result;
     if (!ConcatenatedString.IsEmpty())
@@ -229,7 +290,7 @@ TArray<FString> URPGCharacterSubsystem::ParseStringArray(const FString& Concaten
 bool URPGCharacterSubsystem::IsSafeToCallFunction() const
 {
     // Following established pattern from other subsystems
-    return bFunctionsLoaded && CreateCharacterCompleteFuncPtr && !IsEngineExitRequested();
+    return bFunctionsLoaded && Toolkit && Toolkit->CreateCharacterComplete && !IsEngineExitRequested();
 }
 
 // Note: Sample data constants moved to header to avoid raw string literal issues in implementation file
\ No newline at end of file
@@ -2,8 +2,13 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Async/Future.h"
 #include "RPGCharacterSubsystem.generated.h"
 
+// Forward declarations
+struct FRPGToolkitAPI;
+class FRPGToolkitExecutor;
+
 USTRUCT(BlueprintType)
 struct SESHAT_API FCharacterResult
 {
@@ -74,6 +79,20 @@ public:
         int32 Intelligence = 12, int32 Wisdom = 10, int32 Charisma = 8
     );
 
+    /**
+     * CreateCharacter on the toolkit worker pool - the Go-side JSON unmarshal never blocks the game thread
+     * Blueprint callers use the "Create Character Async" latent node
+     */
+    TFuture<FCharacterResult> CreateCharacterAsync(
+        const FString& RaceDataJSON, const FString& ClassDataJSON, const FString& BackgroundDataJSON, const FString& CharacterName,
+        int32 Strength, int32 Dexterity, int32 Constitution, int32 Intelligence, int32 Wisdom, int32 Charisma);
+
+    /** CreateCharacterAsync with the result delivered to OnComplete on the game thread */
+    void CreateCharacterAsync(
+        const FString& RaceDataJSON, const FString& ClassDataJSON, const FString& BackgroundDataJSON, const FString& CharacterName,
+        int32 Strength, int32 Dexterity, int32 Constitution, int32 Intelligence, int32 Wisdom, int32 Charisma,
+        TUniqueFunction<void(FCharacterResult)> OnComplete);
+
     // Character validation
     UFUNCTION(BlueprintCallable, Category = "RPG Character")
     bool ValidateAbilityScores(int32 Str, int32 Dex, int32 Con, int32 Int, int32 Wis, int32 Cha);
@@ -83,30 +102,25 @@ public:
     bool IsToolkitLoaded() const;
 
 private:
-    // DLL function pointer
-    typedef int (*CreateCharacterCompleteFunc)(
-        const char* raceDataJSON,
-        const char* classDataJSON,
-        const char* backgroundDataJSON,
-        const char* characterName,
-        int str, int dex, int con, int intel, int wis, int cha,
-        char** outID, char** outName, int* outLevel, int* outProficiencyBonus,
-        char** outRaceID, char** outClassID, char** outBackgroundID,
-        int* outStr, int* outDex, int* outCon, int* outInt, int* outWis, int* outCha,
-        char** outSize, int* outSpeed,
-        int* outHP, int* outMaxHP, int* outAC, int* outInitiative,
-        char** outLanguages, char** outFeatures,
-        char** outError
-    );
-    CreateCharacterCompleteFunc CreateCharacterCompleteFuncPtr = nullptr;
+    // Shared toolkit function table (borrowed from FRPGToolkitModule)
+    const FRPGToolkitAPI* Toolkit = nullptr;
+    
+    // Shared worker pool for off-game-thread toolkit calls
+    FRPGToolkitExecutor* Executor = nullptr;
     
     // Standard subsystem patterns (following established dice/entity patterns)
     bool bFunctionsLoaded = false;
-    void* ToolkitDLLHandle = nullptr;
     
-    void LoadDLLFunctions();
-    FString ConvertAndFreeString(ANSICHAR* CStr) const;
-    TArray<FString> ParseStringArray(const FString& ConcatenatedString) const;
+    void BindToolkitFunctions();
+    
+    // CreateCharacterComplete call and result conversion - safe on any thread
+    static FCharacterResult CallCreateCharacter(
+        const FRPGToolkitAPI& API,
+        const FString& RaceDataJSON, const FString& ClassDataJSON, const FString& BackgroundDataJSON, const FString& CharacterName,
+        int32 Strength, int32 Dexterity, int32 Constitution, int32 Intelligence, int32 Wisdom, int32 Charisma);
+    
+    static FString ConvertAndFreeString(ANSICHAR* CStr);
+    static TArray<FString> ParseStringArray(const FString& ConcatenatedString);
     bool IsSafeToCallFunction() const;
 
 public:
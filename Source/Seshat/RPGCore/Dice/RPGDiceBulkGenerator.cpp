@@ -0,0 +1,333 @@
+#include "RPGDiceBulkGenerator.h"
+
+#if PLATFORM_CPU_X86_FAMILY && PLATFORM_ENABLE_VECTORINTRINSICS
+    #define RPG_DICE_BULK_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define RPG_DICE_BULK_SSE2 0
+#endif
+
+// The AVX2 kernel is always compiled on x86 (per-function target on clang/gcc) and picked at runtime by CPUID
+#if RPG_DICE_BULK_SSE2 && (defined(__clang__) || defined(__GNUC__))
+    #define RPG_DICE_BULK_AVX2 1
+    #define RPG_DICE_AVX2_TARGET __attribute__((target("avx2")))
+    #include <immintrin.h>
+#elif RPG_DICE_BULK_SSE2 && defined(_MSC_VER)
+    #define RPG_DICE_BULK_AVX2 1
+    #define RPG_DICE_AVX2_TARGET
+    #include <immintrin.h>
+    #include <intrin.h>
+#else
+    #define RPG_DICE_BULK_AVX2 0
+#endif
+
+namespace
+{
+    using FLaneState = uint32[4][FRPGDiceBulkGenerator::NumLanes];
+
+    FORCEINLINE uint32 RotateLeft32(uint32 Value, int32 Shift)
+    {
+        return (Value << Shift) | (Value >> (32 - Shift));
+    }
+
+    /**
+     * Kernel contract: advance every lane once, write Hi(x * Range) + 1 for each lane into Out
+     * and return a bitmask of lanes whose low product word fell below Threshold (must be re-rolled)
+     */
+    uint32 RollBlockScalar(FLaneState& State, uint32 Range, uint32 Threshold, int32* Out)
+    {
+        uint32 RejectMask = 0;
+        for (int32 Lane = 0; Lane < FRPGDiceBulkGenerator::NumLanes; ++Lane)
+        {
+            uint32& S0 = State[0][Lane];
+            uint32& S1 = State[1][Lane];
+            uint32& S2 = State[2][Lane];
+            uint32& S3 = State[3][Lane];
+
+            // xoshiro128**
+            const uint32 Random = RotateLeft32(S1 * 5, 7) * 9;
+            const uint32 T = S1 << 9;
+            S2 ^= S0;
+            S3 ^= S1;
+            S1 ^= S2;
+            S0 ^= S3;
+            S2 ^= T;
+            S3 = RotateLeft32(S3, 11);
+
+            // Lemire multiply-shift
+            const uint64 Product = static_cast<uint64>(Random) * Range;
+            Out[Lane] = static_cast<int32>(Product >> 32) + 1;
+            if (static_cast<uint32>(Product) < Threshold)
+            {
+                RejectMask |= 1u << Lane;
+            }
+        }
+        return RejectMask;
+    }
+
+#if RPG_DICE_BULK_SSE2
+    FORCEINLINE __m128i RotateLeft32x4(__m128i Value, int32 Shift)
+    {
+        return _mm_or_si128(_mm_slli_epi32(Value, Shift), _mm_srli_epi32(Value, 32 - Shift));
+    }
+
+    /** Four lanes of xoshiro128** + Lemire (SSE2 has no 32-bit mullo, so *5 and *9 are shift-adds) */
+    FORCEINLINE uint32 RollQuadSSE2(uint32* S0Ptr, uint32* S1Ptr, uint32* S2Ptr, uint32* S3Ptr,
+        __m128i Range, __m128i BiasedThreshold, int32* Out)
+    {
+        __m128i S0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(S0Ptr));
+        __m128i S1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(S1Ptr));
+        __m128i S2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(S2Ptr));
+        __m128i S3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(S3Ptr));
+
+        const __m128i Times5 = _mm_add_epi32(_mm_slli_epi32(S1, 2), S1);
+        const __m128i Rotated = RotateLeft32x4(Times5, 7);
+        const __m128i Random = _mm_add_epi32(_mm_slli_epi32(Rotated, 3), Rotated);
+
+        const __m128i T = _mm_slli_epi32(S1, 9);
+        S2 = _mm_xor_si128(S2, S0);
+        S3 = _mm_xor_si128(S3, S1);
+        S1 = _mm_xor_si128(S1, S2);
+        S0 = _mm_xor_si128(S0, S3);
+        S2 = _mm_xor_si128(S2, T);
+        S3 = RotateLeft32x4(S3, 11);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(S0Ptr), S0);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(S1Ptr), S1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(S2Ptr), S2);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(S3Ptr), S3);
+
+        // 32x32->64 products for even and odd lanes
+        const __m128i Even = _mm_mul_epu32(Random, Range);
+        const __m128i Odd = _mm_mul_epu32(_mm_srli_epi64(Random, 32), Range);
+        const __m128i OddWordMask = _mm_set_epi32(-1, 0, -1, 0);
+
+        const __m128i High = _mm_or_si128(_mm_srli_epi64(Even, 32), _mm_and_si128(Odd, OddWordMask));
+        const __m128i Low = _mm_or_si128(_mm_andnot_si128(OddWordMask, Even), _mm_slli_epi64(Odd, 32));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(Out), _mm_add_epi32(High, _mm_set1_epi32(1)));
+
+        // Unsigned Low < Threshold via sign-bias
+        const __m128i Rejected = _mm_cmplt_epi32(_mm_xor_si128(Low, _mm_set1_epi32(INT32_MIN)), BiasedThreshold);
+        return static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(Rejected)));
+    }
+
+    uint32 RollBlockSSE2(FLaneState& State, uint32 Range, uint32 Threshold, int32* Out)
+    {
+        const __m128i RangeVec = _mm_set1_epi32(static_cast<int32>(Range));
+        const __m128i BiasedThreshold = _mm_set1_epi32(static_cast<int32>(Threshold ^ 0x80000000u));
+
+        const uint32 LowMask = RollQuadSSE2(&State[0][0], &State[1][0], &State[2][0], &State[3][0], RangeVec, BiasedThreshold, Out);
+        const uint32 HighMask = RollQuadSSE2(&State[0][4], &State[1][4], &State[2][4], &State[3][4], RangeVec, BiasedThreshold, Out + 4);
+        return LowMask | (HighMask << 4);
+    }
+#endif
+
+#if RPG_DICE_BULK_AVX2
+    /** CPU and OS support for AVX2 (the OS must save the YMM registers on context switch) */
+    bool DetectAVX2()
+    {
+#if defined(__clang__) || defined(__GNUC__)
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#else
+        int32 Info[4];
+        __cpuid(Info, 0);
+        if (Info[0] < 7)
+        {
+            return false;
+        }
+
+        __cpuid(Info, 1);
+        const bool bOSXSave = (Info[2] & (1 << 27)) != 0;
+        const bool bAVX = (Info[2] & (1 << 28)) != 0;
+        if (!bOSXSave || !bAVX || (_xgetbv(0) & 0x6) != 0x6)
+        {
+            return false;
+        }
+
+        __cpuidex(Info, 7, 0);
+        return (Info[1] & (1 << 5)) != 0;
+#endif
+    }
+
+    RPG_DICE_AVX2_TARGET FORCEINLINE __m256i RotateLeft32x8(__m256i Value, int32 Shift)
+    {
+        return _mm256_or_si256(_mm256_slli_epi32(Value, Shift), _mm256_srli_epi32(Value, 32 - Shift));
+    }
+
+    RPG_DICE_AVX2_TARGET uint32 RollBlockAVX2(FLaneState& State, uint32 Range, uint32 Threshold, int32* Out)
+    {
+        __m256i S0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State[0]));
+        __m256i S1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State[1]));
+        __m256i S2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State[2]));
+        __m256i S3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State[3]));
+
+        const __m256i Times5 = _mm256_add_epi32(_mm256_slli_epi32(S1, 2), S1);
+        const __m256i Rotated = RotateLeft32x8(Times5, 7);
+        const __m256i Random = _mm256_add_epi32(_mm256_slli_epi32(Rotated, 3), Rotated);
+
+        const __m256i T = _mm256_slli_epi32(S1, 9);
+        S2 = _mm256_xor_si256(S2, S0);
+        S3 = _mm256_xor_si256(S3, S1);
+        S1 = _mm256_xor_si256(S1, S2);
+        S0 = _mm256_xor_si256(S0, S3);
+        S2 = _mm256_xor_si256(S2, T);
+        S3 = RotateLeft32x8(S3, 11);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(State[0]), S0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(State[1]), S1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(State[2]), S2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(State[3]), S3);
+
+        const __m256i RangeVec = _mm256_set1_epi32(static_cast<int32>(Range));
+        const __m256i Even = _mm256_mul_epu32(Random, RangeVec);
+        const __m256i Odd = _mm256_mul_epu32(_mm256_srli_epi64(Random, 32), RangeVec);
+        const __m256i OddWordMask = _mm256_set_epi32(-1, 0, -1, 0, -1, 0, -1, 0);
+
+        const __m256i High = _mm256_or_si256(_mm256_srli_epi64(Even, 32), _mm256_and_si256(Odd, OddWordMask));
+        const __m256i Low = _mm256_or_si256(_mm256_andnot_si256(OddWordMask, Even), _mm256_slli_epi64(Odd, 32));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(Out), _mm256_add_epi32(High, _mm256_set1_epi32(1)));
+
+        const __m256i BiasedThreshold = _mm256_set1_epi32(static_cast<int32>(Threshold ^ 0x80000000u));
+        const __m256i Rejected = _mm256_cmpgt_epi32(BiasedThreshold, _mm256_xor_si256(Low, _mm256_set1_epi32(INT32_MIN)));
+        return static_cast<uint32>(_mm256_movemask_ps(_mm256_castsi256_ps(Rejected)));
+    }
+#endif
+
+    FORCEINLINE uint64 SplitMix64(uint64& InOutState)
+    {
+        uint64 Z = (InOutState += 0x9E3779B97F4A7C15ull);
+        Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+        return Z ^ (Z >> 31);
+    }
+}
+
+FRPGDiceBulkGenerator::FRPGDiceBulkGenerator(uint64 InSeed)
+    : Fallback(MakeUnique<FRPGFastDiceGenerator>())
+{
+    Seed(InSeed);
+}
+
+void FRPGDiceBulkGenerator::Seed(uint64 InSeed)
+{
+    uint64 SeedState = InSeed;
+    for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+    {
+        const uint64 A = SplitMix64(SeedState);
+        const uint64 B = SplitMix64(SeedState);
+        State[0][Lane] = static_cast<uint32>(A);
+        State[1][Lane] = static_cast<uint32>(A >> 32);
+        State[2][Lane] = static_cast<uint32>(B);
+        State[3][Lane] = static_cast<uint32>(B >> 32);
+
+        // xoshiro must never start from an all-zero state
+        if ((State[0][Lane] | State[1][Lane] | State[2][Lane] | State[3][Lane]) == 0)
+        {
+            State[0][Lane] = 1;
+        }
+    }
+
+    Fallback.Seed(SplitMix64(SeedState));
+}
+
+int32 FRPGDiceBulkGenerator::FillFaces(int32* OutResults, int32 Count, int32 Size)
+{
+    return FillFacesWithKernel(GetBestKernel(), OutResults, Count, Size);
+}
+
+int32 FRPGDiceBulkGenerator::FillFacesWithKernel(EKernel Kernel, int32* OutResults, int32 Count, int32 Size)
+{
+    if (!OutResults || Count <= 0 || Size <= 0 || !IsKernelAvailable(Kernel))
+    {
+        return -1;
+    }
+
+    using FRollBlockFunc = uint32 (*)(FLaneState&, uint32, uint32, int32*);
+    FRollBlockFunc RollBlock = &RollBlockScalar;
+#if RPG_DICE_BULK_SSE2
+    if (Kernel == EKernel::SSE2)
+    {
+        RollBlock = &RollBlockSSE2;
+    }
+#endif
+#if RPG_DICE_BULK_AVX2
+    if (Kernel == EKernel::AVX2)
+    {
+        RollBlock = &RollBlockAVX2;
+    }
+#endif
+
+    const uint32 Range = static_cast<uint32>(Size);
+    const uint32 Threshold = (0u - Range) % Range;
+
+    // Rejected lanes are re-rolled in lane order on the fallback stream, so every kernel agrees
+    auto FixRejected = [this, Range](uint32 RejectMask, int32* Block)
+    {
+        while (RejectMask != 0)
+        {
+            const int32 Lane = FMath::CountTrailingZeros(RejectMask);
+            Block[Lane] = static_cast<int32>(Fallback.NextBounded(Range)) + 1;
+            RejectMask &= RejectMask - 1;
+        }
+    };
+
+    int32 Index = 0;
+    for (; Index + NumLanes <= Count; Index += NumLanes)
+    {
+        const uint32 RejectMask = RollBlock(State, Range, Threshold, OutResults + Index);
+        if (RejectMask != 0)
+        {
+            FixRejected(RejectMask, OutResults + Index);
+        }
+    }
+
+    // Tail: roll a full block and keep what fits
+    if (Index < Count)
+    {
+        int32 Block[NumLanes];
+        FixRejected(RollBlock(State, Range, Threshold, Block), Block);
+        FMemory::Memcpy(OutResults + Index, Block, (Count - Index) * sizeof(int32));
+    }
+
+    return Count;
+}
+
+FRPGDiceBulkGenerator::EKernel FRPGDiceBulkGenerator::GetBestKernel()
+{
+    if (IsKernelAvailable(EKernel::AVX2))
+    {
+        return EKernel::AVX2;
+    }
+    return IsKernelAvailable(EKernel::SSE2) ? EKernel::SSE2 : EKernel::Scalar;
+}
+
+bool FRPGDiceBulkGenerator::IsKernelAvailable(EKernel Kernel)
+{
+    switch (Kernel)
+    {
+        case EKernel::Scalar: return true;
+        case EKernel::SSE2: return RPG_DICE_BULK_SSE2 != 0;
+#if RPG_DICE_BULK_AVX2
+        case EKernel::AVX2:
+        {
+            static const bool bHasAVX2 = DetectAVX2();
+            return bHasAVX2;
+        }
+#endif
+        default: return false;
+    }
+}
+
+const TCHAR* FRPGDiceBulkGenerator::GetKernelName(EKernel Kernel)
+{
+    switch (Kernel)
+    {
+        case EKernel::Scalar: return TEXT("Scalar");
+        case EKernel::SSE2: return TEXT("SSE2");
+        case EKernel::AVX2: return TEXT("AVX2");
+        default: return TEXT("Unknown");
+    }
+}
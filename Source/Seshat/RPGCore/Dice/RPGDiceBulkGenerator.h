@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RPGDiceEngine.h"
+
+/**
+ * Vectorized bulk die roller for Monte Carlo workloads (encounter balancing, AI look-ahead)
+ * Runs eight interleaved xoshiro128** streams and reduces them to 1..Size with Lemire's
+ * multiply-shift method. Lanes that hit the rejection zone are re-rolled on a scalar fallback stream.
+ * The SSE2, AVX2 and scalar kernels produce identical output for the same seed.
+ * Not thread-safe: use one generator per thread
+ */
+class SESHAT_API FRPGDiceBulkGenerator
+{
+public:
+    /** Number of interleaved generator lanes */
+    static constexpr int32 NumLanes = 8;
+
+    /** Kernel implementations, selected at runtime by GetBestKernel() */
+    enum class EKernel : uint8
+    {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    explicit FRPGDiceBulkGenerator(uint64 InSeed = 0x9E3779B97F4A7C15ull);
+
+    /** Reseed all lanes and the fallback stream */
+    void Seed(uint64 InSeed);
+
+    /**
+     * Fill OutResults with Count unbiased faces in 1..Size using the best kernel this CPU supports
+     * @return Count, or -1 if Count/Size are invalid
+     */
+    int32 FillFaces(int32* OutResults, int32 Count, int32 Size);
+
+    /** Same as FillFaces but with an explicit kernel (must be available) - used by consistency checks */
+    int32 FillFacesWithKernel(EKernel Kernel, int32* OutResults, int32 Count, int32 Size);
+
+    /** Best kernel compiled into this build that this CPU supports */
+    static EKernel GetBestKernel();
+
+    /** Whether a kernel is compiled into this build and supported by this CPU (AVX2 is checked once via CPUID) */
+    static bool IsKernelAvailable(EKernel Kernel);
+
+    static const TCHAR* GetKernelName(EKernel Kernel);
+
+private:
+    /** Generator state, one column per lane: State[Word][Lane] (accessed with unaligned loads) */
+    alignas(32) uint32 State[4][NumLanes];
+
+    /** Scalar stream used to re-roll rejected lanes */
+    FRPGDiceEngine Fallback;
+};
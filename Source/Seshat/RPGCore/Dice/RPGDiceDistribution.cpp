@@ -0,0 +1,404 @@
+#include "RPGDiceDistribution.h"
+#include "RPGDiceExpression.h"
+#include "Algo/Reverse.h"
+#include <complex>
+
+// FFT Helpers
+namespace
+{
+    using FComplex = std::complex<double>;
+
+    /** In-place iterative radix-2 FFT (Values.Num() must be a power of two) */
+    void FastFourierTransform(TArray<FComplex>& Values, bool bInverse)
+    {
+        const int32 Num = Values.Num();
+
+        // Bit-reversal permutation
+        for (int32 Index = 1, Reversed = 0; Index < Num; ++Index)
+        {
+            int32 Bit = Num >> 1;
+            for (; Reversed & Bit; Bit >>= 1)
+            {
+                Reversed ^= Bit;
+            }
+            Reversed ^= Bit;
+            if (Index < Reversed)
+            {
+                Swap(Values[Index], Values[Reversed]);
+            }
+        }
+
+        for (int32 Length = 2; Length <= Num; Length <<= 1)
+        {
+            const double Angle = 2.0 * UE_DOUBLE_PI / Length * (bInverse ? -1.0 : 1.0);
+            const FComplex Root(FMath::Cos(Angle), FMath::Sin(Angle));
+            for (int32 Start = 0; Start < Num; Start += Length)
+            {
+                FComplex Twiddle(1.0, 0.0);
+                for (int32 Offset = 0; Offset < Length / 2; ++Offset)
+                {
+                    const FComplex Even = Values[Start + Offset];
+                    const FComplex Odd = Values[Start + Offset + Length / 2] * Twiddle;
+                    Values[Start + Offset] = Even + Odd;
+                    Values[Start + Offset + Length / 2] = Even - Odd;
+                    Twiddle *= Root;
+                }
+            }
+        }
+
+        if (bInverse)
+        {
+            for (FComplex& Value : Values)
+            {
+                Value /= static_cast<double>(Num);
+            }
+        }
+    }
+
+    /** Turn a PMF of X into a PMF of -X (offset handled by the caller) */
+    void ReversePMF(TArray<double>& InOutPMF)
+    {
+        Algo::Reverse(InOutPMF);
+    }
+}
+
+void FRPGDiceDistribution::Convolve(const TArray<double>& A, const TArray<double>& B, TArray<double>& Out)
+{
+    if (A.Num() == 0 || B.Num() == 0)
+    {
+        Out.Reset();
+        return;
+    }
+
+    const int32 ResultNum = A.Num() + B.Num() - 1;
+
+    if (static_cast<int64>(A.Num()) * B.Num() <= DirectConvolutionLimit)
+    {
+        Out.SetNumZeroed(ResultNum);
+        for (int32 IndexA = 0; IndexA < A.Num(); ++IndexA)
+        {
+            if (A[IndexA] == 0.0)
+            {
+                continue;
+            }
+            for (int32 IndexB = 0; IndexB < B.Num(); ++IndexB)
+            {
+                Out[IndexA + IndexB] += A[IndexA] * B[IndexB];
+            }
+        }
+        return;
+    }
+
+    const int32 FFTNum = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(ResultNum)));
+    TArray<FComplex> FA;
+    TArray<FComplex> FB;
+    FA.SetNumZeroed(FFTNum);
+    FB.SetNumZeroed(FFTNum);
+    for (int32 Index = 0; Index < A.Num(); ++Index)
+    {
+        FA[Index] = A[Index];
+    }
+    for (int32 Index = 0; Index < B.Num(); ++Index)
+    {
+        FB[Index] = B[Index];
+    }
+
+    FastFourierTransform(FA, false);
+    FastFourierTransform(FB, false);
+    for (int32 Index = 0; Index < FFTNum; ++Index)
+    {
+        FA[Index] *= FB[Index];
+    }
+    FastFourierTransform(FA, true);
+
+    // Round-off can leave tiny negatives where the true probability is zero
+    Out.SetNumUninitialized(ResultNum);
+    for (int32 Index = 0; Index < ResultNum; ++Index)
+    {
+        Out[Index] = FMath::Max(FA[Index].real(), 0.0);
+    }
+}
+
+bool FRPGDiceDistribution::ComputeKeepHighest(int32 Count, int32 Size, int32 KeepCount, TArray<double>& OutPMF, FString& OutError)
+{
+    OutPMF.Reset();
+    if (KeepCount <= 0)
+    {
+        OutPMF.Add(1.0);
+        return true;
+    }
+
+    const int32 MaxSum = KeepCount * Size;
+    const int64 Work = static_cast<int64>(Size) * KeepCount * (Count + 1) * (MaxSum + 1);
+    if (Work > MaxKeepWork)
+    {
+        OutError = FString::Printf(TEXT("%dd%d keep %d is too large to evaluate exactly"), Count, Size, KeepCount);
+        return false;
+    }
+
+    // Walk face values from high to low. State: J dice already placed (all higher than the current face)
+    // and S = sum of the kept ones. Once KeepCount dice are placed the kept sum is final, so those states
+    // collapse into OutPMF. Given R unplaced dice that are all <= V, the number showing exactly V is
+    // Binomial(R, 1/V).
+    const int32 SumStride = MaxSum + 1;
+    TArray<double> State;
+    TArray<double> NextState;
+    State.SetNumZeroed(KeepCount * SumStride);
+    NextState.SetNumZeroed(KeepCount * SumStride);
+    OutPMF.SetNumZeroed(SumStride);
+    State[0] = 1.0;
+
+    TArray<double> Binomial;
+    Binomial.SetNumUninitialized(Count + 1);
+
+    for (int32 Face = Size; Face >= 1; --Face)
+    {
+        FMemory::Memzero(NextState.GetData(), NextState.Num() * sizeof(double));
+
+        for (int32 Placed = 0; Placed < KeepCount; ++Placed)
+        {
+            const int32 Remaining = Count - Placed;
+
+            // P(exactly C of the Remaining dice show Face), in log space to avoid underflow
+            if (Face == 1)
+            {
+                for (int32 C = 0; C <= Remaining; ++C)
+                {
+                    Binomial[C] = C == Remaining ? 1.0 : 0.0;
+                }
+            }
+            else
+            {
+                const double LogHit = -FMath::Loge(static_cast<double>(Face));
+                const double LogMiss = FMath::Loge(static_cast<double>(Face - 1) / Face);
+                double LogChoose = 0.0;
+                for (int32 C = 0; C <= Remaining; ++C)
+                {
+                    Binomial[C] = FMath::Exp(LogChoose + C * LogHit + (Remaining - C) * LogMiss);
+                    if (C < Remaining)
+                    {
+                        LogChoose += FMath::Loge(static_cast<double>(Remaining - C)) - FMath::Loge(static_cast<double>(C + 1));
+                    }
+                }
+            }
+
+            const double* Row = State.GetData() + Placed * SumStride;
+            for (int32 Sum = 0; Sum <= Placed * Size; ++Sum)
+            {
+                const double Mass = Row[Sum];
+                if (Mass == 0.0)
+                {
+                    continue;
+                }
+
+                for (int32 C = 0; C <= Remaining; ++C)
+                {
+                    const double Probability = Mass * Binomial[C];
+                    if (Probability == 0.0)
+                    {
+                        continue;
+                    }
+
+                    const int32 Kept = FMath::Min(C, KeepCount - Placed);
+                    const int32 NewSum = Sum + Kept * Face;
+                    if (Placed + C >= KeepCount)
+                    {
+                        OutPMF[NewSum] += Probability;
+                    }
+                    else
+                    {
+                        NextState[(Placed + C) * SumStride + NewSum] += Probability;
+                    }
+                }
+            }
+        }
+
+        Swap(State, NextState);
+    }
+
+    return true;
+}
+
+bool FRPGDiceDistribution::ComputeTerm(const FRPGDiceOp& Op, TArray<double>& OutPMF, int32& OutMin, FString& OutError)
+{
+    OutPMF.Reset();
+
+    if (Op.Code == ERPGDiceOpCode::Constant)
+    {
+        OutPMF.Add(1.0);
+        OutMin = Op.Sign * Op.Count;
+        return true;
+    }
+
+    const int32 Kept = Op.GetKeptCount();
+    if (static_cast<int64>(Kept) * (Op.Size - 1) + 1 > MaxSupport)
+    {
+        OutError = FString::Printf(TEXT("%dd%d has too many outcomes to evaluate exactly"), Op.Count, Op.Size);
+        return false;
+    }
+
+    const bool bKeepLow = Op.Keep == ERPGDiceKeepMode::KeepLowest || Op.Keep == ERPGDiceKeepMode::DropHighest;
+
+    if (Op.Keep == ERPGDiceKeepMode::None || Kept == Op.Count)
+    {
+        // Plain NdS: convolve the single-die PMF by repeated squaring
+        TArray<double> Die;
+        Die.Init(1.0 / Op.Size, Op.Size);
+
+        TArray<double> Result;
+        Result.Add(1.0);
+        TArray<double> Scratch;
+        for (int32 Remaining = Op.Count; Remaining > 0; Remaining >>= 1)
+        {
+            if (Remaining & 1)
+            {
+                Convolve(Result, Die, Scratch);
+                Swap(Result, Scratch);
+            }
+            if (Remaining > 1)
+            {
+                Convolve(Die, Die, Scratch);
+                Swap(Die, Scratch);
+            }
+        }
+        OutPMF = MoveTemp(Result);
+        OutMin = Op.Count;
+    }
+    else
+    {
+        // Support of the keep-highest DP is 0..Kept*Size; only Kept..Kept*Size is reachable
+        if (!ComputeKeepHighest(Op.Count, Op.Size, Kept, OutPMF, OutError))
+        {
+            return false;
+        }
+        OutPMF.RemoveAt(0, Kept, EAllowShrinking::No);
+        OutMin = Kept;
+
+        // Lowest k of X equals k*(S+1) minus the highest k of the mirrored faces S+1-X
+        if (bKeepLow)
+        {
+            ReversePMF(OutPMF);
+        }
+    }
+
+    if (Op.Sign < 0)
+    {
+        const int32 Max = OutMin + OutPMF.Num() - 1;
+        ReversePMF(OutPMF);
+        OutMin = -Max;
+    }
+
+    return true;
+}
+
+bool FRPGDiceDistribution::Compute(const FRPGDiceExpression& Expression, ERPGEventModifier RollModifier, FRPGDiceDistribution& Out, FString& OutError)
+{
+    Out = FRPGDiceDistribution();
+
+    TArray<FRPGDiceOp> Ops = Expression.GetOps();
+    if (Ops.Num() == 0)
+    {
+        OutError = TEXT("Empty dice expression");
+        return false;
+    }
+
+    // Advantage/Disadvantage: roll the first single die twice and keep the better/worse one
+    if (RollModifier == ERPGEventModifier::Advantage || RollModifier == ERPGEventModifier::Disadvantage)
+    {
+        FRPGDiceOp* SingleDie = Ops.FindByPredicate([](const FRPGDiceOp& Op)
+        {
+            return Op.Code == ERPGDiceOpCode::Dice && Op.Count == 1 && Op.Keep == ERPGDiceKeepMode::None;
+        });
+
+        if (SingleDie)
+        {
+            SingleDie->Count = 2;
+            SingleDie->KeepCount = 1;
+            SingleDie->Keep = RollModifier == ERPGEventModifier::Advantage ? ERPGDiceKeepMode::KeepHighest : ERPGDiceKeepMode::KeepLowest;
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FRPGDiceDistribution: '%s' has no single-die term - advantage/disadvantage ignored"), *Expression.GetNotation());
+        }
+    }
+
+    TArray<double> Total;
+    Total.Add(1.0);
+    int64 TotalMin = 0;
+
+    TArray<double> Term;
+    TArray<double> Scratch;
+    for (const FRPGDiceOp& Op : Ops)
+    {
+        int32 TermMin = 0;
+        if (!ComputeTerm(Op, Term, TermMin, OutError))
+        {
+            return false;
+        }
+
+        if (static_cast<int64>(Total.Num()) + Term.Num() - 1 > MaxSupport)
+        {
+            OutError = TEXT("Expression has too many outcomes to evaluate exactly");
+            return false;
+        }
+
+        Convolve(Total, Term, Scratch);
+        Swap(Total, Scratch);
+        TotalMin += TermMin;
+    }
+
+    // The array spans exactly the reachable totals; renormalise away FFT round-off
+    double Mass = 0.0;
+    for (double Probability : Total)
+    {
+        Mass += Probability;
+    }
+
+    Out.MinValue = static_cast<int32>(TotalMin);
+    Out.PMF.SetNumUninitialized(Total.Num());
+    Out.CDF.SetNumUninitialized(Total.Num());
+
+    double Running = 0.0;
+    double Mean = 0.0;
+    double SecondMoment = 0.0;
+    for (int32 Index = 0; Index < Out.PMF.Num(); ++Index)
+    {
+        const double Probability = Total[Index] / Mass;
+        const double Value = Out.MinValue + Index;
+        Out.PMF[Index] = Probability;
+        Running += Probability;
+        Out.CDF[Index] = FMath::Min(Running, 1.0);
+        Mean += Value * Probability;
+        SecondMoment += Value * Value * Probability;
+    }
+    Out.CDF.Last() = 1.0;
+    Out.Mean = Mean;
+    Out.Variance = FMath::Max(SecondMoment - Mean * Mean, 0.0);
+
+    return true;
+}
+
+double FRPGDiceDistribution::GetProbability(int32 Value) const
+{
+    const int64 Index = static_cast<int64>(Value) - MinValue;
+    return (Index >= 0 && Index < PMF.Num()) ? PMF[Index] : 0.0;
+}
+
+double FRPGDiceDistribution::GetProbabilityAtMost(int32 Value) const
+{
+    const int64 Index = static_cast<int64>(Value) - MinValue;
+    if (Index < 0)
+    {
+        return 0.0;
+    }
+    return Index >= CDF.Num() ? 1.0 : CDF[Index];
+}
+
+double FRPGDiceDistribution::GetProbabilityAtLeast(int32 Value) const
+{
+    if (Value == MIN_int32)
+    {
+        return 1.0;
+    }
+    return 1.0 - GetProbabilityAtMost(Value - 1);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RPGCore/Events/RPGEventTypes.h"
+
+class FRPGDiceExpression;
+struct FRPGDiceOp;
+
+/**
+ * Exact probability distribution of a dice expression
+ * Built by convolving per-term PMFs (direct for small supports, FFT for large pools);
+ * keep/drop terms use an order-statistics dynamic program instead of enumerating outcomes
+ */
+class SESHAT_API FRPGDiceDistribution
+{
+public:
+    /** Work limit for a single keep/drop term (states x transitions) */
+    static constexpr int64 MaxKeepWork = 200000000;
+
+    /** Largest number of distinct totals a distribution may have */
+    static constexpr int64 MaxSupport = 1 << 22;
+
+    /** Convolutions larger than this (product of supports) go through the FFT */
+    static constexpr int64 DirectConvolutionLimit = 1 << 16;
+
+    /**
+     * Compute the distribution of a compiled expression
+     * @param RollModifier Advantage/Disadvantage turn the first single-die term into 2dNkh1/2dNkl1; other modifiers are ignored
+     * @return false (with OutError) if the expression is too large to evaluate exactly
+     */
+    static bool Compute(const FRPGDiceExpression& Expression, ERPGEventModifier RollModifier, FRPGDiceDistribution& Out, FString& OutError);
+
+    int32 GetMinValue() const { return MinValue; }
+    int32 GetMaxValue() const { return MinValue + PMF.Num() - 1; }
+
+    /** P(X == Value) */
+    double GetProbability(int32 Value) const;
+
+    /** P(X <= Value) */
+    double GetProbabilityAtMost(int32 Value) const;
+
+    /** P(X >= Value) */
+    double GetProbabilityAtLeast(int32 Value) const;
+
+    double GetMean() const { return Mean; }
+    double GetVariance() const { return Variance; }
+
+    /** Probabilities for GetMinValue()..GetMaxValue() */
+    const TArray<double>& GetPMF() const { return PMF; }
+
+    /** Cumulative probabilities for GetMinValue()..GetMaxValue() */
+    const TArray<double>& GetCDF() const { return CDF; }
+
+    /** Linear convolution of two PMFs (exposed for reuse) */
+    static void Convolve(const TArray<double>& A, const TArray<double>& B, TArray<double>& Out);
+
+private:
+    /** PMF of a single dice term (sign applied), offset returned in OutMin */
+    static bool ComputeTerm(const FRPGDiceOp& Op, TArray<double>& OutPMF, int32& OutMin, FString& OutError);
+
+    /** PMF of the sum of the highest KeepCount of Count dice with Size faces (support 0..KeepCount*Size) */
+    static bool ComputeKeepHighest(int32 Count, int32 Size, int32 KeepCount, TArray<double>& OutPMF, FString& OutError);
+
+    int32 MinValue = 0;
+    TArray<double> PMF;
+    TArray<double> CDF;
+    double Mean = 0.0;
+    double Variance = 0.0;
+};
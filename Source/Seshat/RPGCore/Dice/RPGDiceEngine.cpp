@@ -0,0 +1,146 @@
+#include "RPGDiceEngine.h"
+#include <random>
+
+// Crypto Generator Implementation
+struct FRPGCryptoDiceGenerator::FImpl
+{
+    std::random_device Device;
+};
+
+FRPGCryptoDiceGenerator::FRPGCryptoDiceGenerator()
+    : Impl(MakeUnique<FImpl>())
+{
+}
+
+FRPGCryptoDiceGenerator::~FRPGCryptoDiceGenerator() = default;
+
+uint32 FRPGCryptoDiceGenerator::Next32()
+{
+    return static_cast<uint32>(Impl->Device());
+}
+
+// Fast Generator Implementation (xoshiro256**, Blackman & Vigna)
+namespace
+{
+    FORCEINLINE uint64 RotateLeft64(uint64 Value, int32 Shift)
+    {
+        return (Value << Shift) | (Value >> (64 - Shift));
+    }
+
+    FORCEINLINE uint64 SplitMix64(uint64& InOutState)
+    {
+        uint64 Z = (InOutState += 0x9E3779B97F4A7C15ull);
+        Z = (Z ^ (Z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Z = (Z ^ (Z >> 27)) * 0x94D049BB133111EBull;
+        return Z ^ (Z >> 31);
+    }
+}
+
+FRPGFastDiceGenerator::FRPGFastDiceGenerator(uint64 InSeed)
+{
+    Seed(InSeed);
+}
+
+void FRPGFastDiceGenerator::Seed(uint64 InSeed)
+{
+    // SplitMix64 never produces an all-zero xoshiro state
+    uint64 SeedState = InSeed;
+    for (uint64& Word : State)
+    {
+        Word = SplitMix64(SeedState);
+    }
+}
+
+uint64 FRPGFastDiceGenerator::Next64()
+{
+    const uint64 Result = RotateLeft64(State[1] * 5, 7) * 9;
+    const uint64 T = State[1] << 17;
+
+    State[2] ^= State[0];
+    State[3] ^= State[1];
+    State[1] ^= State[2];
+    State[0] ^= State[3];
+    State[2] ^= T;
+    State[3] = RotateLeft64(State[3], 45);
+
+    return Result;
+}
+
+uint32 FRPGFastDiceGenerator::Next32()
+{
+    // Upper bits of xoshiro256** have the best statistical quality
+    return static_cast<uint32>(Next64() >> 32);
+}
+
+// Dice Engine Implementation
+FRPGDiceEngine::FRPGDiceEngine(TUniquePtr<IRPGDiceGenerator> InGenerator)
+    : OwnedGenerator(MoveTemp(InGenerator))
+    , Generator(OwnedGenerator.Get())
+{
+    check(Generator != nullptr);
+}
+
+FRPGDiceEngine::FRPGDiceEngine(IRPGDiceGenerator& InGenerator)
+    : Generator(&InGenerator)
+{
+}
+
+uint32 FRPGDiceEngine::NextBounded(uint32 Range)
+{
+    return NextBounded(*Generator, Range);
+}
+
+uint32 FRPGDiceEngine::NextBounded(IRPGDiceGenerator& Source, uint32 Range)
+{
+    // Lemire, "Fast Random Integer Generation in an Interval" (2019)
+    uint64 Product = static_cast<uint64>(Source.Next32()) * Range;
+    uint32 Low = static_cast<uint32>(Product);
+
+    if (Low < Range)
+    {
+        const uint32 Threshold = (0u - Range) % Range;
+        while (Low < Threshold)
+        {
+            Product = static_cast<uint64>(Source.Next32()) * Range;
+            Low = static_cast<uint32>(Product);
+        }
+    }
+
+    return static_cast<uint32>(Product >> 32);
+}
+
+int32 FRPGDiceEngine::Roll(int32 Size)
+{
+    if (Size <= 0)
+    {
+        return -1;
+    }
+
+    return static_cast<int32>(NextBounded(static_cast<uint32>(Size))) + 1;
+}
+
+int32 FRPGDiceEngine::RollN(int32 Count, int32 Size, int32* OutResults)
+{
+    if (Count <= 0 || Size <= 0 || !OutResults)
+    {
+        return -1;
+    }
+
+    const uint32 Range = static_cast<uint32>(Size);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        OutResults[Index] = static_cast<int32>(NextBounded(Range)) + 1;
+    }
+
+    return Count;
+}
+
+void FRPGDiceEngine::Seed(uint64 InSeed)
+{
+    Generator->Seed(InSeed);
+}
+
+const TCHAR* FRPGDiceEngine::GetGeneratorName() const
+{
+    return Generator->GetName();
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+/**
+ * Source of uniformly distributed 32-bit words for the native dice engine
+ */
+class SESHAT_API IRPGDiceGenerator
+{
+public:
+    virtual ~IRPGDiceGenerator() = default;
+
+    /** Next uniformly distributed 32-bit word */
+    virtual uint32 Next32() = 0;
+
+    /** Reseed the generator (ignored by non-deterministic generators) */
+    virtual void Seed(uint64 InSeed) {}
+
+    /** Short name for logs and benchmarks */
+    virtual const TCHAR* GetName() const = 0;
+};
+
+/**
+ * Crypto-backed generator for player-facing rolls
+ * Uses the platform's secure random source (std::random_device)
+ */
+class SESHAT_API FRPGCryptoDiceGenerator : public IRPGDiceGenerator
+{
+public:
+    FRPGCryptoDiceGenerator();
+    virtual ~FRPGCryptoDiceGenerator() override;
+
+    virtual uint32 Next32() override;
+    virtual const TCHAR* GetName() const override { return TEXT("Crypto"); }
+
+private:
+    /** Opaque std::random_device (kept out of the header) */
+    struct FImpl;
+    TUniquePtr<FImpl> Impl;
+};
+
+/**
+ * Seeded xoshiro256** generator for bulk simulation and AI look-ahead
+ * Deterministic for a given seed; the state is expanded from the seed with SplitMix64
+ */
+class SESHAT_API FRPGFastDiceGenerator : public IRPGDiceGenerator
+{
+public:
+    explicit FRPGFastDiceGenerator(uint64 InSeed = 0x9E3779B97F4A7C15ull);
+
+    virtual uint32 Next32() override;
+    virtual void Seed(uint64 InSeed) override;
+    virtual const TCHAR* GetName() const override { return TEXT("Xoshiro256**"); }
+
+    /** Next 64-bit output of xoshiro256** */
+    uint64 Next64();
+
+private:
+    uint64 State[4];
+};
+
+/**
+ * In-process dice engine - same Roll/RollN surface as the toolkit roller, without the CGO call
+ * Ranges are reduced with Lemire's nearly divisionless method, so every face is equally likely
+ * Not thread-safe: use one engine per thread
+ */
+class SESHAT_API FRPGDiceEngine
+{
+public:
+    /** Engine that owns its generator */
+    explicit FRPGDiceEngine(TUniquePtr<IRPGDiceGenerator> InGenerator);
+
+    /** Engine that borrows a generator owned elsewhere (e.g. a named seeded stream) */
+    explicit FRPGDiceEngine(IRPGDiceGenerator& InGenerator);
+
+    /** Roll one die with Size faces (1..Size), or -1 if Size is invalid */
+    int32 Roll(int32 Size);
+
+    /**
+     * Roll Count dice with Size faces into OutResults
+     * @return Number of dice rolled, or -1 if Count/Size are invalid
+     */
+    int32 RollN(int32 Count, int32 Size, int32* OutResults);
+
+    /** Reseed the underlying generator */
+    void Seed(uint64 InSeed);
+
+    /** Name of the underlying generator */
+    const TCHAR* GetGeneratorName() const;
+
+    /** Uniform value in [0, Range) - Range must be non-zero */
+    uint32 NextBounded(uint32 Range);
+
+    /** Uniform value in [0, Range) drawn from any generator - Range must be non-zero */
+    static uint32 NextBounded(IRPGDiceGenerator& Source, uint32 Range);
+
+private:
+    /** Set when the engine owns its generator */
+    TUniquePtr<IRPGDiceGenerator> OwnedGenerator;
+
+    /** Generator in use (owned or borrowed) */
+    IRPGDiceGenerator* Generator;
+};
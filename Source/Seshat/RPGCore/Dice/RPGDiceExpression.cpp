@@ -0,0 +1,292 @@
+#include "RPGDiceExpression.h"
+#include "Algo/Sort.h"
+
+// Op Implementation
+int32 FRPGDiceOp::GetKeptCount() const
+{
+    switch (Keep)
+    {
+        case ERPGDiceKeepMode::KeepHighest:
+        case ERPGDiceKeepMode::KeepLowest:
+            return FMath::Min(KeepCount, Count);
+        case ERPGDiceKeepMode::DropHighest:
+        case ERPGDiceKeepMode::DropLowest:
+            return FMath::Max(Count - KeepCount, 0);
+        default:
+            return Count;
+    }
+}
+
+// Parser
+namespace
+{
+    struct FDiceNotationParser
+    {
+        const TCHAR* Cursor;
+        FString& Error;
+
+        void SkipWhitespace()
+        {
+            while (*Cursor && FChar::IsWhitespace(*Cursor))
+            {
+                ++Cursor;
+            }
+        }
+
+        bool Peek(TCHAR Expected)
+        {
+            SkipWhitespace();
+            return FChar::ToLower(*Cursor) == Expected;
+        }
+
+        /** Reads an unsigned integer; returns false if none is present or it overflows Limit */
+        bool ReadNumber(int32& OutValue, int32 Limit, const TCHAR* What)
+        {
+            SkipWhitespace();
+            if (!FChar::IsDigit(*Cursor))
+            {
+                return false;
+            }
+
+            int64 Value = 0;
+            while (FChar::IsDigit(*Cursor))
+            {
+                Value = Value * 10 + (*Cursor - TEXT('0'));
+                if (Value > Limit)
+                {
+                    Error = FString::Printf(TEXT("%s exceeds the limit of %d"), What, Limit);
+                    return false;
+                }
+                ++Cursor;
+            }
+
+            OutValue = static_cast<int32>(Value);
+            return true;
+        }
+
+        bool ParseTerm(int8 Sign, FRPGDiceOp& OutOp)
+        {
+            OutOp = FRPGDiceOp();
+            OutOp.Sign = Sign;
+
+            int32 Number = 1;
+            const bool bHasNumber = ReadNumber(Number, MAX_int32, TEXT("Number"));
+            if (!Error.IsEmpty())
+            {
+                return false;
+            }
+
+            if (!Peek(TEXT('d')))
+            {
+                if (!bHasNumber)
+                {
+                    Error = FString::Printf(TEXT("Expected a number or 'd' at '%s'"), Cursor);
+                    return false;
+                }
+                OutOp.Code = ERPGDiceOpCode::Constant;
+                OutOp.Count = Number;
+                return true;
+            }
+            ++Cursor;
+
+            OutOp.Code = ERPGDiceOpCode::Dice;
+            OutOp.Count = Number;
+            if (OutOp.Count <= 0 || OutOp.Count > FRPGDiceExpression::MaxDicePerTerm)
+            {
+                Error = FString::Printf(TEXT("Dice count must be 1..%d"), FRPGDiceExpression::MaxDicePerTerm);
+                return false;
+            }
+
+            if (Peek(TEXT('%')))
+            {
+                ++Cursor;
+                OutOp.Size = 100;
+            }
+            else if (!ReadNumber(OutOp.Size, FRPGDiceExpression::MaxDieSize, TEXT("Die size")) || OutOp.Size <= 0)
+            {
+                if (Error.IsEmpty())
+                {
+                    Error = FString::Printf(TEXT("Expected a die size at '%s'"), Cursor);
+                }
+                return false;
+            }
+
+            return ParseKeep(OutOp);
+        }
+
+        bool ParseKeep(FRPGDiceOp& Op)
+        {
+            if (Peek(TEXT('k')))
+            {
+                ++Cursor;
+                Op.Keep = ERPGDiceKeepMode::KeepHighest;
+                if (FChar::ToLower(*Cursor) == TEXT('h')) { ++Cursor; }
+                else if (FChar::ToLower(*Cursor) == TEXT('l')) { ++Cursor; Op.Keep = ERPGDiceKeepMode::KeepLowest; }
+            }
+            else if (Peek(TEXT('d')) && (FChar::ToLower(Cursor[1]) == TEXT('h') || FChar::ToLower(Cursor[1]) == TEXT('l')))
+            {
+                Op.Keep = FChar::ToLower(Cursor[1]) == TEXT('h') ? ERPGDiceKeepMode::DropHighest : ERPGDiceKeepMode::DropLowest;
+                Cursor += 2;
+            }
+            else
+            {
+                return true;
+            }
+
+            Op.KeepCount = 1;
+            ReadNumber(Op.KeepCount, FRPGDiceExpression::MaxDicePerTerm, TEXT("Keep count"));
+            if (!Error.IsEmpty())
+            {
+                return false;
+            }
+            if (Op.KeepCount > Op.Count)
+            {
+                Error = FString::Printf(TEXT("Cannot keep or drop %d of %d dice"), Op.KeepCount, Op.Count);
+                return false;
+            }
+            return true;
+        }
+    };
+}
+
+bool FRPGDiceExpression::Compile(const FString& InNotation, FRPGDiceExpression& OutExpression, FString& OutError)
+{
+    OutExpression = FRPGDiceExpression();
+    OutError.Reset();
+
+    FDiceNotationParser Parser{ *InNotation, OutError };
+
+    int8 Sign = 1;
+    if (Parser.Peek(TEXT('+'))) { ++Parser.Cursor; }
+    else if (Parser.Peek(TEXT('-'))) { ++Parser.Cursor; Sign = -1; }
+
+    while (true)
+    {
+        if (OutExpression.Ops.Num() >= MaxTerms)
+        {
+            OutError = FString::Printf(TEXT("Expression has more than %d terms"), MaxTerms);
+            return false;
+        }
+
+        FRPGDiceOp Op;
+        if (!Parser.ParseTerm(Sign, Op))
+        {
+            return false;
+        }
+        OutExpression.Ops.Add(Op);
+
+        Parser.SkipWhitespace();
+        if (*Parser.Cursor == TEXT('\0'))
+        {
+            break;
+        }
+        if (*Parser.Cursor == TEXT('+')) { Sign = 1; }
+        else if (*Parser.Cursor == TEXT('-')) { Sign = -1; }
+        else
+        {
+            OutError = FString::Printf(TEXT("Unexpected '%c' in dice expression"), *Parser.Cursor);
+            return false;
+        }
+        ++Parser.Cursor;
+    }
+
+    OutExpression.Notation = InNotation;
+    return true;
+}
+
+bool FRPGDiceExpression::Evaluate(FRollDiceFunc RollDice, int32& OutTotal, int32* OutFaces, int32 MaxFaces, int32* OutNumFaces) const
+{
+    TArray<int32, TInlineAllocator<64>> Scratch;
+    int64 Total = 0;
+    int32 NumFaces = 0;
+
+    for (const FRPGDiceOp& Op : Ops)
+    {
+        if (Op.Code == ERPGDiceOpCode::Constant)
+        {
+            Total += static_cast<int64>(Op.Sign) * Op.Count;
+            continue;
+        }
+
+        Scratch.SetNumUninitialized(Op.Count, EAllowShrinking::No);
+        if (!RollDice(Scratch.GetData(), Op.Count, Op.Size))
+        {
+            OutTotal = -1;
+            return false;
+        }
+
+        // Record faces before keep/drop reorders them
+        if (OutFaces)
+        {
+            const int32 ToCopy = FMath::Min(Op.Count, MaxFaces - NumFaces);
+            if (ToCopy > 0)
+            {
+                FMemory::Memcpy(OutFaces + NumFaces, Scratch.GetData(), ToCopy * sizeof(int32));
+                NumFaces += ToCopy;
+            }
+        }
+
+        // Keep/drop: sort so the kept dice form a contiguous range
+        int32 First = 0;
+        int32 Last = Op.Count;
+        if (Op.Keep != ERPGDiceKeepMode::None)
+        {
+            Algo::Sort(Scratch);
+            const int32 Kept = Op.GetKeptCount();
+            const bool bKeepHigh = Op.Keep == ERPGDiceKeepMode::KeepHighest || Op.Keep == ERPGDiceKeepMode::DropLowest;
+            First = bKeepHigh ? Op.Count - Kept : 0;
+            Last = First + Kept;
+        }
+
+        int64 Sum = 0;
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            Sum += Scratch[Index];
+        }
+        Total += Op.Sign * Sum;
+    }
+
+    OutTotal = static_cast<int32>(FMath::Clamp<int64>(Total, MIN_int32, MAX_int32));
+    if (OutNumFaces)
+    {
+        *OutNumFaces = NumFaces;
+    }
+    return true;
+}
+
+int32 FRPGDiceExpression::GetTotalDice() const
+{
+    int32 TotalDice = 0;
+    for (const FRPGDiceOp& Op : Ops)
+    {
+        if (Op.Code == ERPGDiceOpCode::Dice)
+        {
+            TotalDice += Op.Count;
+        }
+    }
+    return TotalDice;
+}
+
+int32 FRPGDiceExpression::GetMinValue() const
+{
+    int64 Value = 0;
+    for (const FRPGDiceOp& Op : Ops)
+    {
+        const int64 Low = Op.Code == ERPGDiceOpCode::Constant ? Op.Count : Op.GetKeptCount();
+        const int64 High = Op.Code == ERPGDiceOpCode::Constant ? Op.Count : static_cast<int64>(Op.GetKeptCount()) * Op.Size;
+        Value += Op.Sign > 0 ? Low : -High;
+    }
+    return static_cast<int32>(FMath::Clamp<int64>(Value, MIN_int32, MAX_int32));
+}
+
+int32 FRPGDiceExpression::GetMaxValue() const
+{
+    int64 Value = 0;
+    for (const FRPGDiceOp& Op : Ops)
+    {
+        const int64 Low = Op.Code == ERPGDiceOpCode::Constant ? Op.Count : Op.GetKeptCount();
+        const int64 High = Op.Code == ERPGDiceOpCode::Constant ? Op.Count : static_cast<int64>(Op.GetKeptCount()) * Op.Size;
+        Value += Op.Sign > 0 ? High : -Low;
+    }
+    return static_cast<int32>(FMath::Clamp<int64>(Value, MIN_int32, MAX_int32));
+}
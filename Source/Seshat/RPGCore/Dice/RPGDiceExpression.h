@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+/** Bytecode instruction kinds */
+enum class ERPGDiceOpCode : uint8
+{
+    /** Roll Count dice with Size faces (optionally keep/drop) and add the sum */
+    Dice,
+    /** Add a constant (stored in Count) */
+    Constant
+};
+
+/** Keep/drop selection applied to a Dice op */
+enum class ERPGDiceKeepMode : uint8
+{
+    None,
+    KeepHighest,
+    KeepLowest,
+    DropHighest,
+    DropLowest
+};
+
+/**
+ * One compiled term of a dice expression, e.g. "-4d6kh3" or "+3"
+ */
+struct FRPGDiceOp
+{
+    ERPGDiceOpCode Code = ERPGDiceOpCode::Constant;
+    ERPGDiceKeepMode Keep = ERPGDiceKeepMode::None;
+    int8 Sign = 1;
+    int32 Count = 0;
+    int32 Size = 0;
+    int32 KeepCount = 0;
+
+    /** Number of dice that contribute to the sum after keep/drop */
+    int32 GetKeptCount() const;
+};
+
+/**
+ * Compiled dice notation - parse once, evaluate many times
+ * Grammar (case-insensitive, whitespace ignored):
+ *   expr := ['+'|'-'] term (('+'|'-') term)*
+ *   term := [N] 'd' (S | '%') [('kh'|'kl'|'dh'|'dl'|'k') [M]] | N
+ * Examples: "2d6+3", "4d6kh3", "2d20kl1+5", "d%", "1d8+1d6-1"
+ */
+class SESHAT_API FRPGDiceExpression
+{
+public:
+    /** Limits that keep a hostile notation from allocating or looping unbounded */
+    static constexpr int32 MaxDicePerTerm = 1000;
+    static constexpr int32 MaxDieSize = 1000000;
+    static constexpr int32 MaxTerms = 32;
+
+    /** Fills OutFaces with Count faces in 1..Size; returns false if the roll failed */
+    using FRollDiceFunc = TFunctionRef<bool(int32* OutFaces, int32 Count, int32 Size)>;
+
+    /**
+     * Parse a notation into bytecode
+     * @return true on success; OutError describes the first problem otherwise
+     */
+    static bool Compile(const FString& Notation, FRPGDiceExpression& OutExpression, FString& OutError);
+
+    /**
+     * Evaluate the compiled expression
+     * @param RollDice Source of die faces (lets the caller pick the dice backend)
+     * @param OutTotal Sum of all terms
+     * @param OutFaces Optional buffer for the rolled faces, in term order (before keep/drop)
+     * @param MaxFaces Capacity of OutFaces
+     * @param OutNumFaces Optional number of faces written into OutFaces
+     * @return false if a roll failed
+     */
+    bool Evaluate(FRollDiceFunc RollDice, int32& OutTotal, int32* OutFaces = nullptr, int32 MaxFaces = 0, int32* OutNumFaces = nullptr) const;
+
+    const TArray<FRPGDiceOp>& GetOps() const { return Ops; }
+    const FString& GetNotation() const { return Notation; }
+
+    /** Total number of dice rolled per evaluation */
+    int32 GetTotalDice() const;
+
+    /** Smallest and largest possible totals */
+    int32 GetMinValue() const;
+    int32 GetMaxValue() const;
+
+private:
+    TArray<FRPGDiceOp> Ops;
+    FString Notation;
+};
@@ -0,0 +1,182 @@
+#include "RPGDiceRollPool.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+
+// Roll Pool Implementation
+FRPGDiceRollPool::FRPGDiceRollPool(int32 InDieSize, int32 InCapacity)
+    : DieSize(InDieSize)
+    , Head(0)
+    , Tail(0)
+{
+    const uint32 RoundedCapacity = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 2)));
+    Buffer.SetNumZeroed(static_cast<int32>(RoundedCapacity));
+    Mask = RoundedCapacity - 1;
+}
+
+int32 FRPGDiceRollPool::Refill(FRPGDiceEngine& Engine)
+{
+    const uint32 CurrentTail = Tail.load(std::memory_order_relaxed);
+    const uint32 Free = static_cast<uint32>(Buffer.Num()) - (CurrentTail - Head.load(std::memory_order_acquire));
+    if (Free == 0)
+    {
+        return 0;
+    }
+
+    // Fill the free region in at most two contiguous runs
+    const uint32 Start = CurrentTail & Mask;
+    const uint32 FirstRun = FMath::Min(Free, static_cast<uint32>(Buffer.Num()) - Start);
+    Engine.RollN(static_cast<int32>(FirstRun), DieSize, Buffer.GetData() + Start);
+    if (Free > FirstRun)
+    {
+        Engine.RollN(static_cast<int32>(Free - FirstRun), DieSize, Buffer.GetData());
+    }
+
+    // Publish the new faces to the consumer
+    Tail.store(CurrentTail + Free, std::memory_order_release);
+    return static_cast<int32>(Free);
+}
+
+// Refill Worker Implementation
+FRPGDiceRollPoolWorker::FRPGDiceRollPoolWorker(const TArray<int32>& InDieSizes, int32 InCapacity, int32 InLowWatermark)
+    : Capacity(static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 2)))))
+    , LowWatermark(FMath::Clamp(InLowWatermark, 0, Capacity - 1))
+    , WorkerEngine(MakeUnique<FRPGCryptoDiceGenerator>())
+{
+    int32 MaxSize = 0;
+    for (int32 DieSize : InDieSizes)
+    {
+        MaxSize = FMath::Max(MaxSize, DieSize);
+    }
+    PoolIndexBySize.Init(INDEX_NONE, MaxSize + 1);
+
+    for (int32 DieSize : InDieSizes)
+    {
+        if (DieSize > 0 && PoolIndexBySize[DieSize] == INDEX_NONE)
+        {
+            PoolIndexBySize[DieSize] = Pools.Add(MakeUnique<FRPGDiceRollPool>(DieSize, Capacity));
+        }
+    }
+
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FRPGDiceRollPoolWorker::~FRPGDiceRollPoolWorker()
+{
+    StopThread();
+
+    if (WakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+        WakeEvent = nullptr;
+    }
+}
+
+bool FRPGDiceRollPoolWorker::StartThread()
+{
+    if (Thread)
+    {
+        return true;
+    }
+
+    bStopRequested = false;
+    Thread = FRunnableThread::Create(this, TEXT("RPGDiceRollPoolRefill"), 0, TPri_BelowNormal);
+    return Thread != nullptr;
+}
+
+void FRPGDiceRollPoolWorker::StopThread()
+{
+    if (!Thread)
+    {
+        return;
+    }
+
+    // Kill() calls Stop() and joins
+    Thread->Kill(true);
+    delete Thread;
+    Thread = nullptr;
+}
+
+bool FRPGDiceRollPoolWorker::IsPooled(int32 DieSize) const
+{
+    return PoolIndexBySize.IsValidIndex(DieSize) && PoolIndexBySize[DieSize] != INDEX_NONE;
+}
+
+bool FRPGDiceRollPoolWorker::TryPop(int32 DieSize, int32& OutFace)
+{
+    if (!IsPooled(DieSize))
+    {
+        return false;
+    }
+
+    FRPGDiceRollPool& Pool = *Pools[PoolIndexBySize[DieSize]];
+    if (!Pool.TryPop(OutFace))
+    {
+        Misses.store(Misses.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        WakeEvent->Trigger();
+        return false;
+    }
+
+    Hits.store(Hits.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    // Wake once on crossing the watermark rather than on every pop below it; the periodic top-up covers a lost race
+    if (Pool.Num() == LowWatermark - 1)
+    {
+        WakeEvent->Trigger();
+    }
+    return true;
+}
+
+FRPGDiceRollPoolWorker::FStats FRPGDiceRollPoolWorker::GetStats() const
+{
+    FStats Stats;
+    Stats.Hits = Hits.load(std::memory_order_relaxed);
+    Stats.Misses = Misses.load(std::memory_order_relaxed);
+    Stats.RefillPasses = RefillPasses.load(std::memory_order_relaxed);
+    Stats.FacesGenerated = FacesGenerated.load(std::memory_order_relaxed);
+    return Stats;
+}
+
+int32 FRPGDiceRollPoolWorker::GetPoolLevel(int32 DieSize) const
+{
+    return IsPooled(DieSize) ? Pools[PoolIndexBySize[DieSize]]->Num() : 0;
+}
+
+int32 FRPGDiceRollPoolWorker::RefillAll()
+{
+    int32 Generated = 0;
+    for (const TUniquePtr<FRPGDiceRollPool>& Pool : Pools)
+    {
+        if (bStopRequested)
+        {
+            break;
+        }
+        Generated += Pool->Refill(WorkerEngine);
+    }
+
+    if (Generated > 0)
+    {
+        RefillPasses.fetch_add(1, std::memory_order_relaxed);
+        FacesGenerated.fetch_add(Generated, std::memory_order_relaxed);
+    }
+    return Generated;
+}
+
+uint32 FRPGDiceRollPoolWorker::Run()
+{
+    // Initial fill, then sleep until the game thread signals a low pool (or a periodic top-up)
+    while (!bStopRequested)
+    {
+        RefillAll();
+        WakeEvent->Wait(FTimespan::FromMilliseconds(100.0));
+    }
+    return 0;
+}
+
+void FRPGDiceRollPoolWorker::Stop()
+{
+    bStopRequested = true;
+    if (WakeEvent)
+    {
+        WakeEvent->Trigger();
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "RPGDiceEngine.h"
+#include <atomic>
+
+class FRunnableThread;
+class FEvent;
+
+/**
+ * Single-producer/single-consumer ring of pre-rolled faces for one die size
+ * The refill worker is the only producer and the game thread the only consumer, so no locks are needed
+ */
+class SESHAT_API FRPGDiceRollPool
+{
+public:
+    /** Capacity is rounded up to a power of two */
+    FRPGDiceRollPool(int32 InDieSize, int32 InCapacity);
+
+    /** Consumer: pop one face, false if the pool is empty */
+    FORCEINLINE bool TryPop(int32& OutFace)
+    {
+        const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+        if (CurrentHead == Tail.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        OutFace = Buffer[CurrentHead & Mask];
+        Head.store(CurrentHead + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Producer: top the ring up to capacity from Engine; returns the number of faces added */
+    int32 Refill(FRPGDiceEngine& Engine);
+
+    /** Approximate number of faces available (exact from either single thread's point of view) */
+    int32 Num() const
+    {
+        return static_cast<int32>(Tail.load(std::memory_order_acquire) - Head.load(std::memory_order_acquire));
+    }
+
+    int32 GetCapacity() const { return Buffer.Num(); }
+    int32 GetDieSize() const { return DieSize; }
+
+private:
+    TArray<int32> Buffer;
+    uint32 Mask;
+    int32 DieSize;
+
+    /** Consumer index (game thread) and producer index (worker), on separate cache lines */
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> Head;
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> Tail;
+};
+
+/**
+ * Background worker that keeps one crypto-quality FRPGDiceRollPool per die size topped up
+ * The game thread pops faces and wakes the worker when a pool drops below the low watermark
+ */
+class SESHAT_API FRPGDiceRollPoolWorker : public FRunnable
+{
+public:
+    /** Counters since the worker started */
+    struct FStats
+    {
+        int64 Hits = 0;
+        int64 Misses = 0;
+        int64 RefillPasses = 0;
+        int64 FacesGenerated = 0;
+    };
+
+    FRPGDiceRollPoolWorker(const TArray<int32>& InDieSizes, int32 InCapacity, int32 InLowWatermark);
+    virtual ~FRPGDiceRollPoolWorker() override;
+
+    /** Start the refill thread */
+    bool StartThread();
+
+    /** Stop and join the refill thread (safe to call twice) */
+    void StopThread();
+
+    /**
+     * Game thread: pop a pre-rolled face for a die size
+     * @return false if the size is not pooled (not counted) or its pool is empty (counted as a miss)
+     */
+    bool TryPop(int32 DieSize, int32& OutFace);
+
+    /** Whether a die size has a pool */
+    bool IsPooled(int32 DieSize) const;
+
+    FStats GetStats() const;
+
+    /** Faces currently available for a die size (0 if not pooled) */
+    int32 GetPoolLevel(int32 DieSize) const;
+
+    int32 GetCapacity() const { return Capacity; }
+    int32 GetLowWatermark() const { return LowWatermark; }
+
+    // Begin FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+    // End FRunnable
+
+private:
+    /** Refill every pool below capacity; returns the number of faces generated */
+    int32 RefillAll();
+
+    TArray<TUniquePtr<FRPGDiceRollPool>> Pools;
+
+    /** Die size -> index into Pools, INDEX_NONE when unpooled */
+    TArray<int32> PoolIndexBySize;
+
+    int32 Capacity;
+    int32 LowWatermark;
+
+    /** Crypto engine owned by the worker thread */
+    FRPGDiceEngine WorkerEngine;
+
+    FRunnableThread* Thread = nullptr;
+    FEvent* WakeEvent = nullptr;
+    std::atomic<bool> bStopRequested{ false };
+
+    /** Written only by the consumer, so plain relaxed stores rather than locked increments */
+    std::atomic<int64> Hits{ 0 };
+    std::atomic<int64> Misses{ 0 };
+    std::atomic<int64> RefillPasses{ 0 };
+    std::atomic<int64> FacesGenerated{ 0 };
+};
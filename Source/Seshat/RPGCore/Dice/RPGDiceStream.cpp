@@ -0,0 +1,99 @@
+#include "RPGDiceStream.h"
+#include "Hash/CityHash.h"
+
+namespace
+{
+    constexpr uint32 PhiloxM0 = 0xD2511F53u;
+    constexpr uint32 PhiloxM1 = 0xCD9E8D57u;
+    constexpr uint32 PhiloxW0 = 0x9E3779B9u;
+    constexpr uint32 PhiloxW1 = 0xBB67AE85u;
+
+    FORCEINLINE void MultiplyHiLo(uint32 A, uint32 B, uint32& OutHi, uint32& OutLo)
+    {
+        const uint64 Product = static_cast<uint64>(A) * B;
+        OutHi = static_cast<uint32>(Product >> 32);
+        OutLo = static_cast<uint32>(Product);
+    }
+}
+
+FRPGDiceStream::FRPGDiceStream(uint64 InSeed, uint64 InStreamId, uint64 InPosition)
+    : SeedValue(InSeed)
+    , StreamId(InStreamId)
+    , Position(InPosition)
+    , CachedBlockIndex(0)
+    , bBlockCached(false)
+{
+}
+
+uint64 FRPGDiceStream::HashStreamName(const FName& Name)
+{
+    return DeriveStreamId(0, Name);
+}
+
+uint64 FRPGDiceStream::DeriveStreamId(uint64 ParentStreamId, const FName& ChildName)
+{
+    // FName hashes depend on name table order, so hash the lowercased text instead
+    const FString Lowered = ChildName.ToString().ToLower();
+    const FTCHARToUTF8 Utf8(*Lowered);
+    return CityHash64WithSeed(Utf8.Get(), Utf8.Length(), ParentStreamId);
+}
+
+FRPGDiceStream FRPGDiceStream::Split(const FName& ChildName) const
+{
+    return FRPGDiceStream(SeedValue, DeriveStreamId(StreamId, ChildName));
+}
+
+void FRPGDiceStream::PhiloxBlock(const uint32 Counter[4], const uint32 Key[2], uint32 Out[4])
+{
+    uint32 C0 = Counter[0];
+    uint32 C1 = Counter[1];
+    uint32 C2 = Counter[2];
+    uint32 C3 = Counter[3];
+    uint32 K0 = Key[0];
+    uint32 K1 = Key[1];
+
+    for (int32 Round = 0; Round < 10; ++Round)
+    {
+        uint32 Hi0, Lo0, Hi1, Lo1;
+        MultiplyHiLo(PhiloxM0, C0, Hi0, Lo0);
+        MultiplyHiLo(PhiloxM1, C2, Hi1, Lo1);
+
+        C0 = Hi1 ^ C1 ^ K0;
+        C1 = Lo1;
+        C2 = Hi0 ^ C3 ^ K1;
+        C3 = Lo0;
+
+        K0 += PhiloxW0;
+        K1 += PhiloxW1;
+    }
+
+    Out[0] = C0;
+    Out[1] = C1;
+    Out[2] = C2;
+    Out[3] = C3;
+}
+
+uint32 FRPGDiceStream::Next32()
+{
+    const uint64 BlockIndex = Position >> 2;
+    if (!bBlockCached || CachedBlockIndex != BlockIndex)
+    {
+        const uint32 Counter[4] = {
+            static_cast<uint32>(BlockIndex), static_cast<uint32>(BlockIndex >> 32),
+            static_cast<uint32>(StreamId), static_cast<uint32>(StreamId >> 32) };
+        const uint32 Key[2] = { static_cast<uint32>(SeedValue), static_cast<uint32>(SeedValue >> 32) };
+
+        PhiloxBlock(Counter, Key, Block);
+        CachedBlockIndex = BlockIndex;
+        bBlockCached = true;
+    }
+
+    return Block[Position++ & 3];
+}
+
+void FRPGDiceStream::Seed(uint64 InSeed)
+{
+    SeedValue = InSeed;
+    Position = 0;
+    bBlockCached = false;
+}
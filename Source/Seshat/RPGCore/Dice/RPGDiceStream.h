@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RPGDiceEngine.h"
+
+/**
+ * Counter-based Philox4x32-10 generator (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3")
+ * Every output is a pure function of (seed, stream, position), so a stream can be jumped to any
+ * position or split into independent child streams in O(1), and any roll can be recomputed later
+ * from where it started - the basis for combat-log replay, lockstep and server-side roll validation.
+ *
+ * Layout: key = seed, counter = { block index (64 bits), stream id (64 bits) }, 4 words per block
+ */
+class SESHAT_API FRPGDiceStream : public IRPGDiceGenerator
+{
+public:
+    FRPGDiceStream(uint64 InSeed, uint64 InStreamId, uint64 InPosition = 0);
+
+    /** Stable 64-bit stream id for a name (case-insensitive, identical on every machine) */
+    static uint64 HashStreamName(const FName& Name);
+
+    /** Child stream id derived from a parent id and a child name */
+    static uint64 DeriveStreamId(uint64 ParentStreamId, const FName& ChildName);
+
+    /** Independent child stream (same seed) starting at position 0 */
+    FRPGDiceStream Split(const FName& ChildName) const;
+
+    /** One Philox4x32-10 block */
+    static void PhiloxBlock(const uint32 Counter[4], const uint32 Key[2], uint32 Out[4]);
+
+    virtual uint32 Next32() override;
+
+    /** Change the seed and rewind to position 0 */
+    virtual void Seed(uint64 InSeed) override;
+
+    virtual const TCHAR* GetName() const override { return TEXT("Philox4x32-10"); }
+
+    /** Number of 32-bit words consumed so far */
+    uint64 GetPosition() const { return Position; }
+
+    /** Jump to any position in O(1) */
+    void SetPosition(uint64 InPosition) { Position = InPosition; }
+
+    /** Skip ahead by a number of 32-bit words in O(1) */
+    void Skip(uint64 NumWords) { Position += NumWords; }
+
+    uint64 GetSeed() const { return SeedValue; }
+    uint64 GetStreamId() const { return StreamId; }
+
+private:
+    uint64 SeedValue;
+    uint64 StreamId;
+    uint64 Position;
+
+    /** Last generated block and its index (avoids recomputing 4 times per block) */
+    uint32 Block[4];
+    uint64 CachedBlockIndex;
+    bool bBlockCached;
+};
@@ -15,16 +15,22 @@ ARPGEntity::ARPGEntity()
     bRegisteredWithSubsystem = false;
 }
 
-FString ARPGEntity::GetID() const
+const FString& ARPGEntity::GetID() const
 {
     return EntityID;
 }
 
-FString ARPGEntity::GetType() const
+const FString& ARPGEntity::GetType() const
 {
     return EntityType;
 }
 
+FRPGEntityId ARPGEntity::GetCompactID() const
+{
+    // Before InitializeEntity an authored ID has no compact form yet
+    return CompactID.IsValid() || EntityID.IsEmpty() ? CompactID : FRPGEntityId::FromString(EntityID);
+}
+
 bool ARPGEntity::IsValidEntity() const
 {
     return !EntityID.IsEmpty() && !EntityType.IsEmpty();
@@ -39,33 +45,30 @@ void ARPGEntity::RegisterWithSubsystem()
         return;
     }
 
-    URPGEntitySubsystem* EntitySubsystem = GetGameInstance()->GetSubsystem<URPGEntitySubsystem>();
+    URPGEntitySubsystem* EntitySubsystem = GetGameInstance() ? GetGameInstance()->GetSubsystem<URPGEntitySubsystem>() : nullptr;
     if (EntitySubsystem)
     {
-        // Use raw toolkit validation functions - no custom registration system
-        bool bValidID = EntitySubsystem->ValidateEntityID(EntityID);
-        bool bValidType = EntitySubsystem->ValidateEntityType(EntityType);
+        // The first entity of a level to begin play registers the whole level in one batch
+        EntitySubsystem->FlushPendingRegistrations();
+        
+        // Not batched (or refused): validated against the toolkit, then indexed by the subsystem's registry
+        FRPGEntityError Error;
+        if (!bInRegistry || EntitySubsystem->GetEntity(EntityHandle).GetObject() != this)
+        {
+            EntityHandle = EntitySubsystem->RegisterEntity(this, Error);
+            bInRegistry = EntityHandle.IsValid();
+        }
         
-        if (bValidID && bValidType)
+        if (bInRegistry)
         {
             bRegisteredWithSubsystem = true;
-            UE_LOG(LogTemp, Log, TEXT("ARPGEntity::RegisterWithSubsystem: Successfully validated entity %s:%s"), 
+            UE_LOG(LogTemp, Log, TEXT("ARPGEntity::RegisterWithSubsystem: Successfully registered entity %s:%s"), 
                    *EntityType, *EntityID);
         }
         else
         {
-            FString ErrorMessage;
-            if (!bValidID)
-            {
-                ErrorMessage += FString::Printf(TEXT("Invalid ID: %s. "), *EntitySubsystem->GetInvalidEntityError());
-            }
-            if (!bValidType)
-            {
-                ErrorMessage += FString::Printf(TEXT("Invalid Type: %s. "), *EntitySubsystem->GetInvalidTypeError());
-            }
-            
-            UE_LOG(LogTemp, Error, TEXT("ARPGEntity::RegisterWithSubsystem: Failed to validate entity %s:%s - %s"), 
-                   *EntityType, *EntityID, *ErrorMessage);
+            UE_LOG(LogTemp, Error, TEXT("ARPGEntity::RegisterWithSubsystem: Failed to register entity %s:%s - %s"), 
+                   *EntityType, *EntityID, *Error.GetFormattedMessage());
         }
     }
     else
@@ -74,15 +77,33 @@ void ARPGEntity::RegisterWithSubsystem()
     }
 }
 
+void ARPGEntity::OnRegisteredInBatch(FRPGEntityHandle Handle)
+{
+    EntityHandle = Handle;
+    bInRegistry = Handle.IsValid();
+}
+
 void ARPGEntity::UnregisterFromSubsystem()
 {
-    if (!bRegisteredWithSubsystem)
+    URPGEntitySubsystem* EntitySubsystem = GetGameInstance() ? GetGameInstance()->GetSubsystem<URPGEntitySubsystem>() : nullptr;
+    if (!bInRegistry)
     {
+        // Still queued from PostInitializeComponents if it never began play
+        if (EntitySubsystem)
+        {
+            EntitySubsystem->CancelEntityRegistration(this);
+        }
         return;
     }
 
-    // Swiss Army Knife Standard: No custom unregister system in toolkit
-    // Just mark as unregistered - toolkit doesn't track entity state
+    // The toolkit doesn't track entity state - only the subsystem's registry does.
+    // A batch flushed by another actor's BeginPlay may hold a slot for an actor that never began play.
+    if (EntitySubsystem)
+    {
+        EntitySubsystem->UnregisterEntity(EntityHandle);
+    }
+    EntityHandle = FRPGEntityHandle();
+    bInRegistry = false;
     bRegisteredWithSubsystem = false;
     UE_LOG(LogTemp, Log, TEXT("ARPGEntity::UnregisterFromSubsystem: Entity %s:%s marked as unregistered"), 
            *EntityType, *EntityID);
@@ -95,11 +116,12 @@ void ARPGEntity::InitializeEntity()
         return;
     }
 
-    // Generate ID if not set
+    // Generate ID if not set; the compact form is derived once here, not per lookup
     if (EntityID.IsEmpty())
     {
         EntityID = GenerateEntityID();
     }
+    CompactID = FRPGEntityId::FromString(EntityID);
 
     // Set type if not set
     if (EntityType.IsEmpty())
@@ -116,8 +138,26 @@ void ARPGEntity::InitializeEntity()
 FString ARPGEntity::GenerateEntityID() const
 {
     // Generate a unique ID using UE's GUID system
-    FGuid NewGuid = FGuid::NewGuid();
-    return NewGuid.ToString();
+    return FRPGEntityId::NewId().ToString();
+}
+
+void ARPGEntity::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+    
+    // A loading level initializes every actor's components before any of them begins play,
+    // so queueing here lets the subsystem validate the level's entities together
+    // (game worlds only - editor actors keep their IDs unset until play)
+    if (!GetWorld() || !GetWorld()->IsGameWorld())
+    {
+        return;
+    }
+    
+    InitializeEntity();
+    if (URPGEntitySubsystem* EntitySubsystem = GetGameInstance() ? GetGameInstance()->GetSubsystem<URPGEntitySubsystem>() : nullptr)
+    {
+        EntitySubsystem->QueueEntityRegistration(this);
+    }
 }
 
 void ARPGEntity::BeginPlay()
@@ -142,6 +182,14 @@ void ARPGEntity::EndPlay(const EEndPlayReason::Type EndPlayReason)
     Super::EndPlay(EndPlayReason);
 }
 
+void ARPGEntity::Destroyed()
+{
+    // EndPlay is skipped for actors destroyed before BeginPlay, which may still hold a batch-registered slot
+    UnregisterFromSubsystem();
+    
+    Super::Destroyed();
+}
+
 // URPGEntityObject implementation
 
 URPGEntityObject::URPGEntityObject()
@@ -150,16 +198,21 @@ URPGEntityObject::URPGEntityObject()
     EntityType = TEXT("");
 }
 
-FString URPGEntityObject::GetID() const
+const FString& URPGEntityObject::GetID() const
 {
     return EntityID;
 }
 
-FString URPGEntityObject::GetType() const
+const FString& URPGEntityObject::GetType() const
 {
     return EntityType;
 }
 
+FRPGEntityId URPGEntityObject::GetCompactID() const
+{
+    return CompactID.IsValid() || EntityID.IsEmpty() ? CompactID : FRPGEntityId::FromString(EntityID);
+}
+
 URPGEntityObject* URPGEntityObject::CreateEntity(UObject* Outer, const FString& EntityType, const FString& EntityID)
 {
     if (!Outer)
@@ -192,11 +245,12 @@ void URPGEntityObject::InitializeEntity(const FString& Type, const FString& ID)
     if (ID.IsEmpty())
     {
         // Generate unique ID
-        FGuid NewGuid = FGuid::NewGuid();
-        EntityID = NewGuid.ToString();
+        CompactID = FRPGEntityId::NewId();
+        EntityID = CompactID.ToString();
     }
     else
     {
         EntityID = ID;
+        CompactID = FRPGEntityId::FromString(ID);
     }
 }
\ No newline at end of file
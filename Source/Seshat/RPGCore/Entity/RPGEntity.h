@@ -22,9 +22,12 @@ class SESHAT_API IRPGEntityInterface
     GENERATED_BODY()
 
 public:
-    // C++ interface for direct access
-    virtual FString GetID() const = 0;
-    virtual FString GetType() const = 0;
+    // C++ interface for direct access - references stay valid while the entity is alive and unchanged
+    virtual const FString& GetID() const = 0;
+    virtual const FString& GetType() const = 0;
+
+    /** Compact form of GetID() for hashing and comparison - override to return a cached value */
+    virtual FRPGEntityId GetCompactID() const { return FRPGEntityId::FromString(GetID()); }
 };
 
 /**
@@ -40,8 +43,9 @@ public:
     ARPGEntity();
 
     // IRPGEntityInterface implementation
-    virtual FString GetID() const override;
-    virtual FString GetType() const override;
+    virtual const FString& GetID() const override;
+    virtual const FString& GetType() const override;
+    virtual FRPGEntityId GetCompactID() const override;
 
     // Blueprint-accessible versions
     UFUNCTION(BlueprintCallable, Category = "RPG Entity")
@@ -50,6 +54,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "RPG Entity")
     FString GetEntityType() const { return GetType(); }
 
+    UFUNCTION(BlueprintCallable, Category = "RPG Entity")
+    FRPGEntityId GetEntityCompactID() const { return GetCompactID(); }
+
     // Entity lifecycle
     UFUNCTION(BlueprintCallable, Category = "RPG Entity")
     bool IsValidEntity() const;
@@ -60,6 +67,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "RPG Entity")
     void UnregisterFromSubsystem();
 
+    /** Registry handle while registered with URPGEntitySubsystem, invalid otherwise */
+    UFUNCTION(BlueprintCallable, Category = "RPG Entity")
+    FRPGEntityHandle GetEntityHandle() const { return EntityHandle; }
+
+    /** Called by URPGEntitySubsystem::FlushPendingRegistrations when a batch took a registry slot for this actor */
+    void OnRegisteredInBatch(FRPGEntityHandle Handle);
+
 protected:
     // Called when entity is first created to set up ID/Type
     virtual void InitializeEntity();
@@ -67,12 +81,14 @@ protected:
     // Override in subclasses to provide specific entity types
     virtual FString GetDefaultEntityType() const { return TEXT("entity"); }
 
-    // Override in subclasses to provide custom ID generation
+    // Override in subclasses to provide custom ID generation (converted to CompactID once, at initialization)
     virtual FString GenerateEntityID() const;
 
     // UE Actor lifecycle integration
+    virtual void PostInitializeComponents() override;
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void Destroyed() override;
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "RPG Entity", 
               meta = (ToolTip = "Unique identifier for this entity"))
@@ -82,9 +98,18 @@ protected:
               meta = (ToolTip = "Entity type categorization"))
     FString EntityType;
 
+    /** EntityID in compact form, set by InitializeEntity */
+    UPROPERTY(Transient)
+    FRPGEntityId CompactID;
+
 private:
     bool bEntityInitialized = false;
+    /** RegisterWithSubsystem succeeded (BeginPlay ran) */
     bool bRegisteredWithSubsystem = false;
+
+    /** EntityHandle holds a registry slot - set by a batch flush even if this actor never begins play */
+    bool bInRegistry = false;
+    FRPGEntityHandle EntityHandle;
 };
 
 /**
@@ -100,8 +125,9 @@ public:
     URPGEntityObject();
 
     // IRPGEntityInterface implementation
-    virtual FString GetID() const override;
-    virtual FString GetType() const override;
+    virtual const FString& GetID() const override;
+    virtual const FString& GetType() const override;
+    virtual FRPGEntityId GetCompactID() const override;
 
     // Blueprint-accessible versions
     UFUNCTION(BlueprintCallable, Category = "RPG Entity")
@@ -110,6 +136,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "RPG Entity")
     FString GetEntityType() const { return GetType(); }
 
+    UFUNCTION(BlueprintCallable, Category = "RPG Entity")
+    FRPGEntityId GetEntityCompactID() const { return GetCompactID(); }
+
     // Factory method for creating entities
     UFUNCTION(BlueprintCallable, Category = "RPG Entity", CallInEditor)
     static URPGEntityObject* CreateEntity(UObject* Outer, const FString& EntityType, 
@@ -123,4 +152,8 @@ protected:
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "RPG Entity")
     FString EntityType;
+
+    /** EntityID in compact form, set by InitializeEntity */
+    UPROPERTY(Transient)
+    FRPGEntityId CompactID;
 };
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "RPGEntityRegistry.h"
+
+FRPGEntityHandle FRPGEntityRegistry::Register(UObject* Object, FRPGEntityId ID, FName Type, ERPGEntityError* OutError)
+{
+    if (!ID.IsValid())
+    {
+        if (OutError)
+        {
+            *OutError = ERPGEntityError::EmptyID;
+        }
+        return FRPGEntityHandle();
+    }
+
+    const uint32 IDHash = GetTypeHash(ID);
+    if (SlotsByID.FindByHash(IDHash, ID))
+    {
+        if (OutError)
+        {
+            *OutError = ERPGEntityError::Duplicate;
+        }
+        return FRPGEntityHandle();
+    }
+
+    uint32 Slot;
+    if (FreeSlots.Num() > 0)
+    {
+        Slot = FreeSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        Slot = static_cast<uint32>(SlotGenerations.Add(1));
+        SlotDenseIndices.Add(INDEX_NONE);
+    }
+
+    const int32 DenseIndex = IDs.Add(ID);
+    Types.Add(Type);
+    Objects.Add(Object);
+    DenseSlots.Add(Slot);
+
+    SlotDenseIndices[Slot] = DenseIndex;
+    SlotsByID.AddByHash(IDHash, ID, Slot);
+
+    if (OutError)
+    {
+        *OutError = ERPGEntityError::None;
+    }
+    return FRPGEntityHandle(Slot, SlotGenerations[Slot]);
+}
+
+bool FRPGEntityRegistry::Unregister(FRPGEntityHandle Handle)
+{
+    const int32 DenseIndex = FindDenseIndex(Handle);
+    if (DenseIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const uint32 Slot = Handle.GetSlot();
+    SlotsByID.Remove(IDs[DenseIndex]);
+
+    // Fill the hole with the last entity and repoint its slot
+    const int32 LastIndex = IDs.Num() - 1;
+    if (DenseIndex != LastIndex)
+    {
+        SlotDenseIndices[DenseSlots[LastIndex]] = DenseIndex;
+    }
+    IDs.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    Types.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    Objects.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+    DenseSlots.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+
+    // Bumping the generation invalidates every outstanding handle to this slot
+    SlotDenseIndices[Slot] = INDEX_NONE;
+    ++SlotGenerations[Slot];
+    if (SlotGenerations[Slot] == 0)
+    {
+        SlotGenerations[Slot] = 1;
+    }
+    FreeSlots.Add(Slot);
+    return true;
+}
+
+FRPGEntityHandle FRPGEntityRegistry::Find(FRPGEntityId ID) const
+{
+    const uint32* Slot = SlotsByID.Find(ID);
+    return Slot ? FRPGEntityHandle(*Slot, SlotGenerations[*Slot]) : FRPGEntityHandle();
+}
+
+UObject* FRPGEntityRegistry::GetObject(FRPGEntityHandle Handle) const
+{
+    const int32 DenseIndex = FindDenseIndex(Handle);
+    return DenseIndex != INDEX_NONE ? Objects[DenseIndex].Get() : nullptr;
+}
+
+FRPGEntityId FRPGEntityRegistry::GetID(FRPGEntityHandle Handle) const
+{
+    const int32 DenseIndex = FindDenseIndex(Handle);
+    return DenseIndex != INDEX_NONE ? IDs[DenseIndex] : FRPGEntityId();
+}
+
+FName FRPGEntityRegistry::GetType(FRPGEntityHandle Handle) const
+{
+    const int32 DenseIndex = FindDenseIndex(Handle);
+    return DenseIndex != INDEX_NONE ? Types[DenseIndex] : NAME_None;
+}
+
+FRPGEntityHandle FRPGEntityRegistry::GetHandleAt(int32 DenseIndex) const
+{
+    if (!DenseSlots.IsValidIndex(DenseIndex))
+    {
+        return FRPGEntityHandle();
+    }
+
+    const uint32 Slot = DenseSlots[DenseIndex];
+    return FRPGEntityHandle(Slot, SlotGenerations[Slot]);
+}
+
+void FRPGEntityRegistry::Reserve(int32 NumEntities)
+{
+    IDs.Reserve(NumEntities);
+    Types.Reserve(NumEntities);
+    Objects.Reserve(NumEntities);
+    DenseSlots.Reserve(NumEntities);
+    SlotGenerations.Reserve(NumEntities);
+    SlotDenseIndices.Reserve(NumEntities);
+    SlotsByID.Reserve(NumEntities);
+}
+
+void FRPGEntityRegistry::Reset()
+{
+    // Retire every live slot so handles stay stale after the slots are reused
+    for (const uint32 Slot : DenseSlots)
+    {
+        SlotDenseIndices[Slot] = INDEX_NONE;
+        ++SlotGenerations[Slot];
+        if (SlotGenerations[Slot] == 0)
+        {
+            SlotGenerations[Slot] = 1;
+        }
+        FreeSlots.Add(Slot);
+    }
+
+    IDs.Reset();
+    Types.Reset();
+    Objects.Reset();
+    DenseSlots.Reset();
+    SlotsByID.Reset();
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "../RPGCoreTypes.h"
+
+/**
+ * Dense registry of live entities, addressed by generational handle or by entity ID
+ * Entity data is stored structure-of-arrays in dense order (holes are filled by swap-remove), so passes
+ * over every entity walk contiguous arrays. A handle names a slot; the slot maps to the entity's dense
+ * index and carries a generation that is bumped on unregister, so handle lookups are O(1) and a stale
+ * handle can never reach an entity that reused its slot.
+ *
+ * IDs are compact FRPGEntityIds, so the ID index hashes 16 bytes rather than strings. Game thread only.
+ */
+class SESHAT_API FRPGEntityRegistry
+{
+public:
+    /**
+     * Add an entity
+     * @param OutError EmptyID or Duplicate when the entity was refused
+     * @return Invalid handle if ID is invalid or already registered
+     */
+    FRPGEntityHandle Register(UObject* Object, FRPGEntityId ID, FName Type, ERPGEntityError* OutError = nullptr);
+
+    /** Remove an entity; false if the handle is stale or invalid */
+    bool Unregister(FRPGEntityHandle Handle);
+
+    /** Whether Handle still refers to a registered entity */
+    bool IsValid(FRPGEntityHandle Handle) const { return FindDenseIndex(Handle) != INDEX_NONE; }
+
+    /** Handle for an entity ID, invalid if it is not registered */
+    FRPGEntityHandle Find(FRPGEntityId ID) const;
+
+    /** Handle for a toolkit ID string - converts without interning, so unknown strings cost no memory */
+    FRPGEntityHandle Find(FStringView ID) const { return Find(FRPGEntityId::Find(ID)); }
+
+    /** Registered object, null if the handle is stale or the object was destroyed */
+    UObject* GetObject(FRPGEntityHandle Handle) const;
+
+    /** Registered ID, invalid if the handle is stale */
+    FRPGEntityId GetID(FRPGEntityHandle Handle) const;
+
+    /** Registered type, None if the handle is stale */
+    FName GetType(FRPGEntityHandle Handle) const;
+
+    int32 Num() const { return IDs.Num(); }
+
+    /** Index-aligned dense columns, invalidated by Register/Unregister */
+    TConstArrayView<FRPGEntityId> GetIDs() const { return IDs; }
+    TConstArrayView<FName> GetTypes() const { return Types; }
+    TConstArrayView<TWeakObjectPtr<UObject>> GetObjects() const { return Objects; }
+
+    /** Handle of the entity at a dense index */
+    FRPGEntityHandle GetHandleAt(int32 DenseIndex) const;
+
+    void Reserve(int32 NumEntities);
+
+    /** Remove every entity; outstanding handles become stale */
+    void Reset();
+
+private:
+    int32 FindDenseIndex(FRPGEntityHandle Handle) const
+    {
+        const uint32 Slot = Handle.GetSlot();
+        return Handle.IsValid() && Slot < static_cast<uint32>(SlotGenerations.Num()) && SlotGenerations[Slot] == Handle.GetGeneration()
+            ? SlotDenseIndices[Slot] : INDEX_NONE;
+    }
+
+    // Dense columns, one element per registered entity
+    TArray<FRPGEntityId> IDs;
+    TArray<FName> Types;
+    TArray<TWeakObjectPtr<UObject>> Objects;
+    TArray<uint32> DenseSlots;
+
+    // Sparse slots, indexed by handle slot
+    TArray<uint32> SlotGenerations;
+    TArray<int32> SlotDenseIndices;
+    TArray<uint32> FreeSlots;
+
+    TMap<FRPGEntityId, uint32> SlotsByID;
+};
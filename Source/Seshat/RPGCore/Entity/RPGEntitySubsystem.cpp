@@ -1,6 +1,51 @@
 #include "RPGEntitySubsystem.h"
 #include "../../Seshat.h"
-#include "Misc/Paths.h"
+#include "../Toolkit/RPGToolkitModule.h"
+#include "RPGEntityRegistry.h"
+#include "../Spatial/RPGSpatialIndex.h"
+#include "../Events/RPGEventBusSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Guid.h"
+#include "../RPGBenchCommands.h"
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchEntityRegistryCommand(
+        TEXT("rpg.Bench.EntityRegistry"),
+        TEXT("rpg.Bench.EntityRegistry [SmallCount=10000] [LargeCount=100000] - entity registry against a GUID-keyed TMap"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEntitySubsystem* Entities = RPGBench::FindSubsystem<URPGEntitySubsystem>(World, Ar))
+            {
+                Ar.Log(Entities->BenchmarkEntityRegistry(RPGBench::IntArg(Args, 0, 10000), RPGBench::IntArg(Args, 1, 100000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchEntityValidationCommand(
+        TEXT("rpg.Bench.EntityValidation"),
+        TEXT("rpg.Bench.EntityValidation [NumEntities=5000] - per-entity ID and type validation calls against one batch call"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEntitySubsystem* Entities = RPGBench::FindSubsystem<URPGEntitySubsystem>(World, Ar))
+            {
+                Ar.Log(Entities->BenchmarkEntityValidation(RPGBench::IntArg(Args, 0, 5000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchSpatialQueriesCommand(
+        TEXT("rpg.Bench.SpatialQueries"),
+        TEXT("rpg.Bench.SpatialQueries [NumEntities=5000] [MapSize=512] [NumQueries=10000] [Radius=6] - spatial index placement, moves and area queries on square and hex grids"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEntitySubsystem* Entities = RPGBench::FindSubsystem<URPGEntitySubsystem>(World, Ar))
+            {
+                Ar.Log(Entities->BenchmarkSpatialQueries(RPGBench::IntArg(Args, 0, 5000), RPGBench::IntArg(Args, 1, 512), RPGBench::IntArg(Args, 2, 10000), RPGBench::IntArg(Args, 3, 6)));
+            }
+        }));
+}
+#endif
 
 void URPGEntitySubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -8,8 +53,21 @@ void URPGEntitySubsystem::Initialize(FSubsystemCollectionBase& Collection)
     
     UE_LOG(LogTemp, Warning, TEXT("URPGEntitySubsystem: Initializing"));
     
-    // Initialize toolkit integration
-    LoadDLLFunctions();
+    bFunctionsLoaded = false;
+    Toolkit = nullptr;
+    Registry = MakeShared<FRPGEntityRegistry>();
+    SpatialIndex = MakeShared<FRPGSpatialIndex>();
+    SpatialCellSize = 100.0f;
+    
+    // Borrow the shared toolkit function table
+    BindToolkitFunctions();
+    
+    // Keep the spatial index current as entities move (ahead of gameplay handlers that query it)
+    EventBus = Collection.InitializeDependency<URPGEventBusSubsystem>();
+    if (URPGEventBusSubsystem* Bus = EventBus.Get())
+    {
+        EntityMovedSubscription = Bus->SubscribeHandler(ERPGEventType::EntityMoved, TScriptInterface<IRPGEventInterface>(this), ERPGEventPriority::Critical);
+    }
     
     UE_LOG(LogTemp, Warning, TEXT("URPGEntitySubsystem: Successfully initialized"));
 }
@@ -18,192 +76,784 @@ void URPGEntitySubsystem::Deinitialize()
 {
     UE_LOG(LogTemp, Warning, TEXT("URPGEntitySubsystem: Deinitializing"));
     
-    // Clear function pointers (don't unload DLL - let Windows handle cleanup)
-    GetEntityNotFoundErrorFuncPtr = nullptr;
-    GetInvalidEntityErrorFuncPtr = nullptr;
-    GetDuplicateEntityErrorFuncPtr = nullptr;
-    GetNilEntityErrorFuncPtr = nullptr;
-    GetEmptyIDErrorFuncPtr = nullptr;
-    GetInvalidTypeErrorFuncPtr = nullptr;
-    ValidateEntityIDFuncPtr = nullptr;
-    ValidateEntityTypeFuncPtr = nullptr;
-    FreeStringFuncPtr = nullptr;
-    CreateEntityErrorCompleteFuncPtr = nullptr;
+    // Return the shared function table (the module keeps the DLL mapped)
+    if (Toolkit)
+    {
+        FRPGToolkitModule::Release(TEXT("URPGEntitySubsystem"));
+    }
+    
     bFunctionsLoaded = false;
-    ToolkitDLLHandle = nullptr;
+    Toolkit = nullptr;
+    PendingRegistrations.Reset();
+    
+    if (URPGEventBusSubsystem* Bus = EventBus.Get())
+    {
+        Bus->UnsubscribeHandler(EntityMovedSubscription);
+    }
+    EventBus.Reset();
+    EntityMovedSubscription = FRPGEventHandle();
+    SpatialIndex.Reset();
+    
+    if (Registry.IsValid() && Registry->Num() > 0)
+    {
+        UE_LOG(LogTemp, Log, TEXT("URPGEntitySubsystem: Releasing %d registered entities"), Registry->Num());
+    }
+    Registry.Reset();
     
     Super::Deinitialize();
 }
 
-// Core Error Constants Implementation
+// Core Error Constants Implementation - read from the module's constant table
 FString URPGEntitySubsystem::GetEntityNotFoundError() const
 {
-    if (!IsSafeToCallFunction() || !GetEntityNotFoundErrorFuncPtr)
+    return FRPGToolkitModule::GetConstants().EntityNotFoundError.String;
+}
+
+FString URPGEntitySubsystem::GetInvalidEntityError() const
+{
+    return FRPGToolkitModule::GetConstants().InvalidEntityError.String;
+}
+
+FString URPGEntitySubsystem::GetDuplicateEntityError() const
+{
+    return FRPGToolkitModule::GetConstants().DuplicateEntityError.String;
+}
+
+FString URPGEntitySubsystem::GetNilEntityError() const
+{
+    return FRPGToolkitModule::GetConstants().NilEntityError.String;
+}
+
+FString URPGEntitySubsystem::GetEmptyIDError() const
+{
+    return FRPGToolkitModule::GetConstants().EmptyIDError.String;
+}
+
+FString URPGEntitySubsystem::GetInvalidTypeError() const
+{
+    return FRPGToolkitModule::GetConstants().InvalidTypeError.String;
+}
+
+// Entity Validation Implementation
+bool URPGEntitySubsystem::ValidateEntityID(const FString& ID) const
+{
+    if (!IsSafeToCallFunction() || !Toolkit->ValidateEntityID)
     {
-        return TEXT("Entity not found");
+        return !ID.IsEmpty(); // Basic fallback validation
     }
     
-    ANSICHAR* CStr = GetEntityNotFoundErrorFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Toolkit->ValidateEntityID(TCHAR_TO_ANSI(*ID)) != 0;
 }
 
-FString URPGEntitySubsystem::GetInvalidEntityError() const
+bool URPGEntitySubsystem::ValidateEntityType(const FString& Type) const
 {
-    if (!IsSafeToCallFunction() || !GetInvalidEntityErrorFuncPtr)
+    if (!IsSafeToCallFunction() || !Toolkit->ValidateEntityType)
     {
-        return TEXT("Invalid entity");
+        return !Type.IsEmpty(); // Basic fallback validation
     }
     
-    ANSICHAR* CStr = GetInvalidEntityErrorFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Toolkit->ValidateEntityType(TCHAR_TO_ANSI(*Type)) != 0;
 }
 
-FString URPGEntitySubsystem::GetDuplicateEntityError() const
+int32 URPGEntitySubsystem::ValidateEntitiesBatch(const FRPGEntityViewPacked* Entities, int32 NumEntities, uint64* OutMask) const
 {
-    if (!IsSafeToCallFunction() || !GetDuplicateEntityErrorFuncPtr)
+    if (!Entities || !OutMask || NumEntities <= 0)
     {
-        return TEXT("Duplicate entity");
+        return 0;
     }
     
-    ANSICHAR* CStr = GetDuplicateEntityErrorFuncPtr();
-    return ConvertAndFreeString(CStr);
+    if (IsSafeToCallFunction() && Toolkit->ValidateEntitiesBatch)
+    {
+        return Toolkit->ValidateEntitiesBatch(Entities, NumEntities, OutMask);
+    }
+    
+    // Toolkit without the batch export: per-entity calls (the views aren't null-terminated, so copy them out)
+    FMemory::Memzero(OutMask, RPGEntityBatchBits::NumWords(NumEntities) * sizeof(uint64));
+    int32 NumValid = 0;
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        const FRPGEntityViewPacked& View = Entities[Index];
+        const FString ID = View.IDLen > 0 ? FString(FUTF8ToTCHAR(View.ID, View.IDLen)) : FString();
+        const FString Type = View.TypeLen > 0 ? FString(FUTF8ToTCHAR(View.Type, View.TypeLen)) : FString();
+        
+        uint64 Bits = 0;
+        Bits |= ValidateEntityID(ID) ? RPGEntityBatchBits::ValidID : 0;
+        Bits |= ValidateEntityType(Type) ? RPGEntityBatchBits::ValidType : 0;
+        NumValid += Bits == (RPGEntityBatchBits::ValidID | RPGEntityBatchBits::ValidType) ? 1 : 0;
+        OutMask[Index / RPGEntityBatchBits::EntitiesPerWord] |= Bits << (RPGEntityBatchBits::BitsPerEntity * (Index % RPGEntityBatchBits::EntitiesPerWord));
+    }
+    return NumValid;
 }
 
-FString URPGEntitySubsystem::GetNilEntityError() const
+// Toolkit Status
+bool URPGEntitySubsystem::IsToolkitLoaded() const
+{
+    return bFunctionsLoaded;
+}
+
+// Entity Registry Implementation
+FRPGEntityHandle URPGEntitySubsystem::RegisterEntity(TScriptInterface<IRPGEntityInterface> Entity, FRPGEntityError& OutError)
 {
-    if (!IsSafeToCallFunction() || !GetNilEntityErrorFuncPtr)
+    // A batch of one still saves a toolkit call over validating the ID and type separately
+    FRPGEntityHandle Handle;
+    RegisterBatch(Registry.Get(), MakeArrayView(&Entity, 1), MakeArrayView(&Handle, 1), MakeArrayView(&OutError, 1));
+    return Handle;
+}
+
+TArray<FRPGEntityHandle> URPGEntitySubsystem::RegisterEntities(const TArray<TScriptInterface<IRPGEntityInterface>>& Entities, TArray<FRPGEntityError>& OutErrors)
+{
+    TArray<FRPGEntityHandle> Handles;
+    Handles.SetNum(Entities.Num());
+    OutErrors.SetNum(Entities.Num());
+    RegisterBatch(Registry.Get(), Entities, Handles, OutErrors);
+    return Handles;
+}
+
+void URPGEntitySubsystem::QueueEntityRegistration(UObject* Entity)
+{
+    if (Entity && Entity->Implements<URPGEntityInterface>())
     {
-        return TEXT("Nil entity");
+        PendingRegistrations.Add(Entity);
     }
-    
-    ANSICHAR* CStr = GetNilEntityErrorFuncPtr();
-    return ConvertAndFreeString(CStr);
 }
 
-FString URPGEntitySubsystem::GetEmptyIDError() const
+void URPGEntitySubsystem::CancelEntityRegistration(UObject* Entity)
+{
+    PendingRegistrations.RemoveSingleSwap(Entity, EAllowShrinking::No);
+}
+
+int32 URPGEntitySubsystem::FlushPendingRegistrations()
 {
-    if (!IsSafeToCallFunction() || !GetEmptyIDErrorFuncPtr)
+    if (PendingRegistrations.Num() == 0)
+    {
+        return 0;
+    }
+    
+    TArray<TScriptInterface<IRPGEntityInterface>> Entities;
+    Entities.Reserve(PendingRegistrations.Num());
+    for (const TWeakObjectPtr<UObject>& Pending : PendingRegistrations)
+    {
+        if (UObject* Object = Pending.Get())
+        {
+            Entities.Add(TScriptInterface<IRPGEntityInterface>(Object));
+        }
+    }
+    PendingRegistrations.Reset();
+    
+    const double Start = FPlatformTime::Seconds();
+    TArray<FRPGEntityError> Errors;
+    const TArray<FRPGEntityHandle> Handles = RegisterEntities(Entities, Errors);
+    
+    int32 NumRegistered = 0;
+    for (int32 Index = 0; Index < Handles.Num(); ++Index)
     {
-        return TEXT("Empty entity ID");
+        if (!Handles[Index].IsValid())
+        {
+            continue;
+        }
+        
+        ++NumRegistered;
+        
+        // Actors own their slot from here on, even if they are destroyed before their BeginPlay
+        if (ARPGEntity* Actor = Cast<ARPGEntity>(Entities[Index].GetObject()))
+        {
+            Actor->OnRegisteredInBatch(Handles[Index]);
+        }
     }
     
-    ANSICHAR* CStr = GetEmptyIDErrorFuncPtr();
-    return ConvertAndFreeString(CStr);
+    // Refused entities report their own error when they retry from BeginPlay
+    UE_LOG(LogTemp, Log, TEXT("URPGEntitySubsystem: Registered %d/%d queued entities in %.3f ms"),
+           NumRegistered, Entities.Num(), (FPlatformTime::Seconds() - Start) * 1000.0);
+    return NumRegistered;
 }
 
-FString URPGEntitySubsystem::GetInvalidTypeError() const
+bool URPGEntitySubsystem::UnregisterEntity(FRPGEntityHandle Handle)
 {
-    if (!IsSafeToCallFunction() || !GetInvalidTypeErrorFuncPtr)
+    if (SpatialIndex.IsValid())
     {
-        return TEXT("Invalid entity type");
+        SpatialIndex->Remove(Handle);
+    }
+    return Registry.IsValid() && Registry->Unregister(Handle);
+}
+
+bool URPGEntitySubsystem::IsEntityRegistered(FRPGEntityHandle Handle) const
+{
+    return Registry.IsValid() && Registry->IsValid(Handle);
+}
+
+FRPGEntityHandle URPGEntitySubsystem::FindEntityHandle(const FString& EntityID) const
+{
+    return Registry.IsValid() ? Registry->Find(FStringView(EntityID)) : FRPGEntityHandle();
+}
+
+FRPGEntityHandle URPGEntitySubsystem::FindEntityHandleByCompactID(FRPGEntityId EntityID) const
+{
+    return Registry.IsValid() ? Registry->Find(EntityID) : FRPGEntityHandle();
+}
+
+TScriptInterface<IRPGEntityInterface> URPGEntitySubsystem::GetEntity(FRPGEntityHandle Handle) const
+{
+    return TScriptInterface<IRPGEntityInterface>(Registry.IsValid() ? Registry->GetObject(Handle) : nullptr);
+}
+
+TScriptInterface<IRPGEntityInterface> URPGEntitySubsystem::FindEntity(const FString& EntityID) const
+{
+    return GetEntity(FindEntityHandle(EntityID));
+}
+
+int32 URPGEntitySubsystem::GetNumRegisteredEntities() const
+{
+    return Registry.IsValid() ? Registry->Num() : 0;
+}
+
+#if !UE_BUILD_SHIPPING
+FString URPGEntitySubsystem::BenchmarkEntityRegistry(int32 SmallCount, int32 LargeCount)
+{
+    if (SmallCount <= 0 || LargeCount <= 0)
+    {
+        return TEXT("BenchmarkEntityRegistry: invalid entity count");
     }
     
-    ANSICHAR* CStr = GetInvalidTypeErrorFuncPtr();
-    return ConvertAndFreeString(CStr);
+    auto RunSize = [this](int32 NumEntities) -> FString
+    {
+        // GUID IDs in both forms; every entry points at this subsystem so no objects are created
+        TArray<FRPGEntityId> CompactIDs;
+        TArray<FString> IDs;
+        CompactIDs.Reserve(NumEntities);
+        IDs.Reserve(NumEntities);
+        for (int32 Index = 0; Index < NumEntities; ++Index)
+        {
+            IDs.Add(CompactIDs.Add_GetRef(FRPGEntityId::NewId()).ToString());
+        }
+        const FName Type(TEXT("creature"));
+        
+        // Lookups in a shuffled order so neither container gets a sequential walk for free
+        TArray<int32> Order;
+        Order.SetNumUninitialized(NumEntities);
+        for (int32 Index = 0; Index < NumEntities; ++Index)
+        {
+            Order[Index] = Index;
+        }
+        FRandomStream Stream(12345);
+        for (int32 Index = NumEntities - 1; Index > 0; --Index)
+        {
+            Order.Swap(Index, Stream.RandRange(0, Index));
+        }
+        
+        FRPGEntityRegistry TestRegistry;
+        TArray<FRPGEntityHandle> Handles;
+        Handles.Reserve(NumEntities);
+        
+        double Start = FPlatformTime::Seconds();
+        for (const FRPGEntityId& ID : CompactIDs)
+        {
+            Handles.Add(TestRegistry.Register(this, ID, Type));
+        }
+        const double RegisterSeconds = FPlatformTime::Seconds() - Start;
+        
+        int32 Found = 0;
+        Start = FPlatformTime::Seconds();
+        for (int32 Index : Order)
+        {
+            Found += TestRegistry.GetObject(Handles[Index]) != nullptr ? 1 : 0;
+        }
+        const double HandleSeconds = FPlatformTime::Seconds() - Start;
+        
+        Start = FPlatformTime::Seconds();
+        for (int32 Index : Order)
+        {
+            Found += TestRegistry.Find(CompactIDs[Index]).IsValid() ? 1 : 0;
+        }
+        const double IDSeconds = FPlatformTime::Seconds() - Start;
+        
+        Start = FPlatformTime::Seconds();
+        for (int32 Index : Order)
+        {
+            Found += TestRegistry.Find(FStringView(IDs[Index])).IsValid() ? 1 : 0;
+        }
+        const double StringSeconds = FPlatformTime::Seconds() - Start;
+        
+        Start = FPlatformTime::Seconds();
+        for (FRPGEntityHandle Handle : Handles)
+        {
+            TestRegistry.Unregister(Handle);
+        }
+        const double UnregisterSeconds = FPlatformTime::Seconds() - Start;
+        
+        // Baseline: a per-system map from GUID string to object
+        TMap<FString, TWeakObjectPtr<UObject>> Map;
+        Start = FPlatformTime::Seconds();
+        for (const FString& ID : IDs)
+        {
+            Map.Add(ID, this);
+        }
+        const double MapInsertSeconds = FPlatformTime::Seconds() - Start;
+        
+        Start = FPlatformTime::Seconds();
+        for (int32 Index : Order)
+        {
+            const TWeakObjectPtr<UObject>* Object = Map.Find(IDs[Index]);
+            Found += Object && Object->Get() ? 1 : 0;
+        }
+        const double MapFindSeconds = FPlatformTime::Seconds() - Start;
+        
+        const double PerEntity = 1e9 / NumEntities;
+        return FString::Printf(TEXT("%d entities | register %.1f ns, by handle %.1f ns, by ID %.1f ns, by ID string %.1f ns, unregister %.1f ns | TMap<FString> insert %.1f ns, find %.1f ns | %.1fx by handle | Found %d/%d"),
+            NumEntities,
+            RegisterSeconds * PerEntity, HandleSeconds * PerEntity, IDSeconds * PerEntity, StringSeconds * PerEntity, UnregisterSeconds * PerEntity,
+            MapInsertSeconds * PerEntity, MapFindSeconds * PerEntity,
+            HandleSeconds > 0.0 ? MapFindSeconds / HandleSeconds : 0.0,
+            Found, NumEntities * 4);
+    };
+    
+    const FString Summary = RunSize(SmallCount) + TEXT("\n") + RunSize(LargeCount);
+    UE_LOG(LogTemp, Log, TEXT("URPGEntitySubsystem::BenchmarkEntityRegistry:\n%s"), *Summary);
+    return Summary;
 }
 
-// Entity Validation Implementation
-bool URPGEntitySubsystem::ValidateEntityID(const FString& ID) const
+FString URPGEntitySubsystem::BenchmarkEntityValidation(int32 NumEntities)
 {
-    if (!IsSafeToCallFunction() || !ValidateEntityIDFuncPtr)
+    if (NumEntities <= 0)
     {
-        return !ID.IsEmpty(); // Basic fallback validation
+        return TEXT("BenchmarkEntityValidation: NumEntities must be positive");
+    }
+    
+    // Stand-in for a streamed level's entities, with generated GUID IDs so nothing is added to the intern table
+    TArray<TScriptInterface<IRPGEntityInterface>> Entities;
+    Entities.Reserve(NumEntities);
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        Entities.Add(URPGEntityObject::CreateEntity(this, TEXT("creature")));
+    }
+    
+    // Private registry, so live entities are untouched and their IDs cannot collide with the stand-ins
+    FRPGEntityRegistry BenchRegistry;
+    auto UnregisterAll = [&BenchRegistry](TConstArrayView<FRPGEntityHandle> Handles)
+    {
+        for (const FRPGEntityHandle& Handle : Handles)
+        {
+            BenchRegistry.Unregister(Handle);
+        }
+    };
+    
+    // Before: two toolkit calls (and two TCHAR_TO_ANSI conversions) per entity
+    TArray<FRPGEntityHandle> Handles;
+    Handles.Reserve(NumEntities);
+    double Start = FPlatformTime::Seconds();
+    for (const TScriptInterface<IRPGEntityInterface>& Entity : Entities)
+    {
+        if (ValidateEntityID(Entity->GetID()) && ValidateEntityType(Entity->GetType()))
+        {
+            Handles.Add(BenchRegistry.Register(Entity.GetObject(), Entity->GetCompactID(), FName(*Entity->GetType())));
+        }
+    }
+    const double SingleSeconds = FPlatformTime::Seconds() - Start;
+    const int32 SingleRegistered = Handles.Num();
+    UnregisterAll(Handles);
+    
+    // After: one toolkit call for the whole level
+    TArray<FRPGEntityError> Errors;
+    Handles.SetNum(NumEntities);
+    Errors.SetNum(NumEntities);
+    Start = FPlatformTime::Seconds();
+    RegisterBatch(&BenchRegistry, Entities, Handles, Errors);
+    const double BatchSeconds = FPlatformTime::Seconds() - Start;
+    int32 BatchRegistered = 0;
+    for (const FRPGEntityHandle& Handle : Handles)
+    {
+        BatchRegistered += Handle.IsValid() ? 1 : 0;
     }
+    UnregisterAll(Handles);
+    
+    const bool bBatchExport = IsSafeToCallFunction() && Toolkit->ValidateEntitiesBatch;
+    FString Summary = FString::Printf(TEXT("%d entities%s | per-entity: %.3f ms, %d toolkit calls | batch: %.3f ms, %d toolkit call%s | %.1fx | registered %d per-entity, %d batched"),
+        NumEntities,
+        IsSafeToCallFunction() ? TEXT("") : TEXT(" (toolkit not loaded - fallback validation only)"),
+        SingleSeconds * 1000.0, IsSafeToCallFunction() ? NumEntities * 2 : 0,
+        BatchSeconds * 1000.0, bBatchExport ? 1 : (IsSafeToCallFunction() ? NumEntities * 2 : 0), bBatchExport ? TEXT("") : TEXT("s"),
+        BatchSeconds > 0.0 ? SingleSeconds / BatchSeconds : 0.0,
+        SingleRegistered, BatchRegistered);
     
-    return ValidateEntityIDFuncPtr(TCHAR_TO_ANSI(*ID)) != 0;
+    UE_LOG(LogTemp, Log, TEXT("URPGEntitySubsystem::BenchmarkEntityValidation: %s"), *Summary);
+    return Summary;
 }
+#endif
 
-bool URPGEntitySubsystem::ValidateEntityType(const FString& Type) const
+// Private Implementation
+
+// Spatial Index Implementation
+ERPGEventResult URPGEntitySubsystem::HandleEvent(const FRPGEventContext& EventContext)
 {
-    if (!IsSafeToCallFunction() || !ValidateEntityTypeFuncPtr)
+    if (EventContext.EventType != ERPGEventType::EntityMoved || !Registry.IsValid() || !SpatialIndex.IsValid())
     {
-        return !Type.IsEmpty(); // Basic fallback validation
+        return ERPGEventResult::Unhandled;
+    }
+    
+    // Native events carry the entity, toolkit events only its ID
+    const FRPGEntityHandle Handle = EventContext.SourceEntity.GetInterface()
+        ? Registry->Find(EventContext.SourceEntity->GetCompactID())
+        : Registry->Find(EventContext.GetEntityIdData(RPGEventKeys::SourceID));
+    if (!Handle.IsValid())
+    {
+        return ERPGEventResult::Unhandled;
+    }
+    
+    FIntPoint Cell;
+    const int32* CellX = EventContext.Data.FindInt(RPGEventKeys::NewCellX);
+    const int32* CellY = EventContext.Data.FindInt(RPGEventKeys::NewCellY);
+    if (CellX && CellY)
+    {
+        Cell = FIntPoint(*CellX, *CellY);
+    }
+    else if (const AActor* Actor = Cast<AActor>(EventContext.SourceEntity.GetObject()))
+    {
+        // No cell on the event - place actors by where they ended up
+        Cell = WorldToGridCell(Actor->GetActorLocation());
+    }
+    else
+    {
+        return ERPGEventResult::Unhandled;
     }
     
-    return ValidateEntityTypeFuncPtr(TCHAR_TO_ANSI(*Type)) != 0;
+    // Bookkeeping only - bHandled is left to gameplay handlers
+    SpatialIndex->Place(Handle, Cell);
+    return ERPGEventResult::Unhandled;
 }
 
-// Toolkit Status
-bool URPGEntitySubsystem::IsToolkitLoaded() const
+void URPGEntitySubsystem::InitializeSpatialGrid(ERPGGridShape Shape, int32 Width, int32 Height, float CellSize)
 {
-    return bFunctionsLoaded;
+    SpatialIndex = MakeShared<FRPGSpatialIndex>(Shape, Width, Height);
+    SpatialCellSize = CellSize > 0.0f ? CellSize : 100.0f;
+    UE_LOG(LogTemp, Log, TEXT("URPGEntitySubsystem: %s spatial grid %dx%d, %.1f units per cell"),
+           Shape == ERPGGridShape::Hex ? TEXT("Hex") : TEXT("Square"), SpatialIndex->GetWidth(), SpatialIndex->GetHeight(), SpatialCellSize);
 }
 
-// Private Implementation
-void URPGEntitySubsystem::LoadDLLFunctions()
+bool URPGEntitySubsystem::PlaceEntity(FRPGEntityHandle Handle, FIntPoint Cell)
+{
+    return Registry.IsValid() && Registry->IsValid(Handle) && SpatialIndex.IsValid() && SpatialIndex->Place(Handle, Cell);
+}
+
+bool URPGEntitySubsystem::RemoveEntityFromGrid(FRPGEntityHandle Handle)
+{
+    return SpatialIndex.IsValid() && SpatialIndex->Remove(Handle);
+}
+
+bool URPGEntitySubsystem::GetEntityCell(FRPGEntityHandle Handle, FIntPoint& OutCell) const
 {
-    // Use proper UE binary directory (following RPGDiceSubsystem pattern)
-    FString BinariesDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("Binaries"), FPlatformProcess::GetBinariesSubdirectory());
-    FString LibraryPath = FPaths::Combine(BinariesDir, TEXT("rpg_toolkit.dll"));
-    LibraryPath = FPaths::ConvertRelativePathToFull(LibraryPath);
+    return SpatialIndex.IsValid() && SpatialIndex->GetCell(Handle, OutCell);
+}
+
+int32 URPGEntitySubsystem::GetGridDistance(FIntPoint A, FIntPoint B) const
+{
+    return SpatialIndex.IsValid() ? SpatialIndex->GetDistance(A, B) : 0;
+}
+
+FIntPoint URPGEntitySubsystem::WorldToGridCell(FVector Location) const
+{
+    return SpatialIndex.IsValid() ? SpatialIndex->GetCellAt(FVector2D(Location) / SpatialCellSize) : FIntPoint::ZeroValue;
+}
 
-    UE_LOG(LogTemp, Warning, TEXT("URPGEntitySubsystem: Attempting to load DLL from: %s"), *LibraryPath);
+FVector URPGEntitySubsystem::GridCellToWorld(FIntPoint Cell) const
+{
+    return SpatialIndex.IsValid() ? FVector(SpatialIndex->GetCellCenter(Cell) * SpatialCellSize, 0.0) : FVector::ZeroVector;
+}
 
-    // Check if the DLL exists
-    if (!FPaths::FileExists(LibraryPath))
+TArray<FRPGEntityHandle> URPGEntitySubsystem::FindEntitiesInRadius(FIntPoint Center, int32 Radius) const
+{
+    TArray<FRPGEntityHandle> Entities;
+    if (SpatialIndex.IsValid())
     {
-        UE_LOG(LogTemp, Error, TEXT("URPGEntitySubsystem: DLL not found at path: %s"), *LibraryPath);
-        return;
+        SpatialIndex->QueryRadius(Center, Radius, Entities);
+    }
+    return Entities;
+}
+
+TArray<FRPGEntityHandle> URPGEntitySubsystem::FindEntitiesInCone(FIntPoint Origin, FVector2D Direction, int32 Length, float HalfAngleDegrees) const
+{
+    TArray<FRPGEntityHandle> Entities;
+    if (SpatialIndex.IsValid())
+    {
+        SpatialIndex->QueryCone(Origin, Direction, Length, HalfAngleDegrees, Entities);
     }
+    return Entities;
+}
 
-    // Load the DLL
-    ToolkitDLLHandle = FPlatformProcess::GetDllHandle(*LibraryPath);
-    if (!ToolkitDLLHandle)
+TArray<FRPGEntityHandle> URPGEntitySubsystem::FindEntitiesOnLine(FIntPoint From, FIntPoint To) const
+{
+    TArray<FRPGEntityHandle> Entities;
+    if (SpatialIndex.IsValid())
     {
-        UE_LOG(LogTemp, Error, TEXT("URPGEntitySubsystem: Failed to load DLL"));
-        return;
+        SpatialIndex->QueryLine(From, To, Entities);
+    }
+    return Entities;
+}
+
+int32 URPGEntitySubsystem::GetNumEntitiesOnGrid() const
+{
+    return SpatialIndex.IsValid() ? SpatialIndex->Num() : 0;
+}
+
+#if !UE_BUILD_SHIPPING
+FString URPGEntitySubsystem::BenchmarkSpatialQueries(int32 NumEntities, int32 MapSize, int32 NumQueries, int32 Radius)
+{
+    if (NumEntities <= 0 || MapSize <= 0 || NumQueries <= 0 || Radius < 0)
+    {
+        return TEXT("BenchmarkSpatialQueries: invalid entity count, map size, query count or radius");
     }
+    
+    auto RunShape = [NumEntities, MapSize, NumQueries, Radius](ERPGGridShape Shape) -> FString
+    {
+        // Synthetic handles - the index only needs distinct slots, not live entities
+        FRPGSpatialIndex Index(Shape, MapSize, MapSize);
+        FRandomStream Stream(4242);
+        auto RandomCell = [&Stream, MapSize]() { return FIntPoint(Stream.RandRange(0, MapSize - 1), Stream.RandRange(0, MapSize - 1)); };
+        
+        TArray<FRPGEntityHandle> Handles;
+        TArray<FIntPoint> Cells;
+        Handles.Reserve(NumEntities);
+        Cells.Reserve(NumEntities);
+        for (int32 Entity = 0; Entity < NumEntities; ++Entity)
+        {
+            Handles.Add(FRPGEntityHandle(Entity, 1));
+            Cells.Add(RandomCell());
+        }
+        
+        double Start = FPlatformTime::Seconds();
+        for (int32 Entity = 0; Entity < NumEntities; ++Entity)
+        {
+            Index.Place(Handles[Entity], Cells[Entity]);
+        }
+        const double PlaceSeconds = FPlatformTime::Seconds() - Start;
+        
+        // One-cell steps, as EntityMoved delivers them; Cells tracks the result for the scan baseline
+        TArray<FIntPoint> Steps;
+        Steps.SetNumUninitialized(NumQueries);
+        for (int32 Query = 0; Query < NumQueries; ++Query)
+        {
+            FIntPoint& Cell = Cells[Query % NumEntities];
+            Cell.X = FMath::Clamp(Cell.X + Stream.RandRange(-1, 1), 0, MapSize - 1);
+            Cell.Y = FMath::Clamp(Cell.Y + Stream.RandRange(-1, 1), 0, MapSize - 1);
+            Steps[Query] = Cell;
+        }
+        
+        Start = FPlatformTime::Seconds();
+        for (int32 Query = 0; Query < NumQueries; ++Query)
+        {
+            Index.Place(Handles[Query % NumEntities], Steps[Query]);
+        }
+        const double MoveSeconds = FPlatformTime::Seconds() - Start;
+        
+        TArray<FIntPoint> Centers;
+        TArray<FVector2D> Directions;
+        Centers.Reserve(NumQueries);
+        Directions.Reserve(NumQueries);
+        for (int32 Query = 0; Query < NumQueries; ++Query)
+        {
+            Centers.Add(RandomCell());
+            const float Angle = Stream.FRandRange(0.0f, UE_TWO_PI);
+            Directions.Add(FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)));
+        }
+        
+        TArray<FRPGEntityHandle> Results;
+        TArray<int32> RadiusCounts;
+        RadiusCounts.SetNumUninitialized(NumQueries);
+        int64 RadiusHits = 0;
+        Start = FPlatformTime::Seconds();
+        for (int32 Query = 0; Query < NumQueries; ++Query)
+        {
+            Results.Reset();
+            Index.QueryRadius(Centers[Query], Radius, Results);
+            RadiusCounts[Query] = Results.Num();
+            RadiusHits += Results.Num();
+        }
+        const double RadiusSeconds = FPlatformTime::Seconds() - Start;
+        
+        // Baseline: test every entity against every query
+        int32 Mismatches = 0;
+        Start = FPlatformTime::Seconds();
+        for (int32 Query = 0; Query < NumQueries; ++Query)
+        {
+            int32 Count = 0;
+            for (const FIntPoint& Cell : Cells)
+            {
+                Count += Index.GetDistance(Centers[Query], Cell) <= Radius ? 1 : 0;
+            }
+            Mismatches += Count != RadiusCounts[Query] ? 1 : 0;
+        }
+        const double ScanSeconds = FPlatformTime::Seconds() - Start;
+        
+        int64 ConeHits = 0;
+        Start = FPlatformTime::Seconds();
+        for (int32 Query = 0; Query < NumQueries; ++Query)
+        {
+            Results.Reset();
+            Index.QueryCone(Centers[Query], Directions[Query], Radius, 26.57f, Results);
+            ConeHits += Results.Num();
+        }
+        const double ConeSeconds = FPlatformTime::Seconds() - Start;
+        
+        int64 LineHits = 0;
+        Start = FPlatformTime::Seconds();
+        for (int32 Query = 0; Query < NumQueries; ++Query)
+        {
+            const FIntPoint& From = Centers[Query];
+            const FIntPoint To(FMath::Clamp(From.X + FMath::RoundToInt32(Directions[Query].X * Radius * 4), 0, MapSize - 1),
+                               FMath::Clamp(From.Y + FMath::RoundToInt32(Directions[Query].Y * Radius * 4), 0, MapSize - 1));
+            Results.Reset();
+            Index.QueryLine(From, To, Results);
+            LineHits += Results.Num();
+        }
+        const double LineSeconds = FPlatformTime::Seconds() - Start;
+        
+        const double PerQuery = 1e6 / NumQueries;
+        return FString::Printf(TEXT("%s %dx%d, %d entities | place %.1f ns, move %.1f ns | radius %d: %.2f us vs scan %.2f us (%.1fx), %.1f hits | cone: %.2f us, %.1f hits | line %d: %.2f us, %.1f hits | %d mismatches"),
+            Shape == ERPGGridShape::Hex ? TEXT("Hex") : TEXT("Square"), MapSize, MapSize, NumEntities,
+            PlaceSeconds * 1e9 / NumEntities, MoveSeconds * 1e9 / NumQueries,
+            Radius, RadiusSeconds * PerQuery, ScanSeconds * PerQuery, RadiusSeconds > 0.0 ? ScanSeconds / RadiusSeconds : 0.0,
+            static_cast<double>(RadiusHits) / NumQueries,
+            ConeSeconds * PerQuery, static_cast<double>(ConeHits) / NumQueries,
+            Radius * 4, LineSeconds * PerQuery, static_cast<double>(LineHits) / NumQueries,
+            Mismatches);
+    };
+    
+    const FString Summary = RunShape(ERPGGridShape::Square) + TEXT("\n") + RunShape(ERPGGridShape::Hex);
+    UE_LOG(LogTemp, Log, TEXT("URPGEntitySubsystem::BenchmarkSpatialQueries:\n%s"), *Summary);
+    return Summary;
+}
+#endif
 
-    UE_LOG(LogTemp, Warning, TEXT("URPGEntitySubsystem: Successfully loaded DLL"));
+void URPGEntitySubsystem::RegisterBatch(FRPGEntityRegistry* TargetRegistry, TConstArrayView<TScriptInterface<IRPGEntityInterface>> Entities, TArrayView<FRPGEntityHandle> OutHandles, TArrayView<FRPGEntityError> OutErrors)
+{
+    const int32 NumEntities = Entities.Num();
+    if (NumEntities == 0)
+    {
+        return;
+    }
+    
+    // Size every ID and type first so one UTF-8 buffer holds them all and the views never move
+    TArray<FRPGEntityViewPacked, TInlineAllocator<1>> Views;
+    Views.SetNumZeroed(NumEntities);
+    int32 TotalLength = 0;
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        if (const IRPGEntityInterface* Native = Entities[Index].GetInterface())
+        {
+            const FString& ID = Native->GetID();
+            const FString& Type = Native->GetType();
+            Views[Index].IDLen = FPlatformString::ConvertedLength<UTF8CHAR>(*ID, ID.Len());
+            Views[Index].TypeLen = FPlatformString::ConvertedLength<UTF8CHAR>(*Type, Type.Len());
+            TotalLength += Views[Index].IDLen + Views[Index].TypeLen;
+        }
+    }
     
-    // Load error constant functions
-    GetEntityNotFoundErrorFuncPtr = (GetEntityNotFoundErrorFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEntityNotFoundError"));
-    GetInvalidEntityErrorFuncPtr = (GetInvalidEntityErrorFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetInvalidEntityError"));
-    GetDuplicateEntityErrorFuncPtr = (GetDuplicateEntityErrorFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDuplicateEntityError"));
-    GetNilEntityErrorFuncPtr = (GetNilEntityErrorFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetNilEntityError"));
-    GetEmptyIDErrorFuncPtr = (GetEmptyIDErrorFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEmptyIDError"));
-    GetInvalidTypeErrorFuncPtr = (GetInvalidTypeErrorFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetInvalidTypeError"));
+    TArray<UTF8CHAR, TInlineAllocator<128>> Utf8;
+    Utf8.SetNumUninitialized(FMath::Max(TotalLength, 1));
+    UTF8CHAR* Cursor = Utf8.GetData();
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        if (const IRPGEntityInterface* Native = Entities[Index].GetInterface())
+        {
+            const FString& ID = Native->GetID();
+            const FString& Type = Native->GetType();
+            FRPGEntityViewPacked& View = Views[Index];
+            
+            View.ID = reinterpret_cast<const ANSICHAR*>(Cursor);
+            FPlatformString::Convert(Cursor, View.IDLen, *ID, ID.Len());
+            Cursor += View.IDLen;
+            
+            View.Type = reinterpret_cast<const ANSICHAR*>(Cursor);
+            FPlatformString::Convert(Cursor, View.TypeLen, *Type, Type.Len());
+            Cursor += View.TypeLen;
+        }
+    }
     
-    // Load validation functions
-    ValidateEntityIDFuncPtr = (ValidateEntityIDFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("ValidateEntityID"));
-    ValidateEntityTypeFuncPtr = (ValidateEntityTypeFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("ValidateEntityType"));
+    const FRPGToolkitConstants& Constants = FRPGToolkitModule::GetConstants();
     
-    // Load string management function
-    FreeStringFuncPtr = (FreeStringFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("FreeString"));
+    TArray<uint64, TInlineAllocator<4>> Mask;
+    Mask.SetNumZeroed(RPGEntityBatchBits::NumWords(NumEntities));
+    ValidateEntitiesBatch(Views.GetData(), NumEntities, Mask.GetData());
     
-    // Load automatic cleanup function
-    CreateEntityErrorCompleteFuncPtr = (CreateEntityErrorCompleteFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("CreateEntityErrorComplete"));
+    for (int32 Index = 0; Index < NumEntities; ++Index)
+    {
+        const IRPGEntityInterface* Native = Entities[Index].GetInterface();
+        OutHandles[Index] = FRPGEntityHandle();
+        if (!Native || !TargetRegistry)
+        {
+            OutErrors[Index] = FRPGEntityError(ERPGEntityError::NilEntity, TEXT(""), TEXT(""), TEXT("RegisterEntity"), Constants.NilEntityError.String);
+            continue;
+        }
+        
+        const FString& ID = Native->GetID();
+        const FString& Type = Native->GetType();
+        const uint64 Bits = RPGEntityBatchBits::Get(Mask.GetData(), Index);
+        if (!(Bits & RPGEntityBatchBits::ValidID))
+        {
+            OutErrors[Index] = FRPGEntityError(ERPGEntityError::Invalid, ID, Type, TEXT("RegisterEntity"), Constants.InvalidEntityError.String);
+            continue;
+        }
+        if (!(Bits & RPGEntityBatchBits::ValidType))
+        {
+            OutErrors[Index] = FRPGEntityError(ERPGEntityError::InvalidType, ID, Type, TEXT("RegisterEntity"), Constants.InvalidTypeError.String);
+            continue;
+        }
+        
+        ERPGEntityError Error = ERPGEntityError::None;
+        OutHandles[Index] = TargetRegistry->Register(Entities[Index].GetObject(), Native->GetCompactID(), FName(*Type), &Error);
+        if (!OutHandles[Index].IsValid())
+        {
+            const FString& Message = Error == ERPGEntityError::Duplicate ? Constants.DuplicateEntityError.String : Constants.EmptyIDError.String;
+            OutErrors[Index] = FRPGEntityError(Error, ID, Type, TEXT("RegisterEntity"), Message);
+            continue;
+        }
+        
+        OutErrors[Index] = FRPGEntityError();
+    }
+}
+
+void URPGEntitySubsystem::BindToolkitFunctions()
+{
+    Toolkit = FRPGToolkitModule::Acquire(TEXT("URPGEntitySubsystem"));
+    if (!Toolkit)
+    {
+        UE_LOG(LogTemp, Error, TEXT("URPGEntitySubsystem: Toolkit DLL not available"));
+        return;
+    }
     
     // Check if functions were loaded
-    bool bAllFunctionsLoaded = (GetEntityNotFoundErrorFuncPtr != nullptr) && 
-                              (GetInvalidEntityErrorFuncPtr != nullptr) && 
-                              (GetDuplicateEntityErrorFuncPtr != nullptr) &&
-                              (GetNilEntityErrorFuncPtr != nullptr) &&
-                              (GetEmptyIDErrorFuncPtr != nullptr) &&
-                              (GetInvalidTypeErrorFuncPtr != nullptr) &&
-                              (ValidateEntityIDFuncPtr != nullptr) &&
-                              (ValidateEntityTypeFuncPtr != nullptr) &&
-                              (FreeStringFuncPtr != nullptr) &&
-                              (CreateEntityErrorCompleteFuncPtr != nullptr);
+    bool bAllFunctionsLoaded = (Toolkit->GetEntityNotFoundError != nullptr) && 
+                              (Toolkit->GetInvalidEntityError != nullptr) && 
+                              (Toolkit->GetDuplicateEntityError != nullptr) &&
+                              (Toolkit->GetNilEntityError != nullptr) &&
+                              (Toolkit->GetEmptyIDError != nullptr) &&
+                              (Toolkit->GetInvalidTypeError != nullptr) &&
+                              (Toolkit->ValidateEntityID != nullptr) &&
+                              (Toolkit->ValidateEntityType != nullptr) &&
+                              (Toolkit->FreeString != nullptr) &&
+                              (Toolkit->CreateEntityErrorComplete != nullptr);
     
     if (bAllFunctionsLoaded)
     {
         bFunctionsLoaded = true;
         UE_LOG(LogTemp, Warning, TEXT("URPGEntitySubsystem: All core toolkit functions loaded successfully"));
+        
+        if (!Toolkit->ValidateEntitiesBatch)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("URPGEntitySubsystem: ValidateEntitiesBatch not exported - entities will be validated one call at a time"));
+        }
     }
     else
     {
         UE_LOG(LogTemp, Error, TEXT("URPGEntitySubsystem: Failed to load some core toolkit functions"));
-        UE_LOG(LogTemp, Error, TEXT("  GetEntityNotFoundError: %s"), GetEntityNotFoundErrorFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Error, TEXT("  GetInvalidEntityError: %s"), GetInvalidEntityErrorFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Error, TEXT("  GetDuplicateEntityError: %s"), GetDuplicateEntityErrorFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Error, TEXT("  GetNilEntityError: %s"), GetNilEntityErrorFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Error, TEXT("  GetEmptyIDError: %s"), GetEmptyIDErrorFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Error, TEXT("  GetInvalidTypeError: %s"), GetInvalidTypeErrorFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Error, TEXT("  ValidateEntityID: %s"), ValidateEntityIDFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Error, TEXT("  ValidateEntityType: %s"), ValidateEntityTypeFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Error, TEXT("  FreeString: %s"), FreeStringFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Error, TEXT("  CreateEntityErrorComplete: %s"), CreateEntityErrorCompleteFuncPtr ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("  GetEntityNotFoundError: %s"), Toolkit->GetEntityNotFoundError ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("  GetInvalidEntityError: %s"), Toolkit->GetInvalidEntityError ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("  GetDuplicateEntityError: %s"), Toolkit->GetDuplicateEntityError ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("  GetNilEntityError: %s"), Toolkit->GetNilEntityError ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("  GetEmptyIDError: %s"), Toolkit->GetEmptyIDError ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("  GetInvalidTypeError: %s"), Toolkit->GetInvalidTypeError ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("  ValidateEntityID: %s"), Toolkit->ValidateEntityID ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("  ValidateEntityType: %s"), Toolkit->ValidateEntityType ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("  FreeString: %s"), Toolkit->FreeString ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Error, TEXT("  CreateEntityErrorComplete: %s"), Toolkit->CreateEntityErrorComplete ? TEXT("OK") : TEXT("FAILED"));
     }
 }
 
@@ -217,9 +867,9 @@ FString URPGEntitySubsystem::ConvertAndFreeString(ANSICHAR* CStr) const
     FString Result = FString(ANSI_TO_TCHAR(CStr));
     
     // Free the C string memory
-    if (FreeStringFuncPtr)
+    if (Toolkit && Toolkit->FreeString)
     {
-        FreeStringFuncPtr(CStr);
+        Toolkit->FreeString(CStr);
     }
     
     return Result;
@@ -228,13 +878,13 @@ FString URPGEntitySubsystem::ConvertAndFreeString(ANSICHAR* CStr) const
 bool URPGEntitySubsystem::IsSafeToCallFunction() const
 {
     // Following RPGDiceSubsystem pattern for shutdown safety
-    return bFunctionsLoaded && ToolkitDLLHandle != nullptr;
+    return bFunctionsLoaded && Toolkit != nullptr;
 }
 
 // Automatic Cleanup Entity Error Implementation
 FEntityErrorResult URPGEntitySubsystem::CreateEntityError(const FString& Operation, const FString& EntityType, const FString& EntityID, const FString& Message)
 {
-    if (!IsSafeToCallFunction() || !CreateEntityErrorCompleteFuncPtr)
+    if (!IsSafeToCallFunction() || !Toolkit->CreateEntityErrorComplete)
     {
         return FEntityErrorResult(); // Invalid result
     }
@@ -250,7 +900,7 @@ FEntityErrorResult URPGEntitySubsystem::CreateEntityError(const FString& Operati
     ANSICHAR* outID;
     ANSICHAR* outMessage;
     
-    int32 success = CreateEntityErrorCompleteFuncPtr(
+    int32 success = Toolkit->CreateEntityErrorComplete(
         OpConverter.Get(),
         TypeConverter.Get(),
         IDConverter.Get(),
@@ -2,9 +2,16 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
-#include "HAL/PlatformProcess.h"
+#include "RPGEntity.h"
+#include "../Events/RPGEvent.h"
 #include "RPGEntitySubsystem.generated.h"
 
+// Forward declarations
+struct FRPGToolkitAPI;
+class FRPGEntityRegistry;
+class FRPGSpatialIndex;
+class URPGEventBusSubsystem;
+
 /**
  * Blueprint-friendly entity error result with automatic memory management
  */
@@ -52,13 +59,43 @@ struct SESHAT_API FEntityErrorResult
     }
 };
 
+/**
+ * Packed (ID, type) UTF-8 views passed across the CGO boundary to ValidateEntitiesBatch
+ * Layout must match RPGEntityView in core_bindings.go; the strings are not null-terminated
+ */
+struct FRPGEntityViewPacked
+{
+    const ANSICHAR* ID;
+    const ANSICHAR* Type;
+    int32 IDLen;
+    int32 TypeLen;
+};
+static_assert(sizeof(FRPGEntityViewPacked) == 2 * sizeof(void*) + 2 * sizeof(int32), "FRPGEntityViewPacked must match the packed RPGEntityView layout");
+
+/** Two bits per entity in the ValidateEntitiesBatch mask (mirrored in core_bindings.go) */
+namespace RPGEntityBatchBits
+{
+    constexpr uint64 ValidID = 1 << 0;
+    constexpr uint64 ValidType = 1 << 1;
+    constexpr int32 BitsPerEntity = 2;
+    constexpr int32 EntitiesPerWord = 64 / BitsPerEntity;
+
+    inline int32 NumWords(int32 NumEntities) { return (NumEntities + EntitiesPerWord - 1) / EntitiesPerWord; }
+
+    inline uint64 Get(const uint64* Mask, int32 Index)
+    {
+        return (Mask[Index / EntitiesPerWord] >> (BitsPerEntity * (Index % EntitiesPerWord))) & (ValidID | ValidType);
+    }
+}
+
 /**
  * Core toolkit integration subsystem for RPG entities
- * Exposes the actual rpg-toolkit core package functions
- * NO custom entity management - just raw toolkit exposure
+ * Exposes the actual rpg-toolkit core package functions, and owns the registry of live entities
+ * (validated against the toolkit on registration) that resolves handles and entity IDs in O(1),
+ * plus the spatial index that places them on the tactical grid (kept current from EntityMoved events)
  */
 UCLASS()
-class SESHAT_API URPGEntitySubsystem : public UGameInstanceSubsystem
+class SESHAT_API URPGEntitySubsystem : public UGameInstanceSubsystem, public IRPGEventInterface
 {
     GENERATED_BODY()
 
@@ -68,6 +105,12 @@ public:
     virtual void Deinitialize() override;
     // End USubsystem
 
+    // Begin IRPGEventInterface - EntityMoved events move entities in the spatial index
+    virtual ERPGEventResult HandleEvent(const FRPGEventContext& EventContext) override;
+    virtual ERPGEventPriority GetHandlingPriority(ERPGEventType EventType) const override { return ERPGEventPriority::Critical; }
+    virtual bool ShouldHandle(ERPGEventType EventType) const override { return EventType == ERPGEventType::EntityMoved; }
+    // End IRPGEventInterface
+
     // Core Error Constants (from core/errors.go)
     UFUNCTION(BlueprintCallable, Category = "RPG Core")
     FString GetEntityNotFoundError() const;
@@ -94,6 +137,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "RPG Core")
     bool ValidateEntityType(const FString& Type) const;
 
+    /**
+     * Validate NumEntities (ID, type) pairs in one toolkit call
+     * @param OutMask RPGEntityBatchBits::NumWords(NumEntities) words, RPGEntityBatchBits per entity
+     * @return Number of entities with a valid ID and type
+     */
+    int32 ValidateEntitiesBatch(const FRPGEntityViewPacked* Entities, int32 NumEntities, uint64* OutMask) const;
+
     // Automatic Cleanup Entity Error Functions
     UFUNCTION(BlueprintCallable, Category = "RPG Core")
     FEntityErrorResult CreateEntityError(const FString& Operation, const FString& EntityType, const FString& EntityID, const FString& Message);
@@ -102,40 +152,165 @@ public:
     UFUNCTION(BlueprintCallable, Category = "RPG Core")
     bool IsToolkitLoaded() const;
 
+    // Entity Registry - live entities by generational handle and by entity ID
+    /**
+     * Validate an entity's ID and type with the toolkit and add it to the registry
+     * @return Handle for the entity, invalid if it was refused (OutError says why)
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Core|Registry")
+    FRPGEntityHandle RegisterEntity(TScriptInterface<IRPGEntityInterface> Entity, FRPGEntityError& OutError);
+
+    /**
+     * RegisterEntity for many entities, validated with a single toolkit call
+     * @return One handle per entity, invalid where it was refused (OutErrors, index-aligned, says why)
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Core|Registry")
+    TArray<FRPGEntityHandle> RegisterEntities(const TArray<TScriptInterface<IRPGEntityInterface>>& Entities, TArray<FRPGEntityError>& OutErrors);
+
+    /**
+     * Defer an entity's registration to the next FlushPendingRegistrations, so a level's worth of entities
+     * (queued as their components initialize) is validated in one toolkit call on the first BeginPlay
+     */
+    void QueueEntityRegistration(UObject* Entity);
+
+    /** Drop a queued entity that will never reach BeginPlay */
+    void CancelEntityRegistration(UObject* Entity);
+
+    /** Register every queued entity in one batch; returns how many were registered */
+    int32 FlushPendingRegistrations();
+
+    /** Remove an entity; false if the handle is stale */
+    UFUNCTION(BlueprintCallable, Category = "RPG Core|Registry")
+    bool UnregisterEntity(FRPGEntityHandle Handle);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Registry")
+    bool IsEntityRegistered(FRPGEntityHandle Handle) const;
+
+    /** Handle for a registered entity ID (case-sensitive), invalid if not registered */
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Registry")
+    FRPGEntityHandle FindEntityHandle(const FString& EntityID) const;
+
+    /** FindEntityHandle without the string conversion */
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Registry")
+    FRPGEntityHandle FindEntityHandleByCompactID(FRPGEntityId EntityID) const;
+
+    /** Entity for a handle, null if the handle is stale or the object was destroyed */
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Registry")
+    TScriptInterface<IRPGEntityInterface> GetEntity(FRPGEntityHandle Handle) const;
+
+    /** Entity for a registered entity ID, null if not registered */
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Registry")
+    TScriptInterface<IRPGEntityInterface> FindEntity(const FString& EntityID) const;
+
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Registry")
+    int32 GetNumRegisteredEntities() const;
+
+    /** Registry for native systems that walk every entity (null before Initialize) */
+    FRPGEntityRegistry* GetRegistry() const { return Registry.Get(); }
+
+#if !UE_BUILD_SHIPPING
+    // Benchmarks - development builds only, run from the console (rpg.Bench.*)
+    /**
+     * Register, look up by handle, by compact ID and by ID string, and unregister SmallCount and then LargeCount
+     * entities, against a TMap keyed by GUID string (the per-system lookup maps the registry replaces)
+     */
+    FString BenchmarkEntityRegistry(int32 SmallCount = 10000, int32 LargeCount = 100000);
+
+    /**
+     * Level-load registration of NumEntities entities: per-entity ValidateEntityID + ValidateEntityType calls
+     * against RegisterEntities' single batch call
+     */
+    FString BenchmarkEntityValidation(int32 NumEntities = 5000);
+#endif
+
+    // Spatial Index - registered entities on a square or hex tactical grid (replaces the disabled spatial bindings)
+    /**
+     * Set the grid shape and size; takes every entity off the grid
+     * @param CellSize World units per cell (square edge, or distance between adjacent hex centers)
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Core|Spatial")
+    void InitializeSpatialGrid(ERPGGridShape Shape, int32 Width, int32 Height, float CellSize = 100.0f);
+
+    /** Put a registered entity on Cell, or move it there; false if the handle is stale or Cell is off the map */
+    UFUNCTION(BlueprintCallable, Category = "RPG Core|Spatial")
+    bool PlaceEntity(FRPGEntityHandle Handle, FIntPoint Cell);
+
+    /** Take an entity off the grid (UnregisterEntity does this too) */
+    UFUNCTION(BlueprintCallable, Category = "RPG Core|Spatial")
+    bool RemoveEntityFromGrid(FRPGEntityHandle Handle);
+
+    /** Cell an entity is on; false if it is not on the grid */
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Spatial")
+    bool GetEntityCell(FRPGEntityHandle Handle, FIntPoint& OutCell) const;
+
+    /** Moves between two cells (square: diagonals count as one, hex: cube distance) */
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Spatial")
+    int32 GetGridDistance(FIntPoint A, FIntPoint B) const;
+
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Spatial")
+    FIntPoint WorldToGridCell(FVector Location) const;
+
+    /** Cell center on the XY plane */
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Spatial")
+    FVector GridCellToWorld(FIntPoint Cell) const;
+
+    /** Entities within Radius cells of Center (burst/sphere areas) */
+    UFUNCTION(BlueprintCallable, Category = "RPG Core|Spatial")
+    TArray<FRPGEntityHandle> FindEntitiesInRadius(FIntPoint Center, int32 Radius) const;
+
+    /**
+     * Entities in a cone Length cells long from Origin towards Direction, excluding Origin itself
+     * The default half angle gives a cone as wide as it is long at its end
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Core|Spatial")
+    TArray<FRPGEntityHandle> FindEntitiesInCone(FIntPoint Origin, FVector2D Direction, int32 Length, float HalfAngleDegrees = 26.57f) const;
+
+    /** Entities on the line of cells From -> To, both ends included */
+    UFUNCTION(BlueprintCallable, Category = "RPG Core|Spatial")
+    TArray<FRPGEntityHandle> FindEntitiesOnLine(FIntPoint From, FIntPoint To) const;
+
+    UFUNCTION(BlueprintPure, Category = "RPG Core|Spatial")
+    int32 GetNumEntitiesOnGrid() const;
+
+    /** Spatial index for native systems (null before Initialize) */
+    FRPGSpatialIndex* GetSpatialIndex() const { return SpatialIndex.Get(); }
+
+#if !UE_BUILD_SHIPPING
+    /**
+     * NumEntities entities on a MapSize x MapSize square and then hex grid: placement, single-step moves, and
+     * NumQueries radius, cone and line queries, with radius queries checked against a scan of every entity
+     */
+    FString BenchmarkSpatialQueries(int32 NumEntities = 5000, int32 MapSize = 512, int32 NumQueries = 10000, int32 Radius = 6);
+#endif
+
 private:
-    /** Function pointers to actual toolkit DLL functions */
-    typedef ANSICHAR* (*GetEntityNotFoundErrorFunc)();
-    typedef ANSICHAR* (*GetInvalidEntityErrorFunc)();
-    typedef ANSICHAR* (*GetDuplicateEntityErrorFunc)();
-    typedef ANSICHAR* (*GetNilEntityErrorFunc)();
-    typedef ANSICHAR* (*GetEmptyIDErrorFunc)();
-    typedef ANSICHAR* (*GetInvalidTypeErrorFunc)();
-    typedef int32 (*ValidateEntityIDFunc)(const ANSICHAR*);
-    typedef int32 (*ValidateEntityTypeFunc)(const ANSICHAR*);
-    typedef void (*FreeStringFunc)(ANSICHAR*);
-    
-    // Automatic cleanup function
-    typedef int32 (*CreateEntityErrorCompleteFunc)(const ANSICHAR*, const ANSICHAR*, const ANSICHAR*, const ANSICHAR*, ANSICHAR**, ANSICHAR**, ANSICHAR**, ANSICHAR**);
-    
-    GetEntityNotFoundErrorFunc GetEntityNotFoundErrorFuncPtr;
-    GetInvalidEntityErrorFunc GetInvalidEntityErrorFuncPtr;
-    GetDuplicateEntityErrorFunc GetDuplicateEntityErrorFuncPtr;
-    GetNilEntityErrorFunc GetNilEntityErrorFuncPtr;
-    GetEmptyIDErrorFunc GetEmptyIDErrorFuncPtr;
-    GetInvalidTypeErrorFunc GetInvalidTypeErrorFuncPtr;
-    ValidateEntityIDFunc ValidateEntityIDFuncPtr;
-    ValidateEntityTypeFunc ValidateEntityTypeFuncPtr;
-    FreeStringFunc FreeStringFuncPtr;
-    CreateEntityErrorCompleteFunc CreateEntityErrorCompleteFuncPtr;
+    /** Shared toolkit function table (borrowed from FRPGToolkitModule) */
+    const FRPGToolkitAPI* Toolkit;
     
     /** Whether the DLL functions were successfully loaded */
     bool bFunctionsLoaded;
     
-    /** Handle to the loaded DLL */
-    void* ToolkitDLLHandle;
+    /** Live entities */
+    TSharedPtr<FRPGEntityRegistry> Registry;
+    
+    /** Entities waiting for FlushPendingRegistrations */
+    TArray<TWeakObjectPtr<UObject>> PendingRegistrations;
+    
+    /** Registered entities on the tactical grid */
+    TSharedPtr<FRPGSpatialIndex> SpatialIndex;
+    
+    /** World units per grid cell */
+    float SpatialCellSize;
+    
+    /** Event bus the EntityMoved subscription lives on */
+    TWeakObjectPtr<URPGEventBusSubsystem> EventBus;
+    FRPGEventHandle EntityMovedSubscription;
+    
+    /** Borrow the shared toolkit function table and check required functions */
+    void BindToolkitFunctions();
     
-    /** Load the DLL and function pointers */
-    void LoadDLLFunctions();
+    /** Validate Entities and register them into TargetRegistry, writing one handle and one error per entity */
+    void RegisterBatch(FRPGEntityRegistry* TargetRegistry, TConstArrayView<TScriptInterface<IRPGEntityInterface>> Entities, TArrayView<FRPGEntityHandle> OutHandles, TArrayView<FRPGEntityError> OutErrors);
     
     /** Helper to convert C string and free memory */
     FString ConvertAndFreeString(ANSICHAR* CStr) const;
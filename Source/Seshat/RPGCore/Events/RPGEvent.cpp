@@ -1,7 +1,33 @@
 #include "RPGEvent.h"
 #include "RPGEventBusSubsystem.h"
+#include "RPGEventArena.h"
+#include "RPGEventProfiler.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Engine/World.h"
 
+namespace
+{
+    /** EventName for a dice roll event; the standard die sizes come from a table built once */
+    FName GetDiceRollEventName(int32 Sides)
+    {
+        static const FName StandardNames[] =
+        {
+            FName(TEXT("d4 Roll")), FName(TEXT("d6 Roll")), FName(TEXT("d8 Roll")), FName(TEXT("d10 Roll")),
+            FName(TEXT("d12 Roll")), FName(TEXT("d20 Roll")), FName(TEXT("d100 Roll"))
+        };
+        static const int32 StandardSides[] = { 4, 6, 8, 10, 12, 20, 100 };
+        
+        for (int32 Index = 0; Index < UE_ARRAY_COUNT(StandardSides); ++Index)
+        {
+            if (StandardSides[Index] == Sides)
+            {
+                return StandardNames[Index];
+            }
+        }
+        return FName(*FString::Printf(TEXT("d%d Roll"), Sides));
+    }
+}
+
 URPGEvent::URPGEvent()
     : DefaultPriority(ERPGEventPriority::Normal)
     , bHandleAllEventTypes(false)
@@ -16,7 +42,7 @@ ERPGEventResult URPGEvent::HandleEvent(const FRPGEventContext& EventContext)
     // Prevent recursive event handling
     if (bIsProcessingEvent)
     {
-        UE_LOG(LogTemp, Warning, TEXT("URPGEvent::HandleEvent: Recursive event handling prevented for event type %s"), 
+        UE_LOG(LogTemp, Warning, TEXT("URPGEvent::HandleEvent: Recursive event handling prevented for event type %s (publish follow-up events with QueueEvent)"), 
                *RPGEventTypes::EventTypeToString(EventContext.EventType));
         return ERPGEventResult::Error;
     }
@@ -27,6 +53,14 @@ ERPGEventResult URPGEvent::HandleEvent(const FRPGEventContext& EventContext)
         return ERPGEventResult::Unhandled;
     }
 
+    // Named after the handler class; the name is only built while the RPGEvents channel is traced
+    FString TraceScopeName;
+    if (UE_TRACE_CHANNELEXPR_IS_ENABLED(RPGEventsChannel))
+    {
+        TraceScopeName = GetClass()->GetName();
+    }
+    TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*TraceScopeName, RPGEventsChannel);
+    
     bIsProcessingEvent = true;
     
     ERPGEventResult Result = ProcessRPGEvent(EventContext);
@@ -126,35 +160,55 @@ bool URPGEvent::PublishEventToSubsystem(URPGEventBusSubsystem* EventBus, const F
         return false;
     }
     
-    // Convert FRPGEventContext to Swiss Army Knife API parameters
-    FString EventTypeString = RPGEventTypes::EventTypeToString(EventContext.EventType);
+    // Deliver to in-process C++/Blueprint handlers first
+    FRPGEventContext DispatchContext = EventContext;
+    EventBus->DispatchEvent(DispatchContext);
     
-    // Extract entity IDs
-    FString SourceID = EventContext.SourceEntity.GetInterface() ? EventContext.SourceEntity->GetID() : TEXT("");
-    FString TargetID = EventContext.TargetEntity.GetInterface() ? EventContext.TargetEntity->GetID() : TEXT("");
+    if (!EventBus->IsToolkitLoaded())
+    {
+        return true;
+    }
     
-    // Serialize context data as JSON-like string
-    FString ContextData = FString::Printf(TEXT("{\"EventID\":\"%s\",\"EventName\":\"%s\",\"Timestamp\":%f}"),
-        *EventContext.EventID, *EventContext.EventName, EventContext.Timestamp);
+    // Full context in the binary wire format
+    return EventBus->PublishEventBinary(EventContext);
+}
+
+bool URPGEvent::QueueEvent(const FRPGEventContext& EventContext)
+{
+    if (GEngine && GEngine->GetCurrentPlayWorld())
+    {
+        if (UGameInstance* GameInstance = GEngine->GetCurrentPlayWorld()->GetGameInstance())
+        {
+            if (URPGEventBusSubsystem* EventBus = GameInstance->GetSubsystem<URPGEventBusSubsystem>())
+            {
+                return EventBus->QueueEvent(EventContext);
+            }
+        }
+    }
     
-    return EventBus->PublishEvent(EventTypeString, SourceID, TargetID, ContextData);
+    UE_LOG(LogTemp, Warning, TEXT("URPGEvent::QueueEvent: Event bus subsystem not found"));
+    return false;
 }
 
 bool URPGEvent::SubscribeToEventType(ERPGEventType EventType, TScriptInterface<IRPGEventInterface> Handler)
 {
+    if (!Handler.GetObject())
+    {
+        return false;
+    }
+    
     if (GEngine && GEngine->GetCurrentPlayWorld())
     {
         if (UGameInstance* GameInstance = GEngine->GetCurrentPlayWorld()->GetGameInstance())
         {
             if (URPGEventBusSubsystem* EventBus = GameInstance->GetSubsystem<URPGEventBusSubsystem>())
             {
-                // Convert event type to string and use default priority
-                FString EventTypeString = RPGEventTypes::EventTypeToString(EventType);
-                int32 Priority = static_cast<int32>(ERPGEventPriority::Normal);
+                // Ask the handler for its priority for this event type
+                ERPGEventPriority Priority = Handler.GetInterface()
+                    ? Handler->GetHandlingPriority(EventType)
+                    : IRPGEventInterface::Execute_GetEventHandlingPriority(Handler.GetObject(), EventType);
                 
-                FString SubscriptionID = EventBus->SubscribeEvent(EventTypeString, Priority);
-                // TODO: Need to store mapping between Handler and SubscriptionID for unsubscribe
-                return !SubscriptionID.IsEmpty();
+                return EventBus->SubscribeHandler(EventType, Handler, Priority).IsValid();
             }
         }
     }
@@ -162,19 +216,25 @@ bool URPGEvent::SubscribeToEventType(ERPGEventType EventType, TScriptInterface<I
     return false;
 }
 
-bool URPGEvent::UnsubscribeFromEventType(ERPGEventType EventType, TScriptInterface<IRPGEventInterface> Handler)
+bool URPGEvent::SubscribeToEntityEvents(ERPGEventType EventType, const FString& EntityID, ERPGEventEntityScope Scope,
+                                        TScriptInterface<IRPGEventInterface> Handler)
 {
+    if (!Handler.GetObject() || EntityID.IsEmpty())
+    {
+        return false;
+    }
+    
     if (GEngine && GEngine->GetCurrentPlayWorld())
     {
         if (UGameInstance* GameInstance = GEngine->GetCurrentPlayWorld()->GetGameInstance())
         {
             if (URPGEventBusSubsystem* EventBus = GameInstance->GetSubsystem<URPGEventBusSubsystem>())
             {
-                // TODO: Architecture change - need subscription ID, not handler
-                // For now, return true to allow compilation. Proper implementation
-                // requires tracking subscription IDs from SubscribeToEventType
-                UE_LOG(LogTemp, Warning, TEXT("URPGEvent::UnsubscribeFromEventType: Not implemented - need subscription ID mapping"));
-                return true;
+                ERPGEventPriority Priority = Handler.GetInterface()
+                    ? Handler->GetHandlingPriority(EventType)
+                    : IRPGEventInterface::Execute_GetEventHandlingPriority(Handler.GetObject(), EventType);
+                
+                return EventBus->SubscribeEntityHandler(EventType, EntityID, Scope, Handler, Priority).IsValid();
             }
         }
     }
@@ -182,16 +242,33 @@ bool URPGEvent::UnsubscribeFromEventType(ERPGEventType EventType, TScriptInterfa
     return false;
 }
 
-FRPGEventContext URPGEvent::CreateEntityEvent(ERPGEventType EventType, TScriptInterface<IRPGEntityInterface> Entity)
+bool URPGEvent::UnsubscribeFromEventType(ERPGEventType EventType, TScriptInterface<IRPGEventInterface> Handler)
 {
-    FRPGEventContext Context(EventType, Entity);
-    
-    if (Entity.GetInterface())
+    if (GEngine && GEngine->GetCurrentPlayWorld())
     {
-        Context.SetStringData(TEXT("EntityID"), Entity->GetID());
-        Context.SetStringData(TEXT("EntityType"), Entity->GetType());
+        if (UGameInstance* GameInstance = GEngine->GetCurrentPlayWorld()->GetGameInstance())
+        {
+            if (URPGEventBusSubsystem* EventBus = GameInstance->GetSubsystem<URPGEventBusSubsystem>())
+            {
+                return EventBus->UnsubscribeHandlerFromEventType(EventType, Handler);
+            }
+        }
     }
     
+    return false;
+}
+
+FRPGEventContext URPGEvent::CreateEntityEvent(ERPGEventType EventType, TScriptInterface<IRPGEntityInterface> Entity)
+{
+    FRPGEventContext Context(EventType, Entity);
+    InitEntityEvent(Context, Entity);
+    return Context;
+}
+
+FRPGEventContext& URPGEvent::CreateEntityEvent(FRPGEventArena& Arena, ERPGEventType EventType, TScriptInterface<IRPGEntityInterface> Entity)
+{
+    FRPGEventContext& Context = Arena.Acquire(EventType, Entity);
+    InitEntityEvent(Context, Entity);
     return Context;
 }
 
@@ -199,11 +276,14 @@ FRPGEventContext URPGEvent::CreateDiceRollEvent(TScriptInterface<IRPGEntityInter
                                                int32 Sides, int32 Result)
 {
     FRPGEventContext Context(ERPGEventType::DiceRolled, RollerEntity);
-    
-    Context.SetIntData(TEXT("Sides"), Sides);
-    Context.SetIntData(TEXT("Result"), Result);
-    Context.EventName = FString::Printf(TEXT("d%d Roll"), Sides);
-    
+    InitDiceRollEvent(Context, Sides, Result);
+    return Context;
+}
+
+FRPGEventContext& URPGEvent::CreateDiceRollEvent(FRPGEventArena& Arena, TScriptInterface<IRPGEntityInterface> RollerEntity, int32 Sides, int32 Result)
+{
+    FRPGEventContext& Context = Arena.Acquire(ERPGEventType::DiceRolled, RollerEntity);
+    InitDiceRollEvent(Context, Sides, Result);
     return Context;
 }
 
@@ -212,21 +292,272 @@ FRPGEventContext URPGEvent::CreateCombatEvent(ERPGEventType EventType,
                                              TScriptInterface<IRPGEntityInterface> Defender)
 {
     FRPGEventContext Context(EventType, Attacker);
+    InitCombatEvent(Context, Attacker, Defender);
+    return Context;
+}
+
+FRPGEventContext& URPGEvent::CreateCombatEvent(FRPGEventArena& Arena, ERPGEventType EventType,
+                                              TScriptInterface<IRPGEntityInterface> Attacker,
+                                              TScriptInterface<IRPGEntityInterface> Defender)
+{
+    FRPGEventContext& Context = Arena.Acquire(EventType, Attacker);
+    InitCombatEvent(Context, Attacker, Defender);
+    return Context;
+}
+
+FRPGEventContext URPGEvent::CreateMoveEvent(TScriptInterface<IRPGEntityInterface> Entity, FIntPoint OldCell, FIntPoint NewCell)
+{
+    FRPGEventContext Context(ERPGEventType::EntityMoved, Entity);
+    InitMoveEvent(Context, Entity, OldCell, NewCell);
+    return Context;
+}
+
+FRPGEventContext& URPGEvent::CreateMoveEvent(FRPGEventArena& Arena, TScriptInterface<IRPGEntityInterface> Entity, FIntPoint OldCell, FIntPoint NewCell)
+{
+    FRPGEventContext& Context = Arena.Acquire(ERPGEventType::EntityMoved, Entity);
+    InitMoveEvent(Context, Entity, OldCell, NewCell);
+    return Context;
+}
+
+void URPGEvent::InitEntityEvent(FRPGEventContext& Context, const TScriptInterface<IRPGEntityInterface>& Entity)
+{
+    if (Entity.GetInterface())
+    {
+        Context.SetEntityData(TEXT("EntityID"), Entity);
+        Context.SetStringData(TEXT("EntityType"), Entity->GetType());
+    }
+}
+
+void URPGEvent::InitDiceRollEvent(FRPGEventContext& Context, int32 Sides, int32 Result)
+{
+    static const FName SidesKey(TEXT("Sides"));
+    static const FName ResultKey(TEXT("Result"));
+    Context.SetIntData(SidesKey, Sides);
+    Context.SetIntData(ResultKey, Result);
+    Context.EventName = GetDiceRollEventName(Sides);
+}
+
+void URPGEvent::InitCombatEvent(FRPGEventContext& Context, const TScriptInterface<IRPGEntityInterface>& Attacker,
+                                const TScriptInterface<IRPGEntityInterface>& Defender)
+{
+    // IDs are stored as entity references; GetContextString and the wire format still see the ID string
     Context.TargetEntity = Defender;
     
     if (Attacker.GetInterface())
     {
-        Context.SetStringData(TEXT("AttackerID"), Attacker->GetID());
+        Context.SetEntityData(TEXT("AttackerID"), Attacker);
         Context.SetStringData(TEXT("AttackerType"), Attacker->GetType());
     }
     
     if (Defender.GetInterface())
     {
-        Context.SetStringData(TEXT("DefenderID"), Defender->GetID());
+        Context.SetEntityData(TEXT("DefenderID"), Defender);
         Context.SetStringData(TEXT("DefenderType"), Defender->GetType());
     }
-    
-    return Context;
+}
+
+void URPGEvent::InitMoveEvent(FRPGEventContext& Context, const TScriptInterface<IRPGEntityInterface>& Entity, FIntPoint OldCell, FIntPoint NewCell)
+{
+    InitEntityEvent(Context, Entity);
+    Context.SetIntData(RPGEventKeys::OldCellX, OldCell.X);
+    Context.SetIntData(RPGEventKeys::OldCellY, OldCell.Y);
+    Context.SetIntData(RPGEventKeys::NewCellX, NewCell.X);
+    Context.SetIntData(RPGEventKeys::NewCellY, NewCell.Y);
+}
+
+void URPGEvent::SetContextString(FRPGEventContext& Context, FName Key, const FString& Value)
+{
+    Context.SetStringData(Key, Value);
+}
+
+FString URPGEvent::GetContextString(const FRPGEventContext& Context, FName Key, const FString& DefaultValue)
+{
+    return Context.GetStringData(Key, DefaultValue);
+}
+
+void URPGEvent::SetContextInt(FRPGEventContext& Context, FName Key, int32 Value)
+{
+    Context.SetIntData(Key, Value);
+}
+
+int32 URPGEvent::GetContextInt(const FRPGEventContext& Context, FName Key, int32 DefaultValue)
+{
+    return Context.GetIntData(Key, DefaultValue);
+}
+
+void URPGEvent::SetContextFloat(FRPGEventContext& Context, FName Key, float Value)
+{
+    Context.SetFloatData(Key, Value);
+}
+
+float URPGEvent::GetContextFloat(const FRPGEventContext& Context, FName Key, float DefaultValue)
+{
+    return Context.GetFloatData(Key, DefaultValue);
+}
+
+void URPGEvent::SetContextBool(FRPGEventContext& Context, FName Key, bool Value)
+{
+    Context.SetBoolData(Key, Value);
+}
+
+bool URPGEvent::GetContextBool(const FRPGEventContext& Context, FName Key, bool DefaultValue)
+{
+    return Context.GetBoolData(Key, DefaultValue);
+}
+
+void URPGEvent::SetContextObject(FRPGEventContext& Context, FName Key, UObject* Value)
+{
+    Context.SetObjectData(Key, Value);
+}
+
+UObject* URPGEvent::GetContextObject(const FRPGEventContext& Context, FName Key)
+{
+    return Context.GetObjectData(Key);
+}
+
+void URPGEvent::AddContextModifier(FRPGEventContext& Context, ERPGEventModifier Modifier)
+{
+    Context.AddModifier(Modifier);
+}
+
+bool URPGEvent::HasContextModifier(const FRPGEventContext& Context, ERPGEventModifier Modifier)
+{
+    return Context.HasModifier(Modifier);
+}
+
+namespace
+{
+    /** Copy every payload entry of one type into a string-keyed map */
+    template <typename ValueType, typename ReadFuncType>
+    TMap<FString, ValueType> CopyContextEntries(const FRPGEventContext& Context, ERPGEventValueType Type, ReadFuncType&& Read)
+    {
+        TMap<FString, ValueType> Result;
+        Context.Data.ForEach([Type, &Read, &Result](FName Key, ERPGEventValueType EntryType, const FRPGEventPayload& Payload, int32 Index)
+        {
+            if (EntryType == Type)
+            {
+                Result.Add(Key.ToString(), Read(Payload, Index));
+            }
+        });
+        return Result;
+    }
+
+    /** Drop every payload entry of one type, so a legacy map setter replaces the whole map */
+    void RemoveContextEntries(FRPGEventContext& Context, ERPGEventValueType Type)
+    {
+        TArray<FName, TInlineAllocator<FRPGEventPayload::InlineEntries>> Keys;
+        Context.Data.ForEach([Type, &Keys](FName Key, ERPGEventValueType EntryType, const FRPGEventPayload&, int32)
+        {
+            if (EntryType == Type)
+            {
+                Keys.Add(Key);
+            }
+        });
+
+        for (FName Key : Keys)
+        {
+            Context.Data.Remove(Key, Type);
+        }
+    }
+}
+
+TMap<FString, FString> URPGEvent::GetContextStringData(const FRPGEventContext& Context)
+{
+    return CopyContextEntries<FString>(Context, ERPGEventValueType::String,
+        [](const FRPGEventPayload& Payload, int32 Index) { return FString(Payload.GetStringAt(Index)); });
+}
+
+void URPGEvent::SetContextStringData(FRPGEventContext& Context, const TMap<FString, FString>& Values)
+{
+    RemoveContextEntries(Context, ERPGEventValueType::String);
+    for (const TPair<FString, FString>& Pair : Values)
+    {
+        Context.SetStringData(Pair.Key, Pair.Value);
+    }
+}
+
+TMap<FString, int32> URPGEvent::GetContextIntData(const FRPGEventContext& Context)
+{
+    return CopyContextEntries<int32>(Context, ERPGEventValueType::Int,
+        [](const FRPGEventPayload& Payload, int32 Index) { return Payload.GetIntAt(Index); });
+}
+
+void URPGEvent::SetContextIntData(FRPGEventContext& Context, const TMap<FString, int32>& Values)
+{
+    RemoveContextEntries(Context, ERPGEventValueType::Int);
+    for (const TPair<FString, int32>& Pair : Values)
+    {
+        Context.SetIntData(Pair.Key, Pair.Value);
+    }
+}
+
+TMap<FString, float> URPGEvent::GetContextFloatData(const FRPGEventContext& Context)
+{
+    return CopyContextEntries<float>(Context, ERPGEventValueType::Float,
+        [](const FRPGEventPayload& Payload, int32 Index) { return Payload.GetFloatAt(Index); });
+}
+
+void URPGEvent::SetContextFloatData(FRPGEventContext& Context, const TMap<FString, float>& Values)
+{
+    RemoveContextEntries(Context, ERPGEventValueType::Float);
+    for (const TPair<FString, float>& Pair : Values)
+    {
+        Context.SetFloatData(Pair.Key, Pair.Value);
+    }
+}
+
+TMap<FString, bool> URPGEvent::GetContextBoolData(const FRPGEventContext& Context)
+{
+    return CopyContextEntries<bool>(Context, ERPGEventValueType::Bool,
+        [](const FRPGEventPayload& Payload, int32 Index) { return Payload.GetBoolAt(Index); });
+}
+
+void URPGEvent::SetContextBoolData(FRPGEventContext& Context, const TMap<FString, bool>& Values)
+{
+    RemoveContextEntries(Context, ERPGEventValueType::Bool);
+    for (const TPair<FString, bool>& Pair : Values)
+    {
+        Context.SetBoolData(Pair.Key, Pair.Value);
+    }
+}
+
+TMap<FString, UObject*> URPGEvent::GetContextObjectData(const FRPGEventContext& Context)
+{
+    return CopyContextEntries<UObject*>(Context, ERPGEventValueType::Object,
+        [](const FRPGEventPayload& Payload, int32 Index) { return Payload.GetObjectAt(Index); });
+}
+
+void URPGEvent::SetContextObjectData(FRPGEventContext& Context, const TMap<FString, UObject*>& Values)
+{
+    RemoveContextEntries(Context, ERPGEventValueType::Object);
+    for (const TPair<FString, UObject*>& Pair : Values)
+    {
+        Context.SetObjectData(Pair.Key, Pair.Value);
+    }
+}
+
+TArray<ERPGEventModifier> URPGEvent::GetContextModifiers(const FRPGEventContext& Context)
+{
+    TArray<ERPGEventModifier> Modifiers;
+    for (uint32 Bits = static_cast<uint32>(Context.ModifierMask); Bits != 0; Bits &= Bits - 1)
+    {
+        Modifiers.Add(static_cast<ERPGEventModifier>(FMath::CountTrailingZeros(Bits)));
+    }
+    return Modifiers;
+}
+
+void URPGEvent::SetContextModifiers(FRPGEventContext& Context, const TArray<ERPGEventModifier>& Modifiers)
+{
+    Context.ClearModifiers();
+    for (ERPGEventModifier Modifier : Modifiers)
+    {
+        Context.AddModifier(Modifier);
+    }
+}
+
+FString URPGEvent::GetContextEventIDString(const FRPGEventContext& Context)
+{
+    return Context.EventID.ToString();
 }
 
 ERPGEventResult URPGEvent::ProcessRPGEvent(const FRPGEventContext& EventContext)
@@ -265,5 +596,30 @@ void URPGEvent::OnEventHandled(const FRPGEventContext& EventContext, ERPGEventRe
 {
     // Default implementation - derived classes can override for post-processing
     UE_LOG(LogTemp, VeryVerbose, TEXT("URPGEvent::OnEventHandled: Event %s handled with result %d"), 
-           *EventContext.EventID, static_cast<int32>(Result));
-}
\ No newline at end of file
+           *EventContext.EventID.ToString(), static_cast<int32>(Result));
+}
+
+URPGCountingEvent::URPGCountingEvent()
+    : ResultToReturn(ERPGEventResult::Handled)
+    , SimulatedWorkMicroseconds(0.0f)
+    , EventCount(0)
+{
+    bHandleAllEventTypes = true;
+}
+
+ERPGEventResult URPGCountingEvent::ProcessRPGEvent(const FRPGEventContext& EventContext)
+{
+    ++EventCount;
+    
+#if !UE_BUILD_SHIPPING
+    if (SimulatedWorkMicroseconds > 0.0f)
+    {
+        const double EndTime = FPlatformTime::Seconds() + SimulatedWorkMicroseconds * 1e-6;
+        while (FPlatformTime::Seconds() < EndTime)
+        {
+        }
+    }
+#endif
+    
+    return ResultToReturn;
+}
@@ -9,6 +9,7 @@
 
 // Forward declarations
 class URPGEventBusSubsystem;
+class FRPGEventArena;
 
 /**
  * Delegate types for event handling
@@ -106,6 +107,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "RPG Event")
     static bool PublishEventToSubsystem(URPGEventBusSubsystem* EventBus, const FRPGEventContext& EventContext);
 
+    /**
+     * Queue an event for the event bus's next flush instead of dispatching it now
+     * Use from inside handlers to chain events (e.g. BeforeAttackRoll -> OnAttackRoll) without recursing
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Event")
+    static bool QueueEvent(const FRPGEventContext& EventContext);
+
     // Event subscription helpers
     UFUNCTION(BlueprintCallable, Category = "RPG Event")
     static bool SubscribeToEventType(ERPGEventType EventType, TScriptInterface<IRPGEventInterface> Handler);
@@ -113,6 +121,11 @@ public:
     UFUNCTION(BlueprintCallable, Category = "RPG Event")
     static bool UnsubscribeFromEventType(ERPGEventType EventType, TScriptInterface<IRPGEventInterface> Handler);
 
+    /** Subscribe Handler to EventType for one entity only (see URPGEventBusSubsystem::SubscribeEntityHandler) */
+    UFUNCTION(BlueprintCallable, Category = "RPG Event")
+    static bool SubscribeToEntityEvents(ERPGEventType EventType, const FString& EntityID, ERPGEventEntityScope Scope,
+                                        TScriptInterface<IRPGEventInterface> Handler);
+
     // Convenience methods for common events
     UFUNCTION(BlueprintCallable, Category = "RPG Event")
     static FRPGEventContext CreateEntityEvent(ERPGEventType EventType, TScriptInterface<IRPGEntityInterface> Entity);
@@ -126,12 +139,113 @@ public:
                                              TScriptInterface<IRPGEntityInterface> Attacker,
                                              TScriptInterface<IRPGEntityInterface> Defender);
 
+    /** EntityMoved event carrying the entity's old and new grid cells (applied to URPGEntitySubsystem's spatial index) */
+    UFUNCTION(BlueprintCallable, Category = "RPG Event")
+    static FRPGEventContext CreateMoveEvent(TScriptInterface<IRPGEntityInterface> Entity, FIntPoint OldCell, FIntPoint NewCell);
+
+    // Arena variants - the context lives in Arena until its next ResetFrame (Retain to keep it longer)
+    static FRPGEventContext& CreateEntityEvent(FRPGEventArena& Arena, ERPGEventType EventType, TScriptInterface<IRPGEntityInterface> Entity);
+    static FRPGEventContext& CreateDiceRollEvent(FRPGEventArena& Arena, TScriptInterface<IRPGEntityInterface> RollerEntity, int32 Sides, int32 Result);
+    static FRPGEventContext& CreateCombatEvent(FRPGEventArena& Arena, ERPGEventType EventType,
+                                              TScriptInterface<IRPGEntityInterface> Attacker,
+                                              TScriptInterface<IRPGEntityInterface> Defender);
+    static FRPGEventContext& CreateMoveEvent(FRPGEventArena& Arena, TScriptInterface<IRPGEntityInterface> Entity, FIntPoint OldCell, FIntPoint NewCell);
+
+    // Event context data helpers - Blueprint access to the context's key/value payload
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data")
+    static void SetContextString(UPARAM(ref) FRPGEventContext& Context, FName Key, const FString& Value);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data")
+    static FString GetContextString(const FRPGEventContext& Context, FName Key, const FString& DefaultValue);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data")
+    static void SetContextInt(UPARAM(ref) FRPGEventContext& Context, FName Key, int32 Value);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data")
+    static int32 GetContextInt(const FRPGEventContext& Context, FName Key, int32 DefaultValue = 0);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data")
+    static void SetContextFloat(UPARAM(ref) FRPGEventContext& Context, FName Key, float Value);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data")
+    static float GetContextFloat(const FRPGEventContext& Context, FName Key, float DefaultValue = 0.0f);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data")
+    static void SetContextBool(UPARAM(ref) FRPGEventContext& Context, FName Key, bool Value);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data")
+    static bool GetContextBool(const FRPGEventContext& Context, FName Key, bool DefaultValue = false);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data")
+    static void SetContextObject(UPARAM(ref) FRPGEventContext& Context, FName Key, UObject* Value);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data")
+    static UObject* GetContextObject(const FRPGEventContext& Context, FName Key);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data")
+    static void AddContextModifier(UPARAM(ref) FRPGEventContext& Context, ERPGEventModifier Modifier);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data")
+    static bool HasContextModifier(const FRPGEventContext& Context, ERPGEventModifier Modifier);
+
+    // Legacy shapes of the context - FRPGEventContext used to expose these as the StringData, IntData, FloatData,
+    // BoolData, ObjectData and Modifiers properties and a string EventID. Blueprints that broke or set those pins
+    // migrate to these nodes one-for-one; each call copies the payload, so prefer the keyed helpers above
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data|Legacy")
+    static TMap<FString, FString> GetContextStringData(const FRPGEventContext& Context);
+
+    /** Replaces every string entry, like assigning the old StringData map */
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data|Legacy")
+    static void SetContextStringData(UPARAM(ref) FRPGEventContext& Context, const TMap<FString, FString>& Values);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data|Legacy")
+    static TMap<FString, int32> GetContextIntData(const FRPGEventContext& Context);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data|Legacy")
+    static void SetContextIntData(UPARAM(ref) FRPGEventContext& Context, const TMap<FString, int32>& Values);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data|Legacy")
+    static TMap<FString, float> GetContextFloatData(const FRPGEventContext& Context);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data|Legacy")
+    static void SetContextFloatData(UPARAM(ref) FRPGEventContext& Context, const TMap<FString, float>& Values);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data|Legacy")
+    static TMap<FString, bool> GetContextBoolData(const FRPGEventContext& Context);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data|Legacy")
+    static void SetContextBoolData(UPARAM(ref) FRPGEventContext& Context, const TMap<FString, bool>& Values);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data|Legacy")
+    static TMap<FString, UObject*> GetContextObjectData(const FRPGEventContext& Context);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data|Legacy")
+    static void SetContextObjectData(UPARAM(ref) FRPGEventContext& Context, const TMap<FString, UObject*>& Values);
+
+    /** Active modifiers in enum order */
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data|Legacy")
+    static TArray<ERPGEventModifier> GetContextModifiers(const FRPGEventContext& Context);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Event|Context Data|Legacy")
+    static void SetContextModifiers(UPARAM(ref) FRPGEventContext& Context, const TArray<ERPGEventModifier>& Modifiers);
+
+    /** EventID in the string form the old FString EventID held */
+    UFUNCTION(BlueprintPure, Category = "RPG Event|Context Data|Legacy")
+    static FString GetContextEventIDString(const FRPGEventContext& Context);
+
 protected:
     // Override these in derived classes for specific event handling
     virtual ERPGEventResult ProcessRPGEvent(const FRPGEventContext& EventContext);
     virtual bool CanHandleEvent(const FRPGEventContext& EventContext) const;
     virtual void OnEventHandled(const FRPGEventContext& EventContext, ERPGEventResult Result);
 
+    // Shared by the by-value and arena event helpers
+    static void InitEntityEvent(FRPGEventContext& Context, const TScriptInterface<IRPGEntityInterface>& Entity);
+    static void InitDiceRollEvent(FRPGEventContext& Context, int32 Sides, int32 Result);
+    static void InitCombatEvent(FRPGEventContext& Context, const TScriptInterface<IRPGEntityInterface>& Attacker,
+                                const TScriptInterface<IRPGEntityInterface>& Defender);
+    static void InitMoveEvent(FRPGEventContext& Context, const TScriptInterface<IRPGEntityInterface>& Entity, FIntPoint OldCell, FIntPoint NewCell);
+
     // Event type filtering
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "RPG Event Configuration")
     TArray<ERPGEventType> HandledEventTypes;
@@ -147,6 +261,37 @@ private:
     bool bIsProcessingEvent;
 };
 
+/**
+ * Handler that counts the events it receives, for the rpg.Bench.* event bus benchmarks
+ * Native only and hidden from class pickers so gameplay content cannot subscribe it; the simulated work
+ * busy-wait is compiled out of shipping builds.
+ */
+UCLASS(NotBlueprintable, NotBlueprintType, HideDropdown, Transient)
+class SESHAT_API URPGCountingEvent : public URPGEvent
+{
+    GENERATED_BODY()
+
+public:
+    URPGCountingEvent();
+
+    int32 GetEventCount() const { return EventCount; }
+
+    void ResetEventCount() { EventCount = 0; }
+
+    /** Result returned for every event (Handled by default) */
+    ERPGEventResult ResultToReturn;
+
+    /** Busy-wait per event, to stand in for a handler that does real work (development builds only) */
+    float SimulatedWorkMicroseconds;
+
+protected:
+    virtual ERPGEventResult ProcessRPGEvent(const FRPGEventContext& EventContext) override;
+    virtual void OnEventHandled(const FRPGEventContext& EventContext, ERPGEventResult Result) override {}
+
+private:
+    int32 EventCount;
+};
+
 /**
  * Event handler subscription information
  * Used internally by the event bus to manage subscriptions
@@ -173,11 +318,10 @@ struct SESHAT_API FRPGEventSubscription
         , ExpirationTime(0.0)
         , bIsActive(true)
     {
-        SubscriptionID = FGuid::NewGuid().ToString();
     }
 
     UPROPERTY(BlueprintReadOnly, Category = "RPG Event Subscription")
-    FString SubscriptionID;
+    FRPGEventHandle SubscriptionHandle;
 
     UPROPERTY(BlueprintReadOnly, Category = "RPG Event Subscription")
     TScriptInterface<IRPGEventInterface> Handler;
@@ -0,0 +1,153 @@
+#include "RPGEventArena.h"
+#include "UObject/GarbageCollection.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Arena Frame Contexts"), STAT_RPGEventArenaFrameContexts, STATGROUP_RPGEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Arena Peak Frame Contexts"), STAT_RPGEventArenaPeakFrameContexts, STATGROUP_RPGEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Arena Retained Contexts"), STAT_RPGEventArenaRetained, STATGROUP_RPGEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Arena Capacity"), STAT_RPGEventArenaCapacity, STATGROUP_RPGEvents);
+DECLARE_MEMORY_STAT(TEXT("Arena Memory"), STAT_RPGEventArenaMemory, STATGROUP_RPGEvents);
+
+namespace
+{
+    /** Drop a dead context's object references (entities and object payload entries), keeping its storage */
+    void ClearObjectReferences(FRPGEventContext& Context)
+    {
+        Context.SourceEntity = nullptr;
+        Context.TargetEntity = nullptr;
+        Context.AdditionalEntities.Reset();
+        Context.Data.Reset();
+    }
+}
+
+FRPGEventArena::~FRPGEventArena()
+{
+    for (FChunk* Chunk : Chunks)
+    {
+        delete Chunk;
+    }
+}
+
+FRPGEventContext& FRPGEventArena::Acquire(ERPGEventType EventType, TScriptInterface<IRPGEntityInterface> Source)
+{
+    // Skip contexts retained from earlier frames
+    const int32 Capacity = Chunks.Num() * ContextsPerChunk;
+    while (Cursor < Capacity && Chunks[Cursor / ContextsPerChunk]->Slots[Cursor % ContextsPerChunk].bRetained)
+    {
+        ++Cursor;
+    }
+
+    if (Cursor >= Capacity)
+    {
+        Chunks.Add(new FChunk());
+        Stats.Capacity = Chunks.Num() * ContextsPerChunk;
+        Stats.ReservedBytes = static_cast<int64>(Chunks.Num()) * sizeof(FChunk);
+    }
+
+    FSlot& Slot = Chunks[Cursor / ContextsPerChunk]->Slots[Cursor % ContextsPerChunk];
+    Slot.bLive = true;
+    ++Cursor;
+
+    // Reset keeps the slot's payload and entity storage for reuse
+    FRPGEventContext& Context = Slot.Context;
+    Context.Reset();
+    Context.EventType = EventType;
+    Context.SourceEntity = Source;
+
+    ++Stats.FrameContexts;
+    ++Stats.TotalContexts;
+    return Context;
+}
+
+FRPGEventArena::FSlot* FRPGEventArena::FindSlot(const FRPGEventContext& Context) const
+{
+    const UPTRINT Address = reinterpret_cast<UPTRINT>(&Context);
+    for (FChunk* Chunk : Chunks)
+    {
+        const UPTRINT Begin = reinterpret_cast<UPTRINT>(&Chunk->Slots[0]);
+        const UPTRINT End = reinterpret_cast<UPTRINT>(&Chunk->Slots[ContextsPerChunk]);
+        if (Address >= Begin && Address < End && (Address - Begin) % sizeof(FSlot) == 0)
+        {
+            return &Chunk->Slots[(Address - Begin) / sizeof(FSlot)];
+        }
+    }
+    return nullptr;
+}
+
+bool FRPGEventArena::Owns(const FRPGEventContext& Context) const
+{
+    return FindSlot(Context) != nullptr;
+}
+
+bool FRPGEventArena::Retain(const FRPGEventContext& Context)
+{
+    FSlot* Slot = FindSlot(Context);
+    if (!Slot)
+    {
+        return false;
+    }
+
+    if (!Slot->bRetained)
+    {
+        Slot->bRetained = true;
+        ++Stats.Retained;
+    }
+    return true;
+}
+
+bool FRPGEventArena::Release(const FRPGEventContext& Context)
+{
+    FSlot* Slot = FindSlot(Context);
+    if (!Slot || !Slot->bRetained)
+    {
+        return false;
+    }
+
+    Slot->bRetained = false;
+    --Stats.Retained;
+    return true;
+}
+
+void FRPGEventArena::ResetFrame()
+{
+    // Dead slots must not hold objects the GC no longer sees through AddReferencedObjects
+    for (FChunk* Chunk : Chunks)
+    {
+        for (FSlot& Slot : Chunk->Slots)
+        {
+            if (Slot.bLive && !Slot.bRetained)
+            {
+                ClearObjectReferences(Slot.Context);
+                Slot.bLive = false;
+            }
+        }
+    }
+
+    Stats.PeakFrameContexts = FMath::Max(Stats.PeakFrameContexts, Stats.FrameContexts);
+    Stats.FrameContexts = 0;
+    ++Stats.FrameResets;
+    Cursor = 0;
+}
+
+void FRPGEventArena::PublishStats() const
+{
+    SET_DWORD_STAT(STAT_RPGEventArenaFrameContexts, Stats.FrameContexts);
+    SET_DWORD_STAT(STAT_RPGEventArenaPeakFrameContexts, Stats.PeakFrameContexts);
+    SET_DWORD_STAT(STAT_RPGEventArenaRetained, Stats.Retained);
+    SET_DWORD_STAT(STAT_RPGEventArenaCapacity, Stats.Capacity);
+    SET_MEMORY_STAT(STAT_RPGEventArenaMemory, Stats.ReservedBytes);
+}
+
+void FRPGEventArena::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    // Slots go dead at ResetFrame, which also clears their references - only live contexts keep objects alive
+    for (FChunk* Chunk : Chunks)
+    {
+        for (FSlot& Slot : Chunk->Slots)
+        {
+            if (Slot.bLive)
+            {
+                Collector.AddPropertyReferencesWithStructARO(FRPGEventContext::StaticStruct(), &Slot.Context);
+            }
+        }
+    }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "UObject/GCObject.h"
+#include "RPGEventContext.h"
+#include "RPGEventArena.generated.h"
+
+DECLARE_STATS_GROUP(TEXT("RPG Events"), STATGROUP_RPGEvents, STATCAT_Advanced);
+
+/**
+ * Event arena counters
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGEventArenaStats
+{
+    GENERATED_BODY()
+
+    /** Contexts handed out since the last frame reset */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Arena")
+    int32 FrameContexts = 0;
+
+    /** Most contexts handed out in one frame */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Arena")
+    int32 PeakFrameContexts = 0;
+
+    /** Contexts retained past their frame and not yet released */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Arena")
+    int32 Retained = 0;
+
+    /** Context slots allocated (never shrinks) */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Arena")
+    int32 Capacity = 0;
+
+    /** Slot memory, excluding payloads that spilled to the heap */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Arena")
+    int64 ReservedBytes = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Arena")
+    int64 TotalContexts = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Arena")
+    int64 FrameResets = 0;
+};
+
+/**
+ * Per-frame bump allocator for FRPGEventContext
+ * Acquire hands out the next free slot of a chunked slot array; ResetFrame releases every frame context at once
+ * by rewinding the cursor. Slots are reused rather than destroyed, so payload, entity array and any spilled
+ * storage carry over and steady-state frames do not touch the heap. Chunks never move, so a context's
+ * address is stable for as long as it is live.
+ *
+ * A context that must outlive its frame (queued, deferred or held by gameplay code) is Retained: the frame
+ * reset skips it until Release. Game thread only.
+ */
+class SESHAT_API FRPGEventArena
+{
+public:
+    static constexpr int32 ContextsPerChunk = 64;
+
+    FRPGEventArena() = default;
+    ~FRPGEventArena();
+
+    FRPGEventArena(const FRPGEventArena&) = delete;
+    FRPGEventArena& operator=(const FRPGEventArena&) = delete;
+
+    /** A cleared context (fresh EventID and timestamp) valid until the next ResetFrame */
+    FRPGEventContext& Acquire(ERPGEventType EventType = ERPGEventType::Unknown, TScriptInterface<IRPGEntityInterface> Source = nullptr);
+
+    /** Keep an arena context alive past ResetFrame; false if Context is not from this arena */
+    bool Retain(const FRPGEventContext& Context);
+
+    /** Return a retained context to the arena (it is recycled after the next ResetFrame) */
+    bool Release(const FRPGEventContext& Context);
+
+    /** Whether Context lives in this arena */
+    bool Owns(const FRPGEventContext& Context) const;
+
+    /** Release every unretained context, dropping the object references it held */
+    void ResetFrame();
+
+    const FRPGEventArenaStats& GetStats() const { return Stats; }
+
+    /** Push the current counters to the STATGROUP_RPGEvents stats */
+    void PublishStats() const;
+
+    /** Report objects referenced by live (this frame's or retained) contexts; call from the owner's AddReferencedObjects */
+    void AddReferencedObjects(FReferenceCollector& Collector);
+
+private:
+    struct FSlot
+    {
+        FRPGEventContext Context;
+        bool bRetained = false;
+
+        /** Handed out since the last ResetFrame, or retained across it */
+        bool bLive = false;
+    };
+
+    struct FChunk
+    {
+        FSlot Slots[ContextsPerChunk];
+    };
+
+    /** Slot for a context address, nullptr if not ours */
+    FSlot* FindSlot(const FRPGEventContext& Context) const;
+
+    TArray<FChunk*> Chunks;
+
+    /** Next slot to try, as a flat index across chunks */
+    int32 Cursor = 0;
+
+    FRPGEventArenaStats Stats;
+};
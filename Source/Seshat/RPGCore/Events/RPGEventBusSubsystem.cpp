@@ -1,6 +1,133 @@
 #include "RPGEventBusSubsystem.h"
-#include "HAL/PlatformProcess.h"
-#include "Misc/Paths.h"
+#include "../Toolkit/RPGToolkitModule.h"
+#include "../Toolkit/RPGToolkitExecutor.h"
+#include "RPGEventDispatcher.h"
+#include "RPGEventQueue.h"
+#include "RPGEventWireFormat.h"
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+#include "Misc/App.h"
+#include "../RPGAllocationCounter.h"
+#include "../RPGBenchCommands.h"
+#include "HAL/PlatformTime.h"
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    /** FRPGEventContext's data layout before the inline payload, kept for BenchmarkEventContext */
+    struct FLegacyEventContext
+    {
+        FString EventID;
+        FString EventName;
+        TArray<ERPGEventModifier> Modifiers;
+        TMap<FString, FString> StringData;
+        TMap<FString, int32> IntData;
+        TMap<FString, float> FloatData;
+        TMap<FString, bool> BoolData;
+    };
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchEventDispatchCommand(
+        TEXT("rpg.Bench.EventDispatch"),
+        TEXT("rpg.Bench.EventDispatch [NumHandlers=16] [NumEvents=100000] - publish throughput to counting handlers on a private dispatcher"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEventBusSubsystem* EventBus = RPGBench::FindSubsystem<URPGEventBusSubsystem>(World, Ar))
+            {
+                Ar.Log(EventBus->BenchmarkEventDispatch(RPGBench::IntArg(Args, 0, 16), RPGBench::IntArg(Args, 1, 100000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchEventQueueCommand(
+        TEXT("rpg.Bench.EventQueue"),
+        TEXT("rpg.Bench.EventQueue [NumHandlers=16] [NumEvents=100000] - queue mixed-priority events and drain them under the current queue settings"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEventBusSubsystem* EventBus = RPGBench::FindSubsystem<URPGEventBusSubsystem>(World, Ar))
+            {
+                Ar.Log(EventBus->BenchmarkEventQueue(RPGBench::IntArg(Args, 0, 16), RPGBench::IntArg(Args, 1, 100000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchEventContextCommand(
+        TEXT("rpg.Bench.EventContext"),
+        TEXT("rpg.Bench.EventContext [NumEvents=10000] - heap allocations per combat event, old map layout against the inline payload"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEventBusSubsystem* EventBus = RPGBench::FindSubsystem<URPGEventBusSubsystem>(World, Ar))
+            {
+                Ar.Log(EventBus->BenchmarkEventContext(RPGBench::IntArg(Args, 0, 10000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchEventArenaCommand(
+        TEXT("rpg.Bench.EventArena"),
+        TEXT("rpg.Bench.EventArena [EventsPerFrame=256] [NumFrames=60] - heap allocations per event, by-value CreateCombatEvent against the arena overload"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEventBusSubsystem* EventBus = RPGBench::FindSubsystem<URPGEventBusSubsystem>(World, Ar))
+            {
+                Ar.Log(EventBus->BenchmarkEventArena(RPGBench::IntArg(Args, 0, 256), RPGBench::IntArg(Args, 1, 60)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchCheckEventWireRoundTripCommand(
+        TEXT("rpg.Bench.CheckEventWireRoundTrip"),
+        TEXT("rpg.Bench.CheckEventWireRoundTrip - encode/decode an event with every value type in C++ and through the Go codec"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEventBusSubsystem* EventBus = RPGBench::FindSubsystem<URPGEventBusSubsystem>(World, Ar))
+            {
+                Ar.Log(EventBus->CheckEventWireRoundTrip());
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchEventWireCommand(
+        TEXT("rpg.Bench.EventWire"),
+        TEXT("rpg.Bench.EventWire [NumEvents=10000] - binary wire encode/decode against the Printf JSON string path"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEventBusSubsystem* EventBus = RPGBench::FindSubsystem<URPGEventBusSubsystem>(World, Ar))
+            {
+                Ar.Log(EventBus->BenchmarkEventWire(RPGBench::IntArg(Args, 0, 10000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchEntityRoutingCommand(
+        TEXT("rpg.Bench.EntityRouting"),
+        TEXT("rpg.Bench.EntityRouting [NumEntities=500] [NumEvents=10000] - global subscriptions against entity-scoped ones for per-entity handlers"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEventBusSubsystem* EventBus = RPGBench::FindSubsystem<URPGEventBusSubsystem>(World, Ar))
+            {
+                Ar.Log(EventBus->BenchmarkEntityRouting(RPGBench::IntArg(Args, 0, 500), RPGBench::IntArg(Args, 1, 10000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchReadOnlyHandlersCommand(
+        TEXT("rpg.Bench.ReadOnlyHandlers"),
+        TEXT("rpg.Bench.ReadOnlyHandlers [NumHandlers=64] [NumEvents=1000] [WorkMicroseconds=2] - game-thread observers against read-only handlers on the task graph"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEventBusSubsystem* EventBus = RPGBench::FindSubsystem<URPGEventBusSubsystem>(World, Ar))
+            {
+                Ar.Log(EventBus->BenchmarkReadOnlyHandlers(RPGBench::IntArg(Args, 0, 64), RPGBench::IntArg(Args, 1, 1000), RPGBench::FloatArg(Args, 2, 2.0f)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchCombatRoundAllocationsCommand(
+        TEXT("rpg.Bench.CombatRoundAllocations"),
+        TEXT("rpg.Bench.CombatRoundAllocations [NumCombatants=8] [NumRounds=100] - heap allocations per combat round with string against compact entity IDs"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGEventBusSubsystem* EventBus = RPGBench::FindSubsystem<URPGEventBusSubsystem>(World, Ar))
+            {
+                Ar.Log(EventBus->BenchmarkCombatRoundAllocations(RPGBench::IntArg(Args, 0, 8), RPGBench::IntArg(Args, 1, 100)));
+            }
+        }));
+}
+#endif
 
 void URPGEventBusSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -8,74 +135,42 @@ void URPGEventBusSubsystem::Initialize(FSubsystemCollectionBase& Collection)
     
     UE_LOG(LogTemp, Warning, TEXT("RPGEventBusSubsystem: Initializing"));
     
-    // Initialize all function pointers to nullptr
     bFunctionsLoaded = false;
-    ToolkitDLLHandle = nullptr;
-    
-    // Initialize all function pointers
-    CreateEventBusFuncPtr = nullptr;
-    PublishEventFuncPtr = nullptr;
-    SubscribeEventFuncPtr = nullptr;
-    UnsubscribeEventFuncPtr = nullptr;
-    
-    GetEventBeforeAttackRollFuncPtr = nullptr;
-    GetEventOnAttackRollFuncPtr = nullptr;
-    GetEventAfterAttackRollFuncPtr = nullptr;
-    GetEventBeforeDamageRollFuncPtr = nullptr;
-    GetEventOnTakeDamageFuncPtr = nullptr;
-    GetEventCalculateDamageFuncPtr = nullptr;
-    GetEventAfterDamageFuncPtr = nullptr;
-    GetEventEntityPlacedFuncPtr = nullptr;
-    GetEventEntityMovedFuncPtr = nullptr;
-    GetEventRoomCreatedFuncPtr = nullptr;
-    GetEventTurnStartFuncPtr = nullptr;
-    GetEventTurnEndFuncPtr = nullptr;
-    GetEventRoundStartFuncPtr = nullptr;
-    GetEventRoundEndFuncPtr = nullptr;
-    GetEventStatusAppliedFuncPtr = nullptr;
-    GetEventStatusRemovedFuncPtr = nullptr;
-    GetEventStatusCheckFuncPtr = nullptr;
-    
-    GetContextKeyAttackerFuncPtr = nullptr;
-    GetContextKeyTargetFuncPtr = nullptr;
-    GetContextKeyWeaponFuncPtr = nullptr;
-    GetContextKeyDamageTypeFuncPtr = nullptr;
-    GetContextKeyAdvantageFuncPtr = nullptr;
-    GetContextKeyRollFuncPtr = nullptr;
-    GetContextKeyOldPositionFuncPtr = nullptr;
-    GetContextKeyNewPositionFuncPtr = nullptr;
-    GetContextKeyRoomIDFuncPtr = nullptr;
-    
-    CreateModifierFuncPtr = nullptr;
-    CreateIntModifierFuncPtr = nullptr;
-    CreateDiceModifierFuncPtr = nullptr;
-    
-    GetDurationPermanentFuncPtr = nullptr;
-    GetDurationRoundsFuncPtr = nullptr;
-    GetDurationMinutesFuncPtr = nullptr;
-    GetDurationHoursFuncPtr = nullptr;
-    GetDurationEncounterFuncPtr = nullptr;
-    GetDurationConcentrationFuncPtr = nullptr;
-    GetDurationShortRestFuncPtr = nullptr;
-    GetDurationLongRestFuncPtr = nullptr;
-    GetDurationUntilDamagedFuncPtr = nullptr;
-    GetDurationUntilSaveFuncPtr = nullptr;
-    
-    FreeEventStringFuncPtr = nullptr;
-    
-    // Load DLL functions
-    LoadDLLFunctions();
+    Toolkit = nullptr;
+    Profiler = MakeShared<FRPGEventProfiler>(GetGameInstance() ? GetGameInstance()->GetName() : GetName());
+    Dispatcher = MakeShared<FRPGEventDispatcher>();
+    Dispatcher->SetProfiler(Profiler.Get());
+    EventArena = MakeShared<FRPGEventArena>();
+    EventQueue = MakeShared<FRPGEventQueue>(*EventArena);
+    BindFlushPhase(EventQueue->Settings.FlushPhase);
+    EndFrameHandle = FCoreDelegates::OnEndFrame.AddUObject(this, &URPGEventBusSubsystem::HandleEndFrame);
+    PreGarbageCollectHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &URPGEventBusSubsystem::HandlePreGarbageCollect);
+    
+    // Borrow the shared toolkit function table
+    BindToolkitFunctions();
     
     if (bFunctionsLoaded)
     {
         UE_LOG(LogTemp, Warning, TEXT("RPGEventBusSubsystem: Successfully initialized"));
         
         // Create event bus instance
-        if (CreateEventBusFuncPtr)
+        if (Toolkit->CreateEventBus)
         {
             FString Result = CreateEventBus();
             UE_LOG(LogTemp, Warning, TEXT("RPGEventBusSubsystem: EventBus created: %s"), *Result);
         }
+        
+        // Let toolkit subscribers call back into UE
+        if (Toolkit->RegisterEventCallback)
+        {
+            ToolkitInbox = MakeShared<FRPGToolkitEventInbox>();
+            if (!Toolkit->RegisterEventCallback(&FRPGToolkitEventInbox::Receive, ToolkitInbox.Get()))
+            {
+                // The toolkit bus is process-wide and another world (e.g. a second PIE client) owns its callback
+                UE_LOG(LogTemp, Error, TEXT("RPGEventBusSubsystem: Toolkit event callback is owned by another subsystem - toolkit events will not reach this world"));
+                ToolkitInbox.Reset();
+            }
+        }
     }
     else
     {
@@ -87,539 +182,1437 @@ void URPGEventBusSubsystem::Deinitialize()
 {
     UE_LOG(LogTemp, Warning, TEXT("RPGEventBusSubsystem: Deinitializing"));
     
-    // Clear all function pointers
-    CreateEventBusFuncPtr = nullptr;
-    PublishEventFuncPtr = nullptr;
-    SubscribeEventFuncPtr = nullptr;
-    UnsubscribeEventFuncPtr = nullptr;
-    
-    GetEventBeforeAttackRollFuncPtr = nullptr;
-    GetEventOnAttackRollFuncPtr = nullptr;
-    GetEventAfterAttackRollFuncPtr = nullptr;
-    GetEventBeforeDamageRollFuncPtr = nullptr;
-    GetEventOnTakeDamageFuncPtr = nullptr;
-    GetEventCalculateDamageFuncPtr = nullptr;
-    GetEventAfterDamageFuncPtr = nullptr;
-    GetEventEntityPlacedFuncPtr = nullptr;
-    GetEventEntityMovedFuncPtr = nullptr;
-    GetEventRoomCreatedFuncPtr = nullptr;
-    GetEventTurnStartFuncPtr = nullptr;
-    GetEventTurnEndFuncPtr = nullptr;
-    GetEventRoundStartFuncPtr = nullptr;
-    GetEventRoundEndFuncPtr = nullptr;
-    GetEventStatusAppliedFuncPtr = nullptr;
-    GetEventStatusRemovedFuncPtr = nullptr;
-    GetEventStatusCheckFuncPtr = nullptr;
-    
-    GetContextKeyAttackerFuncPtr = nullptr;
-    GetContextKeyTargetFuncPtr = nullptr;
-    GetContextKeyWeaponFuncPtr = nullptr;
-    GetContextKeyDamageTypeFuncPtr = nullptr;
-    GetContextKeyAdvantageFuncPtr = nullptr;
-    GetContextKeyRollFuncPtr = nullptr;
-    GetContextKeyOldPositionFuncPtr = nullptr;
-    GetContextKeyNewPositionFuncPtr = nullptr;
-    GetContextKeyRoomIDFuncPtr = nullptr;
-    
-    CreateModifierFuncPtr = nullptr;
-    CreateIntModifierFuncPtr = nullptr;
-    CreateDiceModifierFuncPtr = nullptr;
-    
-    GetDurationPermanentFuncPtr = nullptr;
-    GetDurationRoundsFuncPtr = nullptr;
-    GetDurationMinutesFuncPtr = nullptr;
-    GetDurationHoursFuncPtr = nullptr;
-    GetDurationEncounterFuncPtr = nullptr;
-    GetDurationConcentrationFuncPtr = nullptr;
-    GetDurationShortRestFuncPtr = nullptr;
-    GetDurationLongRestFuncPtr = nullptr;
-    GetDurationUntilDamagedFuncPtr = nullptr;
-    GetDurationUntilSaveFuncPtr = nullptr;
-    
-    FreeEventStringFuncPtr = nullptr;
+    // Unregister before freeing the inbox - once this returns no Go thread is inside the callback
+    if (ToolkitInbox.IsValid())
+    {
+        if (Toolkit && Toolkit->RegisterEventCallback)
+        {
+            Toolkit->RegisterEventCallback(nullptr, ToolkitInbox.Get());
+        }
+        if (ToolkitInbox->Num() > 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("RPGEventBusSubsystem: Dropping %d undelivered toolkit events"), ToolkitInbox->Num());
+        }
+        ToolkitInbox.Reset();
+    }
+    
+    // Stop flushing before the queue and dispatcher go away; still-queued events are dropped
+    BindFlushPhase(ERPGEventFlushPhase::Manual);
+    FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+    EndFrameHandle.Reset();
+    FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGarbageCollectHandle);
+    PreGarbageCollectHandle.Reset();
+    if (EventQueue.IsValid() && EventQueue->Num() > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RPGEventBusSubsystem: Dropping %d queued events"), EventQueue->Num());
+    }
+    EventQueue.Reset();
+    EventArena.Reset();
+    
+    // Release the executor first so queued publishes reach the toolkit
+    if (Executor)
+    {
+        FRPGToolkitExecutor::Release(TEXT("RPGEventBusSubsystem"));
+        Executor = nullptr;
+    }
+    
+    // Return the shared function table
+    if (Toolkit)
+    {
+        FRPGToolkitModule::Release(TEXT("RPGEventBusSubsystem"));
+    }
     
     bFunctionsLoaded = false;
-    ToolkitDLLHandle = nullptr;
+    Toolkit = nullptr;
+    Dispatcher.Reset();
+    Profiler.Reset();
     
     Super::Deinitialize();
 }
 
+void URPGEventBusSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+    URPGEventBusSubsystem* This = CastChecked<URPGEventBusSubsystem>(InThis);
+    if (This->EventArena.IsValid())
+    {
+        This->EventArena->AddReferencedObjects(Collector);
+    }
+    
+    Super::AddReferencedObjects(InThis, Collector);
+}
+
 // EventBus Management Functions Implementation
 FString URPGEventBusSubsystem::CreateEventBus()
 {
-    if (!IsSafeToCallFunction() || !CreateEventBusFuncPtr)
+    if (!IsSafeToCallFunction() || !Toolkit->CreateEventBus)
     {
         return TEXT("ERROR: Function not available");
     }
     
-    ANSICHAR* CStr = CreateEventBusFuncPtr();
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitGameThreadCall);
+    ANSICHAR* CStr = Toolkit->CreateEventBus();
     return ConvertAndFreeString(CStr);
 }
 
 bool URPGEventBusSubsystem::PublishEvent(const FString& EventType, const FString& SourceID, const FString& TargetID, const FString& ContextData)
 {
-    if (!IsSafeToCallFunction() || !PublishEventFuncPtr)
+    if (!IsSafeToCallFunction() || !Toolkit->PublishEvent)
     {
         return false;
     }
     
-    return PublishEventFuncPtr(TCHAR_TO_ANSI(*EventType), TCHAR_TO_ANSI(*SourceID), TCHAR_TO_ANSI(*TargetID), TCHAR_TO_ANSI(*ContextData)) != 0;
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitGameThreadCall);
+    return Toolkit->PublishEvent(TCHAR_TO_ANSI(*EventType), TCHAR_TO_ANSI(*SourceID), TCHAR_TO_ANSI(*TargetID), TCHAR_TO_ANSI(*ContextData)) != 0;
 }
 
-FString URPGEventBusSubsystem::SubscribeEvent(const FString& EventType, int32 Priority)
+TFuture<bool> URPGEventBusSubsystem::PublishEventAsync(const FString& EventType, const FString& SourceID, const FString& TargetID, const FString& ContextData, bool bBatchPerFrame)
 {
-    if (!IsSafeToCallFunction() || !SubscribeEventFuncPtr)
+    if (!IsSafeToCallFunction() || !Toolkit->PublishEvent || !Executor)
     {
-        return TEXT("");
+        return MakeFulfilledPromise<bool>(false).GetFuture();
     }
     
-    ANSICHAR* CStr = SubscribeEventFuncPtr(TCHAR_TO_ANSI(*EventType), Priority);
-    return ConvertAndFreeString(CStr);
+    return Executor->Submit<bool>([EventType, SourceID, TargetID, ContextData](const FRPGToolkitAPI& API)
+    {
+        return API.PublishEvent && API.PublishEvent(TCHAR_TO_ANSI(*EventType), TCHAR_TO_ANSI(*SourceID), TCHAR_TO_ANSI(*TargetID), TCHAR_TO_ANSI(*ContextData)) != 0;
+    }, bBatchPerFrame);
 }
 
-bool URPGEventBusSubsystem::UnsubscribeEvent(const FString& SubscriptionID)
+void URPGEventBusSubsystem::PublishEventAsync(const FString& EventType, const FString& SourceID, const FString& TargetID, const FString& ContextData, TUniqueFunction<void(bool)> OnComplete, bool bBatchPerFrame)
 {
-    if (!IsSafeToCallFunction() || !UnsubscribeEventFuncPtr)
+    if (!IsSafeToCallFunction() || !Toolkit->PublishEvent || !Executor)
     {
-        return false;
+        OnComplete(false);
+        return;
     }
     
-    return UnsubscribeEventFuncPtr(TCHAR_TO_ANSI(*SubscriptionID)) != 0;
+    Executor->SubmitThen<bool>([EventType, SourceID, TargetID, ContextData](const FRPGToolkitAPI& API)
+    {
+        return API.PublishEvent && API.PublishEvent(TCHAR_TO_ANSI(*EventType), TCHAR_TO_ANSI(*SourceID), TCHAR_TO_ANSI(*TargetID), TCHAR_TO_ANSI(*ContextData)) != 0;
+    }, MoveTemp(OnComplete), bBatchPerFrame);
 }
 
-// Event Type Constants Implementation
-FString URPGEventBusSubsystem::GetEventBeforeAttackRoll() const
+bool URPGEventBusSubsystem::PublishEventBinary(const FRPGEventContext& EventContext)
 {
-    if (!IsSafeToCallFunction() || !GetEventBeforeAttackRollFuncPtr)
+    if (!IsSafeToCallFunction())
     {
-        return TEXT("before_attack_roll");
+        return false;
     }
     
-    ANSICHAR* CStr = GetEventBeforeAttackRollFuncPtr();
-    return ConvertAndFreeString(CStr);
-}
-
-FString URPGEventBusSubsystem::GetEventOnAttackRoll() const
-{
-    if (!IsSafeToCallFunction() || !GetEventOnAttackRollFuncPtr)
+    if (!Toolkit->PublishEventBinary)
     {
-        return TEXT("on_attack_roll");
+        return PublishEventLegacy(EventContext);
     }
     
-    ANSICHAR* CStr = GetEventOnAttackRollFuncPtr();
-    return ConvertAndFreeString(CStr);
+    WireBuffer.Reset();
+    FRPGEventWireFormat::Encode(EventContext, WireBuffer);
+    
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitGameThreadCall);
+    return Toolkit->PublishEventBinary(WireBuffer.GetData(), WireBuffer.Num()) != 0;
 }
 
-FString URPGEventBusSubsystem::GetEventAfterAttackRoll() const
+bool URPGEventBusSubsystem::PublishEventLegacy(const FRPGEventContext& EventContext)
 {
-    if (!IsSafeToCallFunction() || !GetEventAfterAttackRollFuncPtr)
-    {
-        return TEXT("after_attack_roll");
-    }
+    const FString& EventTypeString = RPGEventTypes::EventTypeToString(EventContext.EventType);
+    static const FString EmptyString;
+    const FString& SourceID = EventContext.SourceEntity.GetInterface() ? EventContext.SourceEntity->GetID() : EmptyString;
+    const FString& TargetID = EventContext.TargetEntity.GetInterface() ? EventContext.TargetEntity->GetID() : EmptyString;
     
-    ANSICHAR* CStr = GetEventAfterAttackRollFuncPtr();
-    return ConvertAndFreeString(CStr);
+    // Header fields only - payload entries are not carried by this path
+    const FString ContextData = FString::Printf(TEXT("{\"EventID\":\"%s\",\"EventName\":\"%s\",\"Timestamp\":%f}"),
+        *EventContext.EventID.ToString(), *EventContext.EventName.ToString(), EventContext.Timestamp);
+    
+    return PublishEvent(EventTypeString, SourceID, TargetID, ContextData);
 }
 
-FString URPGEventBusSubsystem::GetEventBeforeDamageRoll() const
+FString URPGEventBusSubsystem::SubscribeEvent(const FString& EventType, int32 Priority)
 {
-    if (!IsSafeToCallFunction() || !GetEventBeforeDamageRollFuncPtr)
+    if (!IsSafeToCallFunction() || !Toolkit->SubscribeEvent)
     {
-        return TEXT("before_damage_roll");
+        return TEXT("");
     }
     
-    ANSICHAR* CStr = GetEventBeforeDamageRollFuncPtr();
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitGameThreadCall);
+    ANSICHAR* CStr = Toolkit->SubscribeEvent(TCHAR_TO_ANSI(*EventType), Priority);
     return ConvertAndFreeString(CStr);
 }
 
-FString URPGEventBusSubsystem::GetEventOnTakeDamage() const
+bool URPGEventBusSubsystem::UnsubscribeEvent(const FString& SubscriptionID)
 {
-    if (!IsSafeToCallFunction() || !GetEventOnTakeDamageFuncPtr)
+    if (!IsSafeToCallFunction() || !Toolkit->UnsubscribeEvent)
     {
-        return TEXT("on_take_damage");
+        return false;
     }
     
-    ANSICHAR* CStr = GetEventOnTakeDamageFuncPtr();
-    return ConvertAndFreeString(CStr);
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitGameThreadCall);
+    return Toolkit->UnsubscribeEvent(TCHAR_TO_ANSI(*SubscriptionID)) != 0;
 }
 
-FString URPGEventBusSubsystem::GetEventCalculateDamage() const
+int32 URPGEventBusSubsystem::DrainToolkitEvents()
 {
-    if (!IsSafeToCallFunction() || !GetEventCalculateDamageFuncPtr)
+    if (!ToolkitInbox.IsValid() || !EventQueue.IsValid())
     {
-        return TEXT("calculate_damage");
+        return 0;
     }
     
-    ANSICHAR* CStr = GetEventCalculateDamageFuncPtr();
-    return ConvertAndFreeString(CStr);
+    FRPGEventWireEntities Entities;
+    return ToolkitInbox->Drain([this, &Entities](const uint8* Data, int32 Length)
+    {
+        if (!FRPGEventWireFormat::Decode(Data, Length, InboxDecodeContext, &Entities))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("RPGEventBusSubsystem: Dropped malformed toolkit event (%d bytes)"), Length);
+            return;
+        }
+        
+        // Go-side events carry neither an ID nor a timestamp
+        if (!InboxDecodeContext.EventID.IsValid())
+        {
+            InboxDecodeContext.EventID = FGuid::NewGuid();
+        }
+        if (InboxDecodeContext.Timestamp == 0.0)
+        {
+            InboxDecodeContext.Timestamp = FApp::GetCurrentTime();
+        }
+        
+        if (!Entities.SourceID.IsEmpty())
+        {
+            InboxDecodeContext.SetStringData(RPGEventKeys::SourceID, Entities.SourceID);
+        }
+        if (!Entities.TargetID.IsEmpty())
+        {
+            InboxDecodeContext.SetStringData(RPGEventKeys::TargetID, Entities.TargetID);
+        }
+        InboxDecodeContext.SetBoolData(RPGEventKeys::ToolkitOrigin, true);
+        
+        EventQueue->Enqueue(InboxDecodeContext);
+    });
 }
 
-FString URPGEventBusSubsystem::GetEventAfterDamage() const
+FRPGToolkitEventInboxStats URPGEventBusSubsystem::GetToolkitInboxStats() const
 {
-    if (!IsSafeToCallFunction() || !GetEventAfterDamageFuncPtr)
-    {
-        return TEXT("after_damage");
-    }
-    
-    ANSICHAR* CStr = GetEventAfterDamageFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return ToolkitInbox.IsValid() ? ToolkitInbox->GetStats() : FRPGToolkitEventInboxStats();
 }
 
-FString URPGEventBusSubsystem::GetEventEntityPlaced() const
+// In-Process Dispatch Implementation
+FRPGEventHandle URPGEventBusSubsystem::SubscribeHandler(ERPGEventType EventType, TScriptInterface<IRPGEventInterface> Handler,
+    ERPGEventPriority Priority, ERPGEventSubscriptionType SubscriptionType, float Duration, ERPGEventHandlerAccess Access)
 {
-    if (!IsSafeToCallFunction() || !GetEventEntityPlacedFuncPtr)
+    if (!Dispatcher.IsValid())
     {
-        return TEXT("spatial.entity.placed");
+        return FRPGEventHandle();
     }
     
-    ANSICHAR* CStr = GetEventEntityPlacedFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Dispatcher->Subscribe(EventType, Handler, Priority, SubscriptionType, Duration, Access);
 }
 
-FString URPGEventBusSubsystem::GetEventEntityMoved() const
+FRPGEventHandle URPGEventBusSubsystem::SubscribeCustomHandler(FName CustomEventName, TScriptInterface<IRPGEventInterface> Handler,
+    ERPGEventPriority Priority, ERPGEventSubscriptionType SubscriptionType, float Duration, ERPGEventHandlerAccess Access)
 {
-    if (!IsSafeToCallFunction() || !GetEventEntityMovedFuncPtr)
+    if (!Dispatcher.IsValid())
     {
-        return TEXT("spatial.entity.moved");
+        return FRPGEventHandle();
     }
     
-    ANSICHAR* CStr = GetEventEntityMovedFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Dispatcher->SubscribeCustom(CustomEventName, Handler, Priority, SubscriptionType, Duration, Access);
 }
 
-FString URPGEventBusSubsystem::GetEventRoomCreated() const
+FRPGEventHandle URPGEventBusSubsystem::SubscribeEntityHandler(ERPGEventType EventType, const FString& EntityID, ERPGEventEntityScope Scope,
+    TScriptInterface<IRPGEventInterface> Handler, ERPGEventPriority Priority, ERPGEventSubscriptionType SubscriptionType, float Duration,
+    ERPGEventHandlerAccess Access)
 {
-    if (!IsSafeToCallFunction() || !GetEventRoomCreatedFuncPtr)
+    if (!Dispatcher.IsValid() || EntityID.IsEmpty())
     {
-        return TEXT("spatial.room.created");
+        return FRPGEventHandle();
     }
     
-    ANSICHAR* CStr = GetEventRoomCreatedFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Dispatcher->SubscribeEntity(EventType, FRPGEntityId::FromString(EntityID), Scope, Handler, Priority, SubscriptionType, Duration, Access);
 }
 
-FString URPGEventBusSubsystem::GetEventTurnStart() const
+int32 URPGEventBusSubsystem::UnsubscribeEntityHandlers(const FString& EntityID)
 {
-    if (!IsSafeToCallFunction() || !GetEventTurnStartFuncPtr)
+    if (!Dispatcher.IsValid() || EntityID.IsEmpty())
     {
-        return TEXT("turn_start");
+        return 0;
     }
     
-    ANSICHAR* CStr = GetEventTurnStartFuncPtr();
-    return ConvertAndFreeString(CStr);
+    // A string ID that was never converted has no scoped subscriptions
+    const FRPGEntityId CompactID = FRPGEntityId::Find(EntityID);
+    return CompactID.IsValid() ? Dispatcher->UnsubscribeEntity(CompactID) : 0;
 }
 
-FString URPGEventBusSubsystem::GetEventTurnEnd() const
+bool URPGEventBusSubsystem::UnsubscribeHandler(FRPGEventHandle Handle)
 {
-    if (!IsSafeToCallFunction() || !GetEventTurnEndFuncPtr)
-    {
-        return TEXT("turn_end");
-    }
-    
-    ANSICHAR* CStr = GetEventTurnEndFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Dispatcher.IsValid() && Dispatcher->Unsubscribe(Handle);
 }
 
-FString URPGEventBusSubsystem::GetEventRoundStart() const
+bool URPGEventBusSubsystem::IsHandlerSubscribed(FRPGEventHandle Handle) const
 {
-    if (!IsSafeToCallFunction() || !GetEventRoundStartFuncPtr)
-    {
-        return TEXT("round_start");
-    }
-    
-    ANSICHAR* CStr = GetEventRoundStartFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Dispatcher.IsValid() && Dispatcher->IsSubscribed(Handle);
 }
 
-FString URPGEventBusSubsystem::GetEventRoundEnd() const
+bool URPGEventBusSubsystem::UnsubscribeHandlerFromEventType(ERPGEventType EventType, TScriptInterface<IRPGEventInterface> Handler)
 {
-    if (!IsSafeToCallFunction() || !GetEventRoundEndFuncPtr)
-    {
-        return TEXT("round_end");
-    }
-    
-    ANSICHAR* CStr = GetEventRoundEndFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Dispatcher.IsValid() && Dispatcher->Unsubscribe(EventType, Handler.GetObject());
 }
 
-FString URPGEventBusSubsystem::GetEventStatusApplied() const
+ERPGEventResult URPGEventBusSubsystem::DispatchEvent(FRPGEventContext& EventContext)
 {
-    if (!IsSafeToCallFunction() || !GetEventStatusAppliedFuncPtr)
+    if (!Dispatcher.IsValid())
     {
-        return TEXT("status_applied");
+        return ERPGEventResult::Unhandled;
     }
     
-    ANSICHAR* CStr = GetEventStatusAppliedFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Dispatcher->Dispatch(EventContext);
 }
 
-FString URPGEventBusSubsystem::GetEventStatusRemoved() const
+int32 URPGEventBusSubsystem::GetHandlerCount(ERPGEventType EventType) const
 {
-    if (!IsSafeToCallFunction() || !GetEventStatusRemovedFuncPtr)
-    {
-        return TEXT("status_removed");
-    }
-    
-    ANSICHAR* CStr = GetEventStatusRemovedFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Dispatcher.IsValid() ? Dispatcher->GetNumSubscriptions(EventType) : 0;
 }
 
-FString URPGEventBusSubsystem::GetEventStatusCheck() const
+#if !UE_BUILD_SHIPPING
+FString URPGEventBusSubsystem::BenchmarkEventDispatch(int32 NumHandlers, int32 NumEvents)
 {
-    if (!IsSafeToCallFunction() || !GetEventStatusCheckFuncPtr)
+    if (NumHandlers <= 0 || NumEvents <= 0)
     {
-        return TEXT("status_check");
+        return TEXT("BenchmarkEventDispatch: NumHandlers and NumEvents must be positive");
     }
     
-    ANSICHAR* CStr = GetEventStatusCheckFuncPtr();
-    return ConvertAndFreeString(CStr);
-}
-
-// Context Key Constants Implementation
-FString URPGEventBusSubsystem::GetContextKeyAttacker() const
-{
-    if (!IsSafeToCallFunction() || !GetContextKeyAttackerFuncPtr)
+    // Private dispatcher and profiler, so live subscriptions and bus stats are untouched
+    FRPGEventProfiler BenchProfiler(TEXT("BenchmarkEventDispatch"), false);
+    FRPGEventDispatcher BenchDispatcher;
+    BenchDispatcher.SetProfiler(&BenchProfiler);
+    
+    // Spread handlers across every priority level so the walk exercises the sorted order
+    const ERPGEventPriority Priorities[] = { ERPGEventPriority::Critical, ERPGEventPriority::High, ERPGEventPriority::Normal, ERPGEventPriority::Low };
+    
+    TArray<URPGCountingEvent*> Handlers;
+    TArray<FRPGEventHandle> Handles;
+    for (int32 Index = 0; Index < NumHandlers; ++Index)
     {
-        return TEXT("attacker");
+        URPGCountingEvent* Handler = NewObject<URPGCountingEvent>(this);
+        Handlers.Add(Handler);
+        Handles.Add(BenchDispatcher.Subscribe(ERPGEventType::DiceRolled, Handler, Priorities[Index % UE_ARRAY_COUNT(Priorities)]));
     }
     
-    ANSICHAR* CStr = GetContextKeyAttackerFuncPtr();
-    return ConvertAndFreeString(CStr);
-}
-
-FString URPGEventBusSubsystem::GetContextKeyTarget() const
-{
-    if (!IsSafeToCallFunction() || !GetContextKeyTargetFuncPtr)
+    FRPGEventContext Context(ERPGEventType::DiceRolled);
+    Context.SetIntData(TEXT("Sides"), 20);
+    
+    const double Start = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumEvents; ++Index)
     {
-        return TEXT("target");
+        Context.bHandled = false;
+        BenchDispatcher.Dispatch(Context);
     }
+    const double Seconds = FPlatformTime::Seconds() - Start;
     
-    ANSICHAR* CStr = GetContextKeyTargetFuncPtr();
-    return ConvertAndFreeString(CStr);
-}
-
-FString URPGEventBusSubsystem::GetContextKeyWeapon() const
-{
-    if (!IsSafeToCallFunction() || !GetContextKeyWeaponFuncPtr)
+    int64 Delivered = 0;
+    for (URPGCountingEvent* Handler : Handlers)
     {
-        return TEXT("weapon");
+        Delivered += Handler->GetEventCount();
     }
     
-    ANSICHAR* CStr = GetContextKeyWeaponFuncPtr();
-    return ConvertAndFreeString(CStr);
-}
-
-FString URPGEventBusSubsystem::GetContextKeyDamageType() const
-{
-    if (!IsSafeToCallFunction() || !GetContextKeyDamageTypeFuncPtr)
+    for (FRPGEventHandle Handle : Handles)
     {
-        return TEXT("damage_type");
+        BenchDispatcher.Unsubscribe(Handle);
     }
     
-    ANSICHAR* CStr = GetContextKeyDamageTypeFuncPtr();
-    return ConvertAndFreeString(CStr);
+    const int64 Expected = static_cast<int64>(NumHandlers) * NumEvents;
+    FString Summary = FString::Printf(TEXT("%d events x %d handlers | %.3f ms | %.2f M events/s | %.1f ns/handler call | Delivered %lld/%lld"),
+        NumEvents, NumHandlers, Seconds * 1000.0,
+        Seconds > 0.0 ? NumEvents / Seconds / 1000000.0 : 0.0,
+        Expected > 0 ? Seconds * 1e9 / Expected : 0.0,
+        Delivered, Expected);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGEventBusSubsystem::BenchmarkEventDispatch: %s"), *Summary);
+    return Summary;
 }
 
-FString URPGEventBusSubsystem::GetContextKeyAdvantage() const
+FString URPGEventBusSubsystem::BenchmarkEntityRouting(int32 NumEntities, int32 NumEvents)
 {
-    if (!IsSafeToCallFunction() || !GetContextKeyAdvantageFuncPtr)
+    if (NumEntities <= 0 || NumEvents <= 0)
     {
-        return TEXT("advantage");
+        return TEXT("BenchmarkEntityRouting: NumEntities and NumEvents must be positive");
     }
     
-    ANSICHAR* CStr = GetContextKeyAdvantageFuncPtr();
-    return ConvertAndFreeString(CStr);
-}
-
-FString URPGEventBusSubsystem::GetContextKeyRoll() const
-{
-    if (!IsSafeToCallFunction() || !GetContextKeyRollFuncPtr)
+    // Private dispatcher and profiler, so live subscriptions and bus stats are untouched
+    FRPGEventProfiler BenchProfiler(TEXT("BenchmarkEntityRouting"), false);
+    FRPGEventDispatcher BenchDispatcher;
+    BenchDispatcher.SetProfiler(&BenchProfiler);
+    
+    TArray<TScriptInterface<IRPGEntityInterface>> Entities;
+    TArray<URPGCountingEvent*> Handlers;
+    for (int32 Index = 0; Index < NumEntities; ++Index)
     {
-        return TEXT("roll");
+        // Generated GUID IDs, so the benchmark adds nothing to the entity ID intern table
+        Entities.Add(URPGEntityObject::CreateEntity(this, TEXT("creature")));
+        Handlers.Add(NewObject<URPGCountingEvent>(this));
     }
     
-    ANSICHAR* CStr = GetContextKeyRollFuncPtr();
-    return ConvertAndFreeString(CStr);
-}
-
-FString URPGEventBusSubsystem::GetContextKeyOldPosition() const
-{
-    if (!IsSafeToCallFunction() || !GetContextKeyOldPositionFuncPtr)
+    // Same target sequence for both runs
+    TArray<int32> Targets;
+    FRandomStream Stream(12345);
+    for (int32 Index = 0; Index < NumEvents; ++Index)
     {
-        return TEXT("old_position");
+        Targets.Add(Stream.RandRange(0, NumEntities - 1));
     }
     
-    ANSICHAR* CStr = GetContextKeyOldPositionFuncPtr();
-    return ConvertAndFreeString(CStr);
-}
-
-FString URPGEventBusSubsystem::GetContextKeyNewPosition() const
-{
-    if (!IsSafeToCallFunction() || !GetContextKeyNewPositionFuncPtr)
+    auto RunEvents = [&BenchDispatcher, &Entities, &Handlers, &Targets](double& OutSeconds) -> int64
     {
-        return TEXT("new_position");
-    }
+        FRPGEventContext Context(ERPGEventType::DamageReceived);
+        Context.SetIntData(TEXT("damage"), 7);
+        
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Target : Targets)
+        {
+            Context.TargetEntity = Entities[Target];
+            Context.bHandled = false;
+            BenchDispatcher.Dispatch(Context);
+        }
+        OutSeconds = FPlatformTime::Seconds() - Start;
+        
+        int64 Visits = 0;
+        for (URPGCountingEvent* Handler : Handlers)
+        {
+            Visits += Handler->GetEventCount();
+            Handler->ResetEventCount();
+        }
+        return Visits;
+    };
     
-    ANSICHAR* CStr = GetContextKeyNewPositionFuncPtr();
-    return ConvertAndFreeString(CStr);
-}
-
-FString URPGEventBusSubsystem::GetContextKeyRoomID() const
-{
-    if (!IsSafeToCallFunction() || !GetContextKeyRoomIDFuncPtr)
+    // Global: every handler sees every event and would filter it in CanHandleEvent
+    TArray<FRPGEventHandle> Handles;
+    for (URPGCountingEvent* Handler : Handlers)
+    {
+        Handles.Add(BenchDispatcher.Subscribe(ERPGEventType::DamageReceived, Handler, ERPGEventPriority::Normal));
+    }
+    double GlobalSeconds = 0.0;
+    const int64 GlobalVisits = RunEvents(GlobalSeconds);
+    for (FRPGEventHandle Handle : Handles)
     {
-        return TEXT("room_id");
+        BenchDispatcher.Unsubscribe(Handle);
     }
+    Handles.Reset();
     
-    ANSICHAR* CStr = GetContextKeyRoomIDFuncPtr();
-    return ConvertAndFreeString(CStr);
-}
-
-// Modifier Creation Functions Implementation
-FString URPGEventBusSubsystem::CreateModifier(const FString& Source, const FString& ModifierType, int32 Value, int32 Priority)
-{
-    if (!IsSafeToCallFunction() || !CreateModifierFuncPtr)
+    // Scoped: each handler only hears about its own entity
+    for (int32 Index = 0; Index < NumEntities; ++Index)
     {
-        return TEXT("ERROR: Function not available");
+        Handles.Add(BenchDispatcher.SubscribeEntity(ERPGEventType::DamageReceived, Entities[Index]->GetCompactID(),
+            ERPGEventEntityScope::Target, Handlers[Index], ERPGEventPriority::Normal));
+    }
+    double ScopedSeconds = 0.0;
+    const int64 ScopedVisits = RunEvents(ScopedSeconds);
+    for (FRPGEventHandle Handle : Handles)
+    {
+        BenchDispatcher.Unsubscribe(Handle);
     }
     
-    ANSICHAR* CStr = CreateModifierFuncPtr(TCHAR_TO_ANSI(*Source), TCHAR_TO_ANSI(*ModifierType), Value, Priority);
-    return ConvertAndFreeString(CStr);
+    FString Summary = FString::Printf(TEXT("%d events over %d entities | global: %.1f ns/event, %lld handler visits | scoped: %.1f ns/event, %lld handler visits | %.1fx"),
+        NumEvents, NumEntities,
+        GlobalSeconds * 1e9 / NumEvents, GlobalVisits,
+        ScopedSeconds * 1e9 / NumEvents, ScopedVisits,
+        ScopedSeconds > 0.0 ? GlobalSeconds / ScopedSeconds : 0.0);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGEventBusSubsystem::BenchmarkEntityRouting: %s"), *Summary);
+    return Summary;
 }
 
-FString URPGEventBusSubsystem::CreateIntModifier(const FString& Source, const FString& ModifierType, int32 Value)
+FString URPGEventBusSubsystem::BenchmarkReadOnlyHandlers(int32 NumHandlers, int32 NumEvents, float WorkMicroseconds)
 {
-    if (!IsSafeToCallFunction() || !CreateIntModifierFuncPtr)
+    if (NumHandlers <= 0 || NumEvents <= 0)
     {
-        return TEXT("ERROR: Function not available");
+        return TEXT("BenchmarkReadOnlyHandlers: NumHandlers and NumEvents must be positive");
     }
     
-    ANSICHAR* CStr = CreateIntModifierFuncPtr(TCHAR_TO_ANSI(*Source), TCHAR_TO_ANSI(*ModifierType), Value);
-    return ConvertAndFreeString(CStr);
-}
-
-FString URPGEventBusSubsystem::CreateDiceModifier(const FString& Source, const FString& ModifierType, const FString& DiceExpression)
-{
-    if (!IsSafeToCallFunction() || !CreateDiceModifierFuncPtr)
+    // Private dispatcher and profiler, so live subscriptions and bus stats are untouched
+    FRPGEventProfiler BenchProfiler(TEXT("BenchmarkReadOnlyHandlers"), false);
+    FRPGEventDispatcher BenchDispatcher;
+    BenchDispatcher.SetProfiler(&BenchProfiler);
+    
+    TArray<URPGCountingEvent*> Handlers;
+    for (int32 Index = 0; Index < NumHandlers; ++Index)
     {
-        return TEXT("ERROR: Function not available");
+        URPGCountingEvent* Handler = NewObject<URPGCountingEvent>(this);
+        Handler->SimulatedWorkMicroseconds = WorkMicroseconds;
+        Handlers.Add(Handler);
     }
     
-    ANSICHAR* CStr = CreateDiceModifierFuncPtr(TCHAR_TO_ANSI(*Source), TCHAR_TO_ANSI(*ModifierType), TCHAR_TO_ANSI(*DiceExpression));
-    return ConvertAndFreeString(CStr);
+    // Returns deliveries; OutPublishSeconds is the game-thread publish cost, OutTotalSeconds includes the join
+    auto Run = [&BenchDispatcher, &Handlers, NumEvents](ERPGEventHandlerAccess Access, double& OutPublishSeconds, double& OutTotalSeconds) -> int64
+    {
+        TArray<FRPGEventHandle> Handles;
+        for (URPGCountingEvent* Handler : Handlers)
+        {
+            Handles.Add(BenchDispatcher.Subscribe(ERPGEventType::DamageDealt, Handler, ERPGEventPriority::Normal,
+                ERPGEventSubscriptionType::Persistent, 0.0, Access));
+        }
+        
+        FRPGEventContext Context(ERPGEventType::DamageDealt);
+        Context.SetIntData(TEXT("damage"), 7);
+        
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < NumEvents; ++Index)
+        {
+            Context.bHandled = false;
+            BenchDispatcher.Dispatch(Context);
+        }
+        OutPublishSeconds = FPlatformTime::Seconds() - Start;
+        BenchDispatcher.WaitForReadOnlyHandlers();
+        OutTotalSeconds = FPlatformTime::Seconds() - Start;
+        
+        for (FRPGEventHandle Handle : Handles)
+        {
+            BenchDispatcher.Unsubscribe(Handle);
+        }
+        
+        int64 Delivered = 0;
+        for (URPGCountingEvent* Handler : Handlers)
+        {
+            Delivered += Handler->GetEventCount();
+            Handler->ResetEventCount();
+        }
+        return Delivered;
+    };
+    
+    double MutatingPublish = 0.0, MutatingTotal = 0.0;
+    const int64 MutatingDelivered = Run(ERPGEventHandlerAccess::Mutating, MutatingPublish, MutatingTotal);
+    
+    double ReadOnlyPublish = 0.0, ReadOnlyTotal = 0.0;
+    const int64 ReadOnlyDelivered = Run(ERPGEventHandlerAccess::ReadOnly, ReadOnlyPublish, ReadOnlyTotal);
+    
+    const int64 Expected = static_cast<int64>(NumHandlers) * NumEvents;
+    FString Summary = FString::Printf(TEXT("%d events x %d handlers (%.1f us each) | mutating: %.2f us/publish, %.3f ms total | read-only: %.2f us/publish, %.3f ms total with join | %.1fx publish latency | Delivered %lld/%lld, %lld/%lld"),
+        NumEvents, NumHandlers, WorkMicroseconds,
+        MutatingPublish * 1e6 / NumEvents, MutatingTotal * 1000.0,
+        ReadOnlyPublish * 1e6 / NumEvents, ReadOnlyTotal * 1000.0,
+        ReadOnlyPublish > 0.0 ? MutatingPublish / ReadOnlyPublish : 0.0,
+        MutatingDelivered, Expected, ReadOnlyDelivered, Expected);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGEventBusSubsystem::BenchmarkReadOnlyHandlers: %s"), *Summary);
+    return Summary;
 }
+#endif
 
-// Duration Constants Implementation
-FString URPGEventBusSubsystem::GetDurationPermanent() const
+// Queued Publish Implementation
+bool URPGEventBusSubsystem::QueueEvent(const FRPGEventContext& EventContext)
 {
-    if (!IsSafeToCallFunction() || !GetDurationPermanentFuncPtr)
+    if (!EventQueue.IsValid())
     {
-        return TEXT("permanent");
+        return false;
     }
     
-    ANSICHAR* CStr = GetDurationPermanentFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return EventQueue->Enqueue(EventContext);
 }
 
-FString URPGEventBusSubsystem::GetDurationRounds() const
+int32 URPGEventBusSubsystem::FlushEventQueue()
 {
-    if (!IsSafeToCallFunction() || !GetDurationRoundsFuncPtr)
+    if (!EventQueue.IsValid() || !Dispatcher.IsValid())
     {
-        return TEXT("rounds");
+        return 0;
     }
     
-    ANSICHAR* CStr = GetDurationRoundsFuncPtr();
-    return ConvertAndFreeString(CStr);
+    DrainToolkitEvents();
+    return EventQueue->Flush(*Dispatcher);
 }
 
-FString URPGEventBusSubsystem::GetDurationMinutes() const
+void URPGEventBusSubsystem::SetEventQueueSettings(const FRPGEventQueueSettings& Settings)
 {
-    if (!IsSafeToCallFunction() || !GetDurationMinutesFuncPtr)
+    if (!EventQueue.IsValid())
     {
-        return TEXT("minutes");
+        return;
     }
     
-    ANSICHAR* CStr = GetDurationMinutesFuncPtr();
-    return ConvertAndFreeString(CStr);
+    EventQueue->Settings = Settings;
+    BindFlushPhase(Settings.FlushPhase);
 }
 
-FString URPGEventBusSubsystem::GetDurationHours() const
+FRPGEventQueueSettings URPGEventBusSubsystem::GetEventQueueSettings() const
 {
-    if (!IsSafeToCallFunction() || !GetDurationHoursFuncPtr)
-    {
-        return TEXT("hours");
-    }
-    
-    ANSICHAR* CStr = GetDurationHoursFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return EventQueue.IsValid() ? EventQueue->Settings : FRPGEventQueueSettings();
 }
 
-FString URPGEventBusSubsystem::GetDurationEncounter() const
+FRPGEventQueueStats URPGEventBusSubsystem::GetEventQueueStats() const
 {
-    if (!IsSafeToCallFunction() || !GetDurationEncounterFuncPtr)
-    {
-        return TEXT("encounter");
-    }
-    
-    ANSICHAR* CStr = GetDurationEncounterFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return EventQueue.IsValid() ? EventQueue->GetStats() : FRPGEventQueueStats();
 }
 
-FString URPGEventBusSubsystem::GetDurationConcentration() const
+FRPGEventBusStats URPGEventBusSubsystem::GetEventBusStats() const
 {
-    if (!IsSafeToCallFunction() || !GetDurationConcentrationFuncPtr)
-    {
-        return TEXT("concentration");
-    }
-    
-    ANSICHAR* CStr = GetDurationConcentrationFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Profiler.IsValid() ? Profiler->GetStats() : FRPGEventBusStats();
 }
 
-FString URPGEventBusSubsystem::GetDurationShortRest() const
+TArray<FRPGEventHandlerProfile> URPGEventBusSubsystem::GetTopEventHandlers(int32 Count) const
 {
-    if (!IsSafeToCallFunction() || !GetDurationShortRestFuncPtr)
-    {
-        return TEXT("short_rest");
-    }
-    
-    ANSICHAR* CStr = GetDurationShortRestFuncPtr();
-    return ConvertAndFreeString(CStr);
+    return Profiler.IsValid() ? Profiler->GetTopHandlers(FMath::Max(Count, 0)) : TArray<FRPGEventHandlerProfile>();
 }
 
-FString URPGEventBusSubsystem::GetDurationLongRest() const
+void URPGEventBusSubsystem::ResetEventProfile()
 {
-    if (!IsSafeToCallFunction() || !GetDurationLongRestFuncPtr)
+    if (Profiler.IsValid())
     {
-        return TEXT("long_rest");
+        Profiler->Reset();
     }
-    
-    ANSICHAR* CStr = GetDurationLongRestFuncPtr();
-    return ConvertAndFreeString(CStr);
 }
 
-FString URPGEventBusSubsystem::GetDurationUntilDamaged() const
+void URPGEventBusSubsystem::BindFlushPhase(ERPGEventFlushPhase Phase)
 {
-    if (!IsSafeToCallFunction() || !GetDurationUntilDamagedFuncPtr)
+    if (FlushDelegateHandle.IsValid())
     {
-        return TEXT("until_damaged");
+        switch (BoundFlushPhase)
+        {
+        case ERPGEventFlushPhase::FrameStart:    FWorldDelegates::OnWorldTickStart.Remove(FlushDelegateHandle); break;
+        case ERPGEventFlushPhase::PreActorTick:  FWorldDelegates::OnWorldPreActorTick.Remove(FlushDelegateHandle); break;
+        case ERPGEventFlushPhase::PostActorTick: FWorldDelegates::OnWorldPostActorTick.Remove(FlushDelegateHandle); break;
+        default: break;
+        }
+        FlushDelegateHandle.Reset();
     }
     
-    ANSICHAR* CStr = GetDurationUntilDamagedFuncPtr();
+    switch (Phase)
+    {
+    case ERPGEventFlushPhase::FrameStart:
+        FlushDelegateHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &URPGEventBusSubsystem::HandleWorldTickPhase);
+        break;
+    case ERPGEventFlushPhase::PreActorTick:
+        FlushDelegateHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &URPGEventBusSubsystem::HandleWorldTickPhase);
+        break;
+    case ERPGEventFlushPhase::PostActorTick:
+        FlushDelegateHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &URPGEventBusSubsystem::HandleWorldTickPhase);
+        break;
+    case ERPGEventFlushPhase::EndOfFrame:
+        // Flushed from HandleEndFrame, ahead of the arena reset
+        break;
+    default:
+        break;
+    }
+    
+    BoundFlushPhase = Phase;
+}
+
+void URPGEventBusSubsystem::HandleWorldTickPhase(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+    // Every world ticks through these delegates - only drain for our own game world
+    if (!World || World->GetGameInstance() != GetGameInstance())
+    {
+        return;
+    }
+    
+    if (HasPendingEvents())
+    {
+        FlushEventQueue();
+    }
+}
+
+void URPGEventBusSubsystem::HandleEndFrame()
+{
+    if (BoundFlushPhase == ERPGEventFlushPhase::EndOfFrame && HasPendingEvents())
+    {
+        FlushEventQueue();
+    }
+    
+    // Join before the next frame; read-only handlers work on their own context copies, so the arena can reset after
+    if (Dispatcher.IsValid())
+    {
+        Dispatcher->WaitForReadOnlyHandlers();
+    }
+    
+    if (ToolkitInbox.IsValid())
+    {
+        ToolkitInbox->PublishStats();
+    }
+    
+    if (Profiler.IsValid())
+    {
+        if (EventQueue.IsValid())
+        {
+            Profiler->RecordQueue(EventQueue->Num(), EventQueue->GetStats().MaxObservedDepth);
+        }
+        Profiler->PublishFrameStats();
+    }
+    
+    if (EventArena.IsValid())
+    {
+        // Arena stats are global counters too - only the bus whose profiler owns them writes them
+        if (Profiler.IsValid() && Profiler->PublishesGlobalStats())
+        {
+            EventArena->PublishStats();
+        }
+        EventArena->ResetFrame();
+    }
+}
+
+void URPGEventBusSubsystem::HandlePreGarbageCollect()
+{
+    if (Dispatcher.IsValid())
+    {
+        Dispatcher->WaitForReadOnlyHandlers();
+    }
+}
+
+bool URPGEventBusSubsystem::HasPendingEvents() const
+{
+    return (EventQueue.IsValid() && EventQueue->Num() > 0) || (ToolkitInbox.IsValid() && ToolkitInbox->Num() > 0);
+}
+
+FRPGEventContext& URPGEventBusSubsystem::AcquireFrameEvent(ERPGEventType EventType, TScriptInterface<IRPGEntityInterface> Source)
+{
+    check(EventArena.IsValid());
+    return EventArena->Acquire(EventType, Source);
+}
+
+bool URPGEventBusSubsystem::RetainEvent(const FRPGEventContext& EventContext)
+{
+    return EventArena.IsValid() && EventArena->Retain(EventContext);
+}
+
+bool URPGEventBusSubsystem::ReleaseEvent(const FRPGEventContext& EventContext)
+{
+    return EventArena.IsValid() && EventArena->Release(EventContext);
+}
+
+FRPGEventArenaStats URPGEventBusSubsystem::GetEventArenaStats() const
+{
+    return EventArena.IsValid() ? EventArena->GetStats() : FRPGEventArenaStats();
+}
+
+#if !UE_BUILD_SHIPPING
+FString URPGEventBusSubsystem::BenchmarkEventArena(int32 EventsPerFrame, int32 NumFrames)
+{
+    if (EventsPerFrame <= 0 || NumFrames <= 0)
+    {
+        return TEXT("BenchmarkEventArena: EventsPerFrame and NumFrames must be positive");
+    }
+    
+    // Enough keys and text to spill out of FRPGEventPayload's inline buffers
+    static const FName SpillKeys[] =
+    {
+        TEXT("k0"), TEXT("k1"), TEXT("k2"), TEXT("k3"), TEXT("k4"), TEXT("k5"),
+        TEXT("k6"), TEXT("k7"), TEXT("k8"), TEXT("k9"), TEXT("k10"), TEXT("k11")
+    };
+    const FString LongText = FString::ChrN(FRPGEventPayload::InlineStringChars + 32, TEXT('x'));
+    
+    auto FillPayload = [&LongText](FRPGEventContext& Context)
+    {
+        for (int32 Index = 0; Index < UE_ARRAY_COUNT(SpillKeys); ++Index)
+        {
+            Context.SetIntData(SpillKeys[Index], Index);
+        }
+        Context.SetStringData(RPGEventKeys::Weapon, LongText);
+    };
+    
+    const int64 NumEvents = static_cast<int64>(EventsPerFrame) * NumFrames;
+    
+    int64 ByValueAllocations = 0;
+    double ByValueSeconds = 0.0;
+    {
+        FRPGAllocationCounter Counter;
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (int32 Index = 0; Index < EventsPerFrame; ++Index)
+            {
+                FRPGEventContext Context = URPGEvent::CreateCombatEvent(ERPGEventType::AttackInitiated, nullptr, nullptr);
+                FillPayload(Context);
+            }
+        }
+        ByValueSeconds = FPlatformTime::Seconds() - Start;
+        ByValueAllocations = Counter.GetAllocations();
+    }
+    
+    // Private arena; one warm-up frame sizes the slots and their spilled payloads
+    FRPGEventArena Arena;
+    for (int32 Index = 0; Index < EventsPerFrame; ++Index)
+    {
+        FillPayload(URPGEvent::CreateCombatEvent(Arena, ERPGEventType::AttackInitiated, nullptr, nullptr));
+    }
+    Arena.ResetFrame();
+    
+    int64 ArenaAllocations = 0;
+    double ArenaSeconds = 0.0;
+    {
+        FRPGAllocationCounter Counter;
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (int32 Index = 0; Index < EventsPerFrame; ++Index)
+            {
+                FillPayload(URPGEvent::CreateCombatEvent(Arena, ERPGEventType::AttackInitiated, nullptr, nullptr));
+            }
+            Arena.ResetFrame();
+        }
+        ArenaSeconds = FPlatformTime::Seconds() - Start;
+        ArenaAllocations = Counter.GetAllocations();
+    }
+    
+    FString Summary = FString::Printf(TEXT("%d frames x %d events | by value %.2f allocs/event, %.1f ns/event | arena %.2f allocs/event, %.1f ns/event | arena capacity %d (%lld KB)"),
+        NumFrames, EventsPerFrame,
+        static_cast<double>(ByValueAllocations) / NumEvents, ByValueSeconds * 1e9 / NumEvents,
+        static_cast<double>(ArenaAllocations) / NumEvents, ArenaSeconds * 1e9 / NumEvents,
+        Arena.GetStats().Capacity, Arena.GetStats().ReservedBytes / 1024);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGEventBusSubsystem::BenchmarkEventArena: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGEventBusSubsystem::BenchmarkEventContext(int32 NumEvents)
+{
+    if (NumEvents <= 0)
+    {
+        return TEXT("BenchmarkEventContext: NumEvents must be positive");
+    }
+    
+    static const FName MultiplierKey(TEXT("multiplier"));
+    static const FName AttackName(TEXT("attack"));
+    
+    // Legacy layout: FString keys and values in per-type maps, GUID as a string
+    int64 LegacyAllocations = 0;
+    double LegacySeconds = 0.0;
+    {
+        FRPGAllocationCounter Counter;
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < NumEvents; ++Index)
+        {
+            FLegacyEventContext Context;
+            Context.EventID = FGuid::NewGuid().ToString();
+            Context.EventName = TEXT("attack");
+            Context.StringData.Add(TEXT("attacker"), TEXT("goblin-01"));
+            Context.StringData.Add(TEXT("target"), TEXT("fighter-02"));
+            Context.StringData.Add(TEXT("weapon"), TEXT("longsword"));
+            Context.StringData.Add(TEXT("damage_type"), TEXT("slashing"));
+            Context.IntData.Add(TEXT("roll"), 17);
+            Context.FloatData.Add(TEXT("multiplier"), 1.5f);
+            Context.BoolData.Add(TEXT("advantage"), true);
+            Context.Modifiers.AddUnique(ERPGEventModifier::Advantage);
+        }
+        LegacySeconds = FPlatformTime::Seconds() - Start;
+        LegacyAllocations = Counter.GetAllocations();
+    }
+    
+    // Inline payload: interned keys, values in the context's own buffers
+    int64 InlineAllocations = 0;
+    double InlineSeconds = 0.0;
+    {
+        FRPGAllocationCounter Counter;
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < NumEvents; ++Index)
+        {
+            FRPGEventContext Context(ERPGEventType::AttackInitiated);
+            Context.EventName = AttackName;
+            Context.SetStringData(RPGEventKeys::Attacker, TEXT("goblin-01"));
+            Context.SetStringData(RPGEventKeys::Target, TEXT("fighter-02"));
+            Context.SetStringData(RPGEventKeys::Weapon, TEXT("longsword"));
+            Context.SetStringData(RPGEventKeys::DamageType, TEXT("slashing"));
+            Context.SetIntData(RPGEventKeys::Roll, 17);
+            Context.SetFloatData(MultiplierKey, 1.5f);
+            Context.SetBoolData(RPGEventKeys::Advantage, true);
+            Context.AddModifier(ERPGEventModifier::Advantage);
+        }
+        InlineSeconds = FPlatformTime::Seconds() - Start;
+        InlineAllocations = Counter.GetAllocations();
+    }
+    
+    FString Summary = FString::Printf(TEXT("%d combat events | legacy %.2f allocs/event, %.1f ns/event | inline %.2f allocs/event, %.1f ns/event | sizeof(FRPGEventContext) %d bytes"),
+        NumEvents,
+        static_cast<double>(LegacyAllocations) / NumEvents, LegacySeconds * 1e9 / NumEvents,
+        static_cast<double>(InlineAllocations) / NumEvents, InlineSeconds * 1e9 / NumEvents,
+        static_cast<int32>(sizeof(FRPGEventContext)));
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGEventBusSubsystem::BenchmarkEventContext: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGEventBusSubsystem::BenchmarkCombatRoundAllocations(int32 NumCombatants, int32 NumRounds)
+{
+    if (NumCombatants < 2 || NumRounds <= 0)
+    {
+        return TEXT("BenchmarkCombatRoundAllocations: need at least two combatants and one round");
+    }
+    
+    // Private dispatcher and profiler, so live subscriptions and bus stats are untouched
+    FRPGEventProfiler BenchProfiler(TEXT("BenchmarkCombatRoundAllocations"), false);
+    FRPGEventDispatcher BenchDispatcher;
+    BenchDispatcher.SetProfiler(&BenchProfiler);
+    
+    static const FName AttackerIDKey(TEXT("AttackerID"));
+    static const FName AttackerTypeKey(TEXT("AttackerType"));
+    static const FName DefenderIDKey(TEXT("DefenderID"));
+    static const FName DefenderTypeKey(TEXT("DefenderType"));
+    static const FName DamageKey(TEXT("damage"));
+    
+    // Combatants with generated IDs, each watching for damage to itself
+    TArray<TScriptInterface<IRPGEntityInterface>> Combatants;
+    TArray<FRPGEventHandle> Handles;
+    for (int32 Index = 0; Index < NumCombatants; ++Index)
+    {
+        URPGEntityObject* Combatant = URPGEntityObject::CreateEntity(this, TEXT("creature"));
+        Combatants.Add(Combatant);
+        Handles.Add(BenchDispatcher.SubscribeEntity(ERPGEventType::DamageReceived, Combatant->GetCompactID(),
+            ERPGEventEntityScope::Target, NewObject<URPGCountingEvent>(this), ERPGEventPriority::Normal));
+    }
+    
+    // One round: every combatant attacks the next, the defender checks it was the target and takes damage
+    int64 Hits = 0;
+    auto RunRounds = [&Combatants, &Hits, NumRounds](auto&& Attack) -> int64
+    {
+        FRPGAllocationCounter Counter;
+        for (int32 Round = 0; Round < NumRounds; ++Round)
+        {
+            for (int32 Index = 0; Index < Combatants.Num(); ++Index)
+            {
+                Hits += Attack(Combatants[Index], Combatants[(Index + 1) % Combatants.Num()]) ? 1 : 0;
+            }
+        }
+        return Counter.GetAllocations();
+    };
+    
+    // Before: IDs travel as GUID strings, copied by value and compared as strings
+    const int64 StringAllocations = RunRounds([&BenchDispatcher](const TScriptInterface<IRPGEntityInterface>& Attacker, const TScriptInterface<IRPGEntityInterface>& Defender)
+    {
+        const FString AttackerID = Attacker->GetID();
+        const FString DefenderID = Defender->GetID();
+        
+        FRPGEventContext AttackContext(ERPGEventType::AttackInitiated, Attacker);
+        AttackContext.TargetEntity = Defender;
+        AttackContext.SetStringData(AttackerIDKey, AttackerID);
+        AttackContext.SetStringData(AttackerTypeKey, FString(Attacker->GetType()));
+        AttackContext.SetStringData(DefenderIDKey, DefenderID);
+        AttackContext.SetStringData(DefenderTypeKey, FString(Defender->GetType()));
+        BenchDispatcher.Dispatch(AttackContext);
+        
+        const bool bHit = AttackContext.GetStringData(DefenderIDKey) == Defender->GetID();
+        
+        FRPGEventContext DamageContext(ERPGEventType::DamageReceived, Attacker);
+        DamageContext.TargetEntity = Defender;
+        DamageContext.SetIntData(DamageKey, 7);
+        BenchDispatcher.Dispatch(DamageContext);
+        return bHit;
+    });
+    
+    // After: IDs stay compact until a string edge needs them
+    const int64 CompactAllocations = RunRounds([&BenchDispatcher](const TScriptInterface<IRPGEntityInterface>& Attacker, const TScriptInterface<IRPGEntityInterface>& Defender)
+    {
+        FRPGEventContext AttackContext = URPGEvent::CreateCombatEvent(ERPGEventType::AttackInitiated, Attacker, Defender);
+        BenchDispatcher.Dispatch(AttackContext);
+        
+        const bool bHit = AttackContext.GetEntityIdData(DefenderIDKey) == Defender->GetCompactID();
+        
+        FRPGEventContext DamageContext(ERPGEventType::DamageReceived, Attacker);
+        DamageContext.TargetEntity = Defender;
+        DamageContext.SetIntData(DamageKey, 7);
+        BenchDispatcher.Dispatch(DamageContext);
+        return bHit;
+    });
+    
+    for (FRPGEventHandle Handle : Handles)
+    {
+        BenchDispatcher.Unsubscribe(Handle);
+    }
+    
+    const int32 Attacks = NumCombatants * NumRounds;
+    FString Summary = FString::Printf(TEXT("%d rounds of %d attacks | string IDs %.2f allocs/round | compact IDs %.2f allocs/round | sizeof(FRPGEntityId) %d bytes, GUID string %d bytes | hits %lld/%d"),
+        NumRounds, NumCombatants,
+        static_cast<double>(StringAllocations) / NumRounds,
+        static_cast<double>(CompactAllocations) / NumRounds,
+        static_cast<int32>(sizeof(FRPGEntityId)),
+        static_cast<int32>(sizeof(FString) + (Combatants[0]->GetID().Len() + 1) * sizeof(TCHAR)),
+        Hits, Attacks * 2);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGEventBusSubsystem::BenchmarkCombatRoundAllocations: %s"), *Summary);
+    return Summary;
+}
+
+namespace
+{
+    /** Event exercising every wire field: all value types, non-ASCII text, flags, modifiers and a custom name */
+    FRPGEventContext MakeWireTestEvent()
+    {
+        FRPGEventContext Context(ERPGEventType::Custom);
+        Context.EventName = TEXT("before_attack_roll");
+        Context.Priority = ERPGEventPriority::High;
+        Context.bHandled = true;
+        Context.AddModifier(ERPGEventModifier::Advantage);
+        Context.AddModifier(ERPGEventModifier::Bonus);
+        Context.SetStringData(RPGEventKeys::Attacker, TEXT("goblin-01"));
+        Context.SetStringData(RPGEventKeys::Target, TEXT("fighter-02"));
+        Context.SetStringData(RPGEventKeys::Weapon, TEXT("\u00C9p\u00E9e longue \u2694"));
+        Context.SetStringData(RPGEventKeys::DamageType, TEXT(""));
+        Context.SetIntData(RPGEventKeys::Roll, -17);
+        Context.SetIntData(TEXT("max_int"), MAX_int32);
+        Context.SetFloatData(TEXT("multiplier"), 1.5f);
+        Context.SetBoolData(RPGEventKeys::Advantage, true);
+        Context.SetBoolData(TEXT("critical"), false);
+        return Context;
+    }
+
+    /** Field-by-field comparison; OutMismatch names the first difference */
+    bool WireContextsMatch(const FRPGEventContext& Expected, const FRPGEventContext& Actual, FString& OutMismatch)
+    {
+        if (Expected.EventID != Actual.EventID) { OutMismatch = TEXT("EventID"); return false; }
+        if (Expected.EventType != Actual.EventType) { OutMismatch = TEXT("EventType"); return false; }
+        if (Expected.EventName != Actual.EventName) { OutMismatch = TEXT("EventName"); return false; }
+        if (Expected.Priority != Actual.Priority) { OutMismatch = TEXT("Priority"); return false; }
+        if (Expected.Timestamp != Actual.Timestamp) { OutMismatch = TEXT("Timestamp"); return false; }
+        if (Expected.bCancelled != Actual.bCancelled || Expected.bHandled != Actual.bHandled) { OutMismatch = TEXT("Flags"); return false; }
+        if (Expected.ModifierMask != Actual.ModifierMask) { OutMismatch = TEXT("ModifierMask"); return false; }
+        if (Expected.Data.Num() != Actual.Data.Num()) { OutMismatch = TEXT("Entry count"); return false; }
+        
+        bool bMatch = true;
+        Expected.Data.ForEach([&Actual, &bMatch, &OutMismatch](FName Key, ERPGEventValueType Type, const FRPGEventPayload& Payload, int32 Index)
+        {
+            if (!bMatch)
+            {
+                return;
+            }
+            
+            switch (Type)
+            {
+            case ERPGEventValueType::Int:
+                bMatch = Actual.Data.FindInt(Key) && *Actual.Data.FindInt(Key) == Payload.GetIntAt(Index);
+                break;
+            case ERPGEventValueType::Float:
+                bMatch = Actual.Data.FindFloat(Key) && *Actual.Data.FindFloat(Key) == Payload.GetFloatAt(Index);
+                break;
+            case ERPGEventValueType::Bool:
+                bMatch = Actual.Data.FindBool(Key) && *Actual.Data.FindBool(Key) == Payload.GetBoolAt(Index);
+                break;
+            default:
+            {
+                FStringView Value;
+                bMatch = Actual.Data.FindString(Key, Value) && Value.Equals(Payload.GetStringAt(Index), ESearchCase::CaseSensitive);
+                break;
+            }
+            }
+            
+            if (!bMatch)
+            {
+                OutMismatch = FString::Printf(TEXT("Entry '%s'"), *Key.ToString());
+            }
+        });
+        return bMatch;
+    }
+}
+
+FString URPGEventBusSubsystem::CheckEventWireRoundTrip()
+{
+    const FRPGEventContext Original = MakeWireTestEvent();
+    
+    TArray<uint8> Encoded;
+    const int32 Size = FRPGEventWireFormat::Encode(Original, Encoded);
+    
+    FString Report;
+    bool bPassed = true;
+    
+    // Native decode
+    FRPGEventContext Decoded;
+    FString Mismatch;
+    if (!FRPGEventWireFormat::Decode(Encoded.GetData(), Encoded.Num(), Decoded))
+    {
+        bPassed = false;
+        Report += TEXT(" | C++ decode failed");
+    }
+    else if (!WireContextsMatch(Original, Decoded, Mismatch))
+    {
+        bPassed = false;
+        Report += FString::Printf(TEXT(" | C++ round trip mismatch: %s"), *Mismatch);
+    }
+    else
+    {
+        Report += TEXT(" | C++ round trip OK");
+    }
+    
+    // Truncated buffers must be rejected, never read past the end
+    int32 AcceptedTruncations = 0;
+    for (int32 Length = 0; Length < Encoded.Num(); ++Length)
+    {
+        FRPGEventContext Partial;
+        AcceptedTruncations += FRPGEventWireFormat::Decode(Encoded.GetData(), Length, Partial) ? 1 : 0;
+    }
+    if (AcceptedTruncations > 0)
+    {
+        bPassed = false;
+        Report += FString::Printf(TEXT(" | %d truncated buffers accepted"), AcceptedTruncations);
+    }
+    else
+    {
+        Report += TEXT(" | truncation OK");
+    }
+    
+    // Through the Go decoder and encoder
+    if (IsSafeToCallFunction() && Toolkit->EchoEventBinary)
+    {
+        TArray<uint8> Echoed;
+        Echoed.SetNumUninitialized(Encoded.Num() * 2);
+        const int32 EchoedSize = Toolkit->EchoEventBinary(Encoded.GetData(), Encoded.Num(), Echoed.GetData(), Echoed.Num());
+        
+        FRPGEventContext GoDecoded;
+        if (EchoedSize <= 0 || !FRPGEventWireFormat::Decode(Echoed.GetData(), EchoedSize, GoDecoded))
+        {
+            bPassed = false;
+            Report += FString::Printf(TEXT(" | Go echo failed (%d)"), EchoedSize);
+        }
+        else if (EchoedSize != Encoded.Num() || FMemory::Memcmp(Echoed.GetData(), Encoded.GetData(), EchoedSize) != 0
+            || !WireContextsMatch(Original, GoDecoded, Mismatch))
+        {
+            bPassed = false;
+            Report += FString::Printf(TEXT(" | Go round trip mismatch: %s"), Mismatch.IsEmpty() ? TEXT("bytes differ") : *Mismatch);
+        }
+        else
+        {
+            Report += TEXT(" | Go round trip OK");
+        }
+    }
+    else
+    {
+        Report += TEXT(" | Go round trip skipped (toolkit not loaded)");
+    }
+    
+    Report = FString::Printf(TEXT("%s: %d entries, %d bytes"), bPassed ? TEXT("PASS") : TEXT("FAIL"), Original.Data.Num(), Size) + Report;
+    UE_LOG(LogTemp, Log, TEXT("RPGEventBusSubsystem::CheckEventWireRoundTrip: %s"), *Report);
+    return Report;
+}
+
+FString URPGEventBusSubsystem::BenchmarkEventWire(int32 NumEvents)
+{
+    if (NumEvents <= 0)
+    {
+        return TEXT("BenchmarkEventWire: NumEvents must be positive");
+    }
+    
+    // Both formats are built in scratch buffers only - nothing reaches the toolkit bus or its subscribers
+    const FRPGEventContext Context = MakeWireTestEvent();
+    
+    // Binary: reuse one buffer, as PublishEventBinary does
+    TArray<uint8> Buffer;
+    int64 BinaryBytes = 0;
+    const double BinaryStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumEvents; ++Index)
+    {
+        Buffer.Reset();
+        BinaryBytes += FRPGEventWireFormat::Encode(Context, Buffer);
+    }
+    const double BinarySeconds = FPlatformTime::Seconds() - BinaryStart;
+    
+    // Decode the last buffer into one reused context, as the toolkit inbox does
+    FRPGEventContext Decoded;
+    int32 DecodeFailures = 0;
+    const double DecodeStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumEvents; ++Index)
+    {
+        DecodeFailures += FRPGEventWireFormat::Decode(Buffer.GetData(), Buffer.Num(), Decoded) ? 0 : 1;
+    }
+    const double DecodeSeconds = FPlatformTime::Seconds() - DecodeStart;
+    
+    // Legacy: Printf header + the ANSI conversions PublishEvent makes (payload entries not even included)
+    int64 LegacyBytes = 0;
+    const double LegacyStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumEvents; ++Index)
+    {
+        const FString ContextData = FString::Printf(TEXT("{\"EventID\":\"%s\",\"EventName\":\"%s\",\"Timestamp\":%f}"),
+            *Context.EventID.ToString(), *Context.EventName.ToString(), Context.Timestamp);
+        const auto EventTypeAnsi = StringCast<ANSICHAR>(*RPGEventTypes::EventTypeToString(Context.EventType));
+        const auto ContextDataAnsi = StringCast<ANSICHAR>(*ContextData);
+        LegacyBytes += EventTypeAnsi.Length() + ContextDataAnsi.Length();
+    }
+    const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+    
+    FString Summary = FString::Printf(TEXT("%d events | binary %.1f ns/event, %lld bytes/event, %d entries (decode %.1f ns/event, %d failures) | printf JSON %.1f ns/event, %lld bytes/event, 0 entries"),
+        NumEvents,
+        BinarySeconds * 1e9 / NumEvents, BinaryBytes / NumEvents, Context.Data.Num(),
+        DecodeSeconds * 1e9 / NumEvents, DecodeFailures,
+        LegacySeconds * 1e9 / NumEvents, LegacyBytes / NumEvents);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGEventBusSubsystem::BenchmarkEventWire: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGEventBusSubsystem::BenchmarkEventQueue(int32 NumHandlers, int32 NumEvents)
+{
+    if (NumHandlers <= 0 || NumEvents <= 0 || !EventQueue.IsValid())
+    {
+        return TEXT("BenchmarkEventQueue: invalid handler/event count or queue not created");
+    }
+    
+    // Run on a private queue and dispatcher so pending game events, live handlers and their stats are untouched
+    FRPGEventProfiler BenchProfiler(TEXT("BenchmarkEventQueue"), false);
+    FRPGEventDispatcher BenchDispatcher;
+    BenchDispatcher.SetProfiler(&BenchProfiler);
+    FRPGEventArena Arena;
+    FRPGEventQueue Queue(Arena);
+    Queue.Settings = EventQueue->Settings;
+    
+    const ERPGEventPriority Priorities[] = { ERPGEventPriority::Critical, ERPGEventPriority::High, ERPGEventPriority::Normal, ERPGEventPriority::Low };
+    
+    TArray<URPGCountingEvent*> Handlers;
+    TArray<FRPGEventHandle> Handles;
+    for (int32 Index = 0; Index < NumHandlers; ++Index)
+    {
+        URPGCountingEvent* Handler = NewObject<URPGCountingEvent>(this);
+        Handlers.Add(Handler);
+        Handles.Add(BenchDispatcher.Subscribe(ERPGEventType::DiceRolled, Handler, ERPGEventPriority::Normal));
+    }
+    
+    FRPGEventContext Context(ERPGEventType::DiceRolled);
+    Context.SetIntData(TEXT("Sides"), 20);
+    
+    const double QueueStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumEvents; ++Index)
+    {
+        Context.Priority = Priorities[Index % UE_ARRAY_COUNT(Priorities)];
+        Queue.Enqueue(Context);
+    }
+    const double QueueSeconds = FPlatformTime::Seconds() - QueueStart;
+    
+    // Each flush stands in for one frame
+    int32 Flushes = 0;
+    float WorstFlushMs = 0.0f;
+    const double FlushStart = FPlatformTime::Seconds();
+    while (Queue.Num() > 0)
+    {
+        Queue.Flush(BenchDispatcher);
+        WorstFlushMs = FMath::Max(WorstFlushMs, Queue.GetStats().LastFlushMs);
+        ++Flushes;
+    }
+    const double FlushSeconds = FPlatformTime::Seconds() - FlushStart;
+    
+    int64 Delivered = 0;
+    for (URPGCountingEvent* Handler : Handlers)
+    {
+        Delivered += Handler->GetEventCount();
+    }
+    
+    for (FRPGEventHandle Handle : Handles)
+    {
+        BenchDispatcher.Unsubscribe(Handle);
+    }
+    
+    const int64 Expected = static_cast<int64>(NumHandlers) * NumEvents;
+    FString Summary = FString::Printf(TEXT("%d events x %d handlers | queue %.3f ms | drain %.3f ms over %d flushes (worst %.3f ms, budget %d events / %.2f ms) | Delivered %lld/%lld"),
+        NumEvents, NumHandlers, QueueSeconds * 1000.0, FlushSeconds * 1000.0, Flushes, WorstFlushMs,
+        Queue.Settings.MaxEventsPerFrame, Queue.Settings.FrameBudgetMs,
+        Delivered, Expected);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGEventBusSubsystem::BenchmarkEventQueue: %s"), *Summary);
+    return Summary;
+}
+#endif
+
+// Event Type Constants Implementation
+FString URPGEventBusSubsystem::GetEventBeforeAttackRoll() const
+{
+    return FRPGToolkitModule::GetConstants().EventBeforeAttackRoll.String;
+}
+
+FString URPGEventBusSubsystem::GetEventOnAttackRoll() const
+{
+    return FRPGToolkitModule::GetConstants().EventOnAttackRoll.String;
+}
+
+FString URPGEventBusSubsystem::GetEventAfterAttackRoll() const
+{
+    return FRPGToolkitModule::GetConstants().EventAfterAttackRoll.String;
+}
+
+FString URPGEventBusSubsystem::GetEventBeforeDamageRoll() const
+{
+    return FRPGToolkitModule::GetConstants().EventBeforeDamageRoll.String;
+}
+
+FString URPGEventBusSubsystem::GetEventOnTakeDamage() const
+{
+    return FRPGToolkitModule::GetConstants().EventOnTakeDamage.String;
+}
+
+FString URPGEventBusSubsystem::GetEventCalculateDamage() const
+{
+    return FRPGToolkitModule::GetConstants().EventCalculateDamage.String;
+}
+
+FString URPGEventBusSubsystem::GetEventAfterDamage() const
+{
+    return FRPGToolkitModule::GetConstants().EventAfterDamage.String;
+}
+
+FString URPGEventBusSubsystem::GetEventEntityPlaced() const
+{
+    return FRPGToolkitModule::GetConstants().EventEntityPlaced.String;
+}
+
+FString URPGEventBusSubsystem::GetEventEntityMoved() const
+{
+    return FRPGToolkitModule::GetConstants().EventEntityMoved.String;
+}
+
+FString URPGEventBusSubsystem::GetEventRoomCreated() const
+{
+    return FRPGToolkitModule::GetConstants().EventRoomCreated.String;
+}
+
+FString URPGEventBusSubsystem::GetEventTurnStart() const
+{
+    return FRPGToolkitModule::GetConstants().EventTurnStart.String;
+}
+
+FString URPGEventBusSubsystem::GetEventTurnEnd() const
+{
+    return FRPGToolkitModule::GetConstants().EventTurnEnd.String;
+}
+
+FString URPGEventBusSubsystem::GetEventRoundStart() const
+{
+    return FRPGToolkitModule::GetConstants().EventRoundStart.String;
+}
+
+FString URPGEventBusSubsystem::GetEventRoundEnd() const
+{
+    return FRPGToolkitModule::GetConstants().EventRoundEnd.String;
+}
+
+FString URPGEventBusSubsystem::GetEventStatusApplied() const
+{
+    return FRPGToolkitModule::GetConstants().EventStatusApplied.String;
+}
+
+FString URPGEventBusSubsystem::GetEventStatusRemoved() const
+{
+    return FRPGToolkitModule::GetConstants().EventStatusRemoved.String;
+}
+
+FString URPGEventBusSubsystem::GetEventStatusCheck() const
+{
+    return FRPGToolkitModule::GetConstants().EventStatusCheck.String;
+}
+
+// Context Key Constants Implementation
+FString URPGEventBusSubsystem::GetContextKeyAttacker() const
+{
+    return FRPGToolkitModule::GetConstants().ContextKeyAttacker.String;
+}
+
+FString URPGEventBusSubsystem::GetContextKeyTarget() const
+{
+    return FRPGToolkitModule::GetConstants().ContextKeyTarget.String;
+}
+
+FString URPGEventBusSubsystem::GetContextKeyWeapon() const
+{
+    return FRPGToolkitModule::GetConstants().ContextKeyWeapon.String;
+}
+
+FString URPGEventBusSubsystem::GetContextKeyDamageType() const
+{
+    return FRPGToolkitModule::GetConstants().ContextKeyDamageType.String;
+}
+
+FString URPGEventBusSubsystem::GetContextKeyAdvantage() const
+{
+    return FRPGToolkitModule::GetConstants().ContextKeyAdvantage.String;
+}
+
+FString URPGEventBusSubsystem::GetContextKeyRoll() const
+{
+    return FRPGToolkitModule::GetConstants().ContextKeyRoll.String;
+}
+
+FString URPGEventBusSubsystem::GetContextKeyOldPosition() const
+{
+    return FRPGToolkitModule::GetConstants().ContextKeyOldPosition.String;
+}
+
+FString URPGEventBusSubsystem::GetContextKeyNewPosition() const
+{
+    return FRPGToolkitModule::GetConstants().ContextKeyNewPosition.String;
+}
+
+FString URPGEventBusSubsystem::GetContextKeyRoomID() const
+{
+    return FRPGToolkitModule::GetConstants().ContextKeyRoomID.String;
+}
+
+// Modifier Creation Functions Implementation
+FString URPGEventBusSubsystem::CreateModifier(const FString& Source, const FString& ModifierType, int32 Value, int32 Priority)
+{
+    if (!IsSafeToCallFunction() || !Toolkit->CreateModifier)
+    {
+        return TEXT("ERROR: Function not available");
+    }
+    
+    ANSICHAR* CStr = Toolkit->CreateModifier(TCHAR_TO_ANSI(*Source), TCHAR_TO_ANSI(*ModifierType), Value, Priority);
     return ConvertAndFreeString(CStr);
 }
 
-FString URPGEventBusSubsystem::GetDurationUntilSave() const
+FString URPGEventBusSubsystem::CreateIntModifier(const FString& Source, const FString& ModifierType, int32 Value)
+{
+    if (!IsSafeToCallFunction() || !Toolkit->CreateIntModifier)
+    {
+        return TEXT("ERROR: Function not available");
+    }
+    
+    ANSICHAR* CStr = Toolkit->CreateIntModifier(TCHAR_TO_ANSI(*Source), TCHAR_TO_ANSI(*ModifierType), Value);
+    return ConvertAndFreeString(CStr);
+}
+
+FString URPGEventBusSubsystem::CreateDiceModifier(const FString& Source, const FString& ModifierType, const FString& DiceExpression)
 {
-    if (!IsSafeToCallFunction() || !GetDurationUntilSaveFuncPtr)
+    if (!IsSafeToCallFunction() || !Toolkit->CreateDiceModifier)
     {
-        return TEXT("until_save");
+        return TEXT("ERROR: Function not available");
     }
     
-    ANSICHAR* CStr = GetDurationUntilSaveFuncPtr();
+    ANSICHAR* CStr = Toolkit->CreateDiceModifier(TCHAR_TO_ANSI(*Source), TCHAR_TO_ANSI(*ModifierType), TCHAR_TO_ANSI(*DiceExpression));
     return ConvertAndFreeString(CStr);
 }
 
+// Duration Constants Implementation
+FString URPGEventBusSubsystem::GetDurationPermanent() const
+{
+    return FRPGToolkitModule::GetConstants().DurationPermanent.String;
+}
+
+FString URPGEventBusSubsystem::GetDurationRounds() const
+{
+    return FRPGToolkitModule::GetConstants().DurationRounds.String;
+}
+
+FString URPGEventBusSubsystem::GetDurationMinutes() const
+{
+    return FRPGToolkitModule::GetConstants().DurationMinutes.String;
+}
+
+FString URPGEventBusSubsystem::GetDurationHours() const
+{
+    return FRPGToolkitModule::GetConstants().DurationHours.String;
+}
+
+FString URPGEventBusSubsystem::GetDurationEncounter() const
+{
+    return FRPGToolkitModule::GetConstants().DurationEncounter.String;
+}
+
+FString URPGEventBusSubsystem::GetDurationConcentration() const
+{
+    return FRPGToolkitModule::GetConstants().DurationConcentration.String;
+}
+
+FString URPGEventBusSubsystem::GetDurationShortRest() const
+{
+    return FRPGToolkitModule::GetConstants().DurationShortRest.String;
+}
+
+FString URPGEventBusSubsystem::GetDurationLongRest() const
+{
+    return FRPGToolkitModule::GetConstants().DurationLongRest.String;
+}
+
+FString URPGEventBusSubsystem::GetDurationUntilDamaged() const
+{
+    return FRPGToolkitModule::GetConstants().DurationUntilDamaged.String;
+}
+
+FString URPGEventBusSubsystem::GetDurationUntilSave() const
+{
+    return FRPGToolkitModule::GetConstants().DurationUntilSave.String;
+}
+
 // Toolkit Status
 bool URPGEventBusSubsystem::IsToolkitLoaded() const
 {
@@ -627,105 +1620,33 @@ bool URPGEventBusSubsystem::IsToolkitLoaded() const
 }
 
 // Private Implementation
-void URPGEventBusSubsystem::LoadDLLFunctions()
+void URPGEventBusSubsystem::BindToolkitFunctions()
 {
-    // Use proper UE binary directory (following established pattern)
-    FString BinariesDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("Binaries"), FPlatformProcess::GetBinariesSubdirectory());
-    FString LibraryPath = FPaths::Combine(BinariesDir, TEXT("rpg_toolkit.dll"));
-    LibraryPath = FPaths::ConvertRelativePathToFull(LibraryPath);
-
-    UE_LOG(LogTemp, Warning, TEXT("RPGEventBusSubsystem: Attempting to load DLL from: %s"), *LibraryPath);
-
-    // Check if the DLL exists
-    if (!FPaths::FileExists(LibraryPath))
-    {
-        UE_LOG(LogTemp, Error, TEXT("RPGEventBusSubsystem: DLL not found at path: %s"), *LibraryPath);
-        return;
-    }
-
-    // Load the DLL
-    ToolkitDLLHandle = FPlatformProcess::GetDllHandle(*LibraryPath);
-    if (!ToolkitDLLHandle)
+    Toolkit = FRPGToolkitModule::Acquire(TEXT("RPGEventBusSubsystem"));
+    if (!Toolkit)
     {
-        UE_LOG(LogTemp, Error, TEXT("RPGEventBusSubsystem: Failed to load DLL"));
+        UE_LOG(LogTemp, Error, TEXT("RPGEventBusSubsystem: Toolkit DLL not available"));
         return;
     }
-
-    UE_LOG(LogTemp, Warning, TEXT("RPGEventBusSubsystem: Successfully loaded DLL"));
-    
-    // Load EventBus management functions
-    CreateEventBusFuncPtr = (CreateEventBusFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("CreateEventBus"));
-    PublishEventFuncPtr = (PublishEventFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("PublishEvent"));
-    SubscribeEventFuncPtr = (SubscribeEventFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("SubscribeEvent"));
-    UnsubscribeEventFuncPtr = (UnsubscribeEventFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("UnsubscribeEvent"));
-    
-    // Load Event type constant functions
-    GetEventBeforeAttackRollFuncPtr = (GetEventBeforeAttackRollFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventBeforeAttackRoll"));
-    GetEventOnAttackRollFuncPtr = (GetEventOnAttackRollFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventOnAttackRoll"));
-    GetEventAfterAttackRollFuncPtr = (GetEventAfterAttackRollFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventAfterAttackRoll"));
-    GetEventBeforeDamageRollFuncPtr = (GetEventBeforeDamageRollFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventBeforeDamageRoll"));
-    GetEventOnTakeDamageFuncPtr = (GetEventOnTakeDamageFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventOnTakeDamage"));
-    GetEventCalculateDamageFuncPtr = (GetEventCalculateDamageFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventCalculateDamage"));
-    GetEventAfterDamageFuncPtr = (GetEventAfterDamageFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventAfterDamage"));
-    GetEventEntityPlacedFuncPtr = (GetEventEntityPlacedFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventEntityPlaced"));
-    GetEventEntityMovedFuncPtr = (GetEventEntityMovedFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventEntityMoved"));
-    GetEventRoomCreatedFuncPtr = (GetEventRoomCreatedFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventRoomCreated"));
-    GetEventTurnStartFuncPtr = (GetEventTurnStartFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventTurnStart"));
-    GetEventTurnEndFuncPtr = (GetEventTurnEndFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventTurnEnd"));
-    GetEventRoundStartFuncPtr = (GetEventRoundStartFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventRoundStart"));
-    GetEventRoundEndFuncPtr = (GetEventRoundEndFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventRoundEnd"));
-    GetEventStatusAppliedFuncPtr = (GetEventStatusAppliedFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventStatusApplied"));
-    GetEventStatusRemovedFuncPtr = (GetEventStatusRemovedFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventStatusRemoved"));
-    GetEventStatusCheckFuncPtr = (GetEventStatusCheckFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetEventStatusCheck"));
-    
-    // Load Context key constant functions
-    GetContextKeyAttackerFuncPtr = (GetContextKeyAttackerFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetContextKeyAttacker"));
-    GetContextKeyTargetFuncPtr = (GetContextKeyTargetFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetContextKeyTarget"));
-    GetContextKeyWeaponFuncPtr = (GetContextKeyWeaponFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetContextKeyWeapon"));
-    GetContextKeyDamageTypeFuncPtr = (GetContextKeyDamageTypeFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetContextKeyDamageType"));
-    GetContextKeyAdvantageFuncPtr = (GetContextKeyAdvantageFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetContextKeyAdvantage"));
-    GetContextKeyRollFuncPtr = (GetContextKeyRollFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetContextKeyRoll"));
-    GetContextKeyOldPositionFuncPtr = (GetContextKeyOldPositionFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetContextKeyOldPosition"));
-    GetContextKeyNewPositionFuncPtr = (GetContextKeyNewPositionFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetContextKeyNewPosition"));
-    GetContextKeyRoomIDFuncPtr = (GetContextKeyRoomIDFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetContextKeyRoomID"));
-    
-    // Load Modifier creation functions
-    CreateModifierFuncPtr = (CreateModifierFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("CreateModifier"));
-    CreateIntModifierFuncPtr = (CreateIntModifierFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("CreateIntModifier"));
-    CreateDiceModifierFuncPtr = (CreateDiceModifierFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("CreateDiceModifier"));
-    
-    // Load Duration constant functions
-    GetDurationPermanentFuncPtr = (GetDurationPermanentFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDurationPermanent"));
-    GetDurationRoundsFuncPtr = (GetDurationRoundsFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDurationRounds"));
-    GetDurationMinutesFuncPtr = (GetDurationMinutesFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDurationMinutes"));
-    GetDurationHoursFuncPtr = (GetDurationHoursFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDurationHours"));
-    GetDurationEncounterFuncPtr = (GetDurationEncounterFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDurationEncounter"));
-    GetDurationConcentrationFuncPtr = (GetDurationConcentrationFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDurationConcentration"));
-    GetDurationShortRestFuncPtr = (GetDurationShortRestFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDurationShortRest"));
-    GetDurationLongRestFuncPtr = (GetDurationLongRestFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDurationLongRest"));
-    GetDurationUntilDamagedFuncPtr = (GetDurationUntilDamagedFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDurationUntilDamaged"));
-    GetDurationUntilSaveFuncPtr = (GetDurationUntilSaveFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDurationUntilSave"));
-    
-    // Load memory management function
-    FreeEventStringFuncPtr = (FreeEventStringFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("FreeEventString"));
     
     // Check if critical functions were loaded
-    bool bCriticalFunctionsLoaded = (CreateEventBusFuncPtr != nullptr) && 
-                                   (PublishEventFuncPtr != nullptr) && 
-                                   (FreeEventStringFuncPtr != nullptr);
+    bool bCriticalFunctionsLoaded = (Toolkit->CreateEventBus != nullptr) && 
+                                   (Toolkit->PublishEvent != nullptr) && 
+                                   (Toolkit->FreeEventString != nullptr);
     
     if (bCriticalFunctionsLoaded)
     {
         bFunctionsLoaded = true;
+        Executor = FRPGToolkitExecutor::Acquire(TEXT("RPGEventBusSubsystem"));
         UE_LOG(LogTemp, Warning, TEXT("RPGEventBusSubsystem: All critical event functions loaded successfully"));
         
         // Log status of all functions
         UE_LOG(LogTemp, Log, TEXT("=== Event Function Loading Status ==="));
         UE_LOG(LogTemp, Log, TEXT("EventBus Functions:"));
-        UE_LOG(LogTemp, Log, TEXT("  CreateEventBus: %s"), CreateEventBusFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  PublishEvent: %s"), PublishEventFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  SubscribeEvent: %s"), SubscribeEventFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  UnsubscribeEvent: %s"), UnsubscribeEventFuncPtr ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  CreateEventBus: %s"), Toolkit->CreateEventBus ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  PublishEvent: %s"), Toolkit->PublishEvent ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  SubscribeEvent: %s"), Toolkit->SubscribeEvent ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  UnsubscribeEvent: %s"), Toolkit->UnsubscribeEvent ? TEXT("OK") : TEXT("FAILED"));
         UE_LOG(LogTemp, Log, TEXT("================================"));
     }
     else
@@ -744,9 +1665,9 @@ FString URPGEventBusSubsystem::ConvertAndFreeString(ANSICHAR* CStr) const
     FString Result = FString(ANSI_TO_TCHAR(CStr));
     
     // Free the C string memory
-    if (FreeEventStringFuncPtr)
+    if (Toolkit && Toolkit->FreeEventString)
     {
-        FreeEventStringFuncPtr(CStr);
+        Toolkit->FreeEventString(CStr);
     }
     
     return Result;
@@ -755,5 +1676,5 @@ FString URPGEventBusSubsystem::ConvertAndFreeString(ANSICHAR* CStr) const
 bool URPGEventBusSubsystem::IsSafeToCallFunction() const
 {
     // Following established pattern for shutdown safety
-    return bFunctionsLoaded && ToolkitDLLHandle != nullptr;
+    return bFunctionsLoaded && Toolkit != nullptr;
 }
\ No newline at end of file
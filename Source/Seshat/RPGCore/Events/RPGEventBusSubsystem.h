@@ -2,14 +2,24 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
-#include "HAL/PlatformProcess.h"
+#include "Async/Future.h"
+#include "Engine/EngineBaseTypes.h"
+#include "RPGEvent.h"
+#include "RPGEventQueue.h"
+#include "RPGEventArena.h"
+#include "RPGToolkitEventInbox.h"
+#include "RPGEventProfiler.h"
 #include "RPGEventBusSubsystem.generated.h"
 
+// Forward declarations
+struct FRPGToolkitAPI;
+class FRPGToolkitExecutor;
+class FRPGEventDispatcher;
+
 /**
  * Core toolkit integration subsystem for RPG events
- * Exposes the actual rpg-toolkit events package functions
- * NO custom event management - just raw toolkit exposure
- * Swiss Army Knife Standard: 1:1 mapping of toolkit API
+ * Exposes the actual rpg-toolkit events package functions (1:1 mapping of toolkit API)
+ * and owns the in-process dispatcher that delivers events to IRPGEventInterface handlers
  */
 UCLASS()
 class SESHAT_API URPGEventBusSubsystem : public UGameInstanceSubsystem
@@ -22,6 +32,8 @@ public:
     virtual void Deinitialize() override;
     // End USubsystem
 
+    static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
     // EventBus Management Functions (from events/eventbus.go)
     UFUNCTION(BlueprintCallable, Category = "RPG Events")
     FString CreateEventBus();
@@ -29,11 +41,208 @@ public:
     UFUNCTION(BlueprintCallable, Category = "RPG Events")
     bool PublishEvent(const FString& EventType, const FString& SourceID, const FString& TargetID, const FString& ContextData);
     
+    /**
+     * PublishEvent on the toolkit worker pool
+     * @param bBatchPerFrame Send with the rest of this frame's publishes as one pool hand-off (default)
+     */
+    TFuture<bool> PublishEventAsync(const FString& EventType, const FString& SourceID, const FString& TargetID, const FString& ContextData, bool bBatchPerFrame = true);
+
+    /** PublishEventAsync with the result delivered to OnComplete on the game thread */
+    void PublishEventAsync(const FString& EventType, const FString& SourceID, const FString& TargetID, const FString& ContextData, TUniqueFunction<void(bool)> OnComplete, bool bBatchPerFrame = true);
+    
+    /**
+     * Publish a full event context to the toolkit bus in the binary wire format (FRPGEventWireFormat)
+     * Every payload entry, entity reference and flag reaches the Go side; falls back to PublishEvent
+     * with a JSON header when the loaded toolkit predates PublishEventBinary
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events")
+    bool PublishEventBinary(const FRPGEventContext& EventContext);
+    
     UFUNCTION(BlueprintCallable, Category = "RPG Events")
     FString SubscribeEvent(const FString& EventType, int32 Priority);
     
     UFUNCTION(BlueprintCallable, Category = "RPG Events")
     bool UnsubscribeEvent(const FString& SubscriptionID);
+    
+    /**
+     * Toolkit subscriptions (SubscribeEvent) forward their events back through a lock-free inbox ring
+     * that is drained into the event queue on every flush, so they reach the in-process handlers
+     * SourceID/TargetID/ToolkitOrigin (RPGEventKeys) are set on delivered events
+     * @return Number of events moved from the inbox to the queue
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Queue")
+    int32 DrainToolkitEvents();
+
+    /** Go -> UE depth, drops and latency */
+    UFUNCTION(BlueprintPure, Category = "RPG Events|Queue")
+    FRPGToolkitEventInboxStats GetToolkitInboxStats() const;
+
+    // In-Process Dispatch - C++/Blueprint IRPGEventInterface handlers, no toolkit round trip
+    /**
+     * Subscribe a handler to one event type
+     * @param Duration Lifetime in seconds for TimeLimited subscriptions
+     * @param Access ReadOnly handlers run after the priority chain, in parallel on the task graph when native;
+     *               they must not touch game state and are joined before the next frame
+     * @return Handle for UnsubscribeHandler, invalid if Handler is null
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Dispatch")
+    FRPGEventHandle SubscribeHandler(ERPGEventType EventType, TScriptInterface<IRPGEventInterface> Handler,
+        ERPGEventPriority Priority = ERPGEventPriority::Normal,
+        ERPGEventSubscriptionType SubscriptionType = ERPGEventSubscriptionType::Persistent,
+        float Duration = 0.0f,
+        ERPGEventHandlerAccess Access = ERPGEventHandlerAccess::Mutating);
+
+    /** Subscribe to Custom events whose EventName is CustomEventName */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Dispatch")
+    FRPGEventHandle SubscribeCustomHandler(FName CustomEventName, TScriptInterface<IRPGEventInterface> Handler,
+        ERPGEventPriority Priority = ERPGEventPriority::Normal,
+        ERPGEventSubscriptionType SubscriptionType = ERPGEventSubscriptionType::Persistent,
+        float Duration = 0.0f,
+        ERPGEventHandlerAccess Access = ERPGEventHandlerAccess::Mutating);
+
+    /**
+     * Subscribe to one event type for a single entity - only events whose source and/or target is EntityID
+     * reach the handler, without it seeing (and filtering) every other entity's events
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Dispatch")
+    FRPGEventHandle SubscribeEntityHandler(ERPGEventType EventType, const FString& EntityID, ERPGEventEntityScope Scope,
+        TScriptInterface<IRPGEventInterface> Handler,
+        ERPGEventPriority Priority = ERPGEventPriority::Normal,
+        ERPGEventSubscriptionType SubscriptionType = ERPGEventSubscriptionType::Persistent,
+        float Duration = 0.0f,
+        ERPGEventHandlerAccess Access = ERPGEventHandlerAccess::Mutating);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Dispatch")
+    bool UnsubscribeHandler(FRPGEventHandle Handle);
+
+    /** Remove every subscription scoped to EntityID (call when the entity is destroyed) */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Dispatch")
+    int32 UnsubscribeEntityHandlers(const FString& EntityID);
+
+    /** False once the subscription has been removed, spent (OneTime) or expired (TimeLimited) */
+    UFUNCTION(BlueprintPure, Category = "RPG Events|Dispatch")
+    bool IsHandlerSubscribed(FRPGEventHandle Handle) const;
+
+    /** Remove every subscription Handler has for EventType */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Dispatch")
+    bool UnsubscribeHandlerFromEventType(ERPGEventType EventType, TScriptInterface<IRPGEventInterface> Handler);
+
+    /**
+     * Deliver an event to in-process handlers in priority order
+     * bHandled/bCancelled on EventContext reflect what the handlers did
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Dispatch")
+    ERPGEventResult DispatchEvent(UPARAM(ref) FRPGEventContext& EventContext);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Dispatch")
+    int32 GetHandlerCount(ERPGEventType EventType) const;
+
+    // Queued Publish - deferred delivery drained once per frame
+    /**
+     * Queue an event for the next flush
+     * Queued events drain at the configured flush phase in priority order (FIFO within a priority).
+     * Events queued by handlers during a flush cascade into the same flush while budget remains.
+     * @return False if the event was dropped for exceeding MaxCascadeDepth
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Queue")
+    bool QueueEvent(const FRPGEventContext& EventContext);
+
+    /**
+     * Drain the toolkit inbox and then the queue now, within the per-frame budget
+     * @return Number of events dispatched
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Queue")
+    int32 FlushEventQueue();
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Queue")
+    void SetEventQueueSettings(const FRPGEventQueueSettings& Settings);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Events|Queue")
+    FRPGEventQueueSettings GetEventQueueSettings() const;
+
+    UFUNCTION(BlueprintPure, Category = "RPG Events|Queue")
+    FRPGEventQueueStats GetEventQueueStats() const;
+
+    // Profiling - also available as stat RPGEvents, the RPGEvents Insights channel and rpg.Events.DumpTopHandlers
+    /** Per-type publish counts, dispatch/queue/cascade depth and handler totals since the last reset */
+    UFUNCTION(BlueprintPure, Category = "RPG Events|Profiling")
+    FRPGEventBusStats GetEventBusStats() const;
+
+    /** Most expensive handlers by total time (empty unless rpg.Events.ProfileHandlers is on) */
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Profiling")
+    TArray<FRPGEventHandlerProfile> GetTopEventHandlers(int32 Count = 10) const;
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Events|Profiling")
+    void ResetEventProfile();
+
+#if !UE_BUILD_SHIPPING
+    // Benchmarks - development builds only, run from the console (rpg.Bench.*)
+    /** Publish throughput: NumEvents dispatches to NumHandlers counting handlers */
+    FString BenchmarkEventDispatch(int32 NumHandlers = 16, int32 NumEvents = 100000);
+
+    /**
+     * DamageReceived events aimed at one of NumEntities entities, each watched by its own handler:
+     * global subscriptions (every handler visited) against entity-scoped ones
+     */
+    FString BenchmarkEntityRouting(int32 NumEntities = 500, int32 NumEvents = 10000);
+
+    /**
+     * Publish latency with NumHandlers observers that each spend WorkMicroseconds per event:
+     * mutating subscriptions (all on the game thread) against read-only ones (task graph, joined at the end)
+     */
+    FString BenchmarkReadOnlyHandlers(int32 NumHandlers = 64, int32 NumEvents = 1000, float WorkMicroseconds = 2.0f);
+#endif
+
+    // Event Arena - per-frame context storage, reset at the end of every frame
+    /** A cleared context valid until end of frame; Retain it to keep it longer */
+    FRPGEventContext& AcquireFrameEvent(ERPGEventType EventType, TScriptInterface<IRPGEntityInterface> Source = nullptr);
+
+    /** Keep an arena context alive past the end of frame until ReleaseEvent */
+    bool RetainEvent(const FRPGEventContext& EventContext);
+
+    bool ReleaseEvent(const FRPGEventContext& EventContext);
+
+    /** Arena for the URPGEvent::Create*Event arena overloads (null before Initialize) */
+    FRPGEventArena* GetEventArena() const { return EventArena.Get(); }
+
+    UFUNCTION(BlueprintPure, Category = "RPG Events|Arena")
+    FRPGEventArenaStats GetEventArenaStats() const;
+
+#if !UE_BUILD_SHIPPING
+    /**
+     * Heap allocations per combat event: the old TMap/FString context layout against FRPGEventContext's inline payload
+     * Each event carries four string, one int, one float and one bool value plus a modifier.
+     */
+    FString BenchmarkEventContext(int32 NumEvents = 10000);
+
+    /**
+     * Heap allocations per combat round of NumCombatants attacks (attack event, target check, damage event):
+     * entity IDs carried and compared as GUID strings against FRPGEntityId
+     */
+    FString BenchmarkCombatRoundAllocations(int32 NumCombatants = 8, int32 NumRounds = 100);
+
+    /**
+     * Heap allocations per event: by-value URPGEvent::CreateCombatEvent against the arena overload over NumFrames frames
+     * Each event carries a payload large enough to spill out of the inline buffers.
+     */
+    FString BenchmarkEventArena(int32 EventsPerFrame = 256, int32 NumFrames = 60);
+
+    /**
+     * Encode/decode an event carrying every value type and compare it field by field,
+     * in C++ and (when the toolkit is loaded) through the Go codec via EchoEventBinary
+     * @return Report starting with PASS or FAIL
+     */
+    FString CheckEventWireRoundTrip();
+
+    /** Binary encode/decode against the Printf JSON string path, in scratch buffers (nothing is published) */
+    FString BenchmarkEventWire(int32 NumEvents = 10000);
+
+    /** Queue NumEvents with mixed priorities and drain them under the current settings, reporting flushes needed */
+    FString BenchmarkEventQueue(int32 NumHandlers = 16, int32 NumEvents = 100000);
+#endif
+
+    // Toolkit constants below are memory reads from FRPGToolkitModule::GetConstants(); native code should
+    // use that table directly and compare its FNames (e.g. against FRPGEventContext::EventName)
 
     // Event Type Constants (from events/types.go)
     UFUNCTION(BlueprintCallable, Category = "RPG Events")
@@ -161,120 +370,66 @@ public:
     bool IsToolkitLoaded() const;
 
 private:
-    /** Function pointers to actual toolkit DLL functions */
-    typedef ANSICHAR* (*CreateEventBusFunc)();
-    typedef int32 (*PublishEventFunc)(const ANSICHAR*, const ANSICHAR*, const ANSICHAR*, const ANSICHAR*);
-    typedef ANSICHAR* (*SubscribeEventFunc)(const ANSICHAR*, int32);
-    typedef int32 (*UnsubscribeEventFunc)(const ANSICHAR*);
-    
-    // Event type constant functions
-    typedef ANSICHAR* (*GetEventBeforeAttackRollFunc)();
-    typedef ANSICHAR* (*GetEventOnAttackRollFunc)();
-    typedef ANSICHAR* (*GetEventAfterAttackRollFunc)();
-    typedef ANSICHAR* (*GetEventBeforeDamageRollFunc)();
-    typedef ANSICHAR* (*GetEventOnTakeDamageFunc)();
-    typedef ANSICHAR* (*GetEventCalculateDamageFunc)();
-    typedef ANSICHAR* (*GetEventAfterDamageFunc)();
-    typedef ANSICHAR* (*GetEventEntityPlacedFunc)();
-    typedef ANSICHAR* (*GetEventEntityMovedFunc)();
-    typedef ANSICHAR* (*GetEventRoomCreatedFunc)();
-    typedef ANSICHAR* (*GetEventTurnStartFunc)();
-    typedef ANSICHAR* (*GetEventTurnEndFunc)();
-    typedef ANSICHAR* (*GetEventRoundStartFunc)();
-    typedef ANSICHAR* (*GetEventRoundEndFunc)();
-    typedef ANSICHAR* (*GetEventStatusAppliedFunc)();
-    typedef ANSICHAR* (*GetEventStatusRemovedFunc)();
-    typedef ANSICHAR* (*GetEventStatusCheckFunc)();
-    
-    // Context key constant functions
-    typedef ANSICHAR* (*GetContextKeyAttackerFunc)();
-    typedef ANSICHAR* (*GetContextKeyTargetFunc)();
-    typedef ANSICHAR* (*GetContextKeyWeaponFunc)();
-    typedef ANSICHAR* (*GetContextKeyDamageTypeFunc)();
-    typedef ANSICHAR* (*GetContextKeyAdvantageFunc)();
-    typedef ANSICHAR* (*GetContextKeyRollFunc)();
-    typedef ANSICHAR* (*GetContextKeyOldPositionFunc)();
-    typedef ANSICHAR* (*GetContextKeyNewPositionFunc)();
-    typedef ANSICHAR* (*GetContextKeyRoomIDFunc)();
-    
-    // Modifier creation functions
-    typedef ANSICHAR* (*CreateModifierFunc)(const ANSICHAR*, const ANSICHAR*, int32, int32);
-    typedef ANSICHAR* (*CreateIntModifierFunc)(const ANSICHAR*, const ANSICHAR*, int32);
-    typedef ANSICHAR* (*CreateDiceModifierFunc)(const ANSICHAR*, const ANSICHAR*, const ANSICHAR*);
-    
-    // Duration constant functions
-    typedef ANSICHAR* (*GetDurationPermanentFunc)();
-    typedef ANSICHAR* (*GetDurationRoundsFunc)();
-    typedef ANSICHAR* (*GetDurationMinutesFunc)();
-    typedef ANSICHAR* (*GetDurationHoursFunc)();
-    typedef ANSICHAR* (*GetDurationEncounterFunc)();
-    typedef ANSICHAR* (*GetDurationConcentrationFunc)();
-    typedef ANSICHAR* (*GetDurationShortRestFunc)();
-    typedef ANSICHAR* (*GetDurationLongRestFunc)();
-    typedef ANSICHAR* (*GetDurationUntilDamagedFunc)();
-    typedef ANSICHAR* (*GetDurationUntilSaveFunc)();
-    
-    typedef void (*FreeEventStringFunc)(ANSICHAR*);
-    
-    // Function pointer instances
-    CreateEventBusFunc CreateEventBusFuncPtr;
-    PublishEventFunc PublishEventFuncPtr;
-    SubscribeEventFunc SubscribeEventFuncPtr;
-    UnsubscribeEventFunc UnsubscribeEventFuncPtr;
-    
-    GetEventBeforeAttackRollFunc GetEventBeforeAttackRollFuncPtr;
-    GetEventOnAttackRollFunc GetEventOnAttackRollFuncPtr;
-    GetEventAfterAttackRollFunc GetEventAfterAttackRollFuncPtr;
-    GetEventBeforeDamageRollFunc GetEventBeforeDamageRollFuncPtr;
-    GetEventOnTakeDamageFunc GetEventOnTakeDamageFuncPtr;
-    GetEventCalculateDamageFunc GetEventCalculateDamageFuncPtr;
-    GetEventAfterDamageFunc GetEventAfterDamageFuncPtr;
-    GetEventEntityPlacedFunc GetEventEntityPlacedFuncPtr;
-    GetEventEntityMovedFunc GetEventEntityMovedFuncPtr;
-    GetEventRoomCreatedFunc GetEventRoomCreatedFuncPtr;
-    GetEventTurnStartFunc GetEventTurnStartFuncPtr;
-    GetEventTurnEndFunc GetEventTurnEndFuncPtr;
-    GetEventRoundStartFunc GetEventRoundStartFuncPtr;
-    GetEventRoundEndFunc GetEventRoundEndFuncPtr;
-    GetEventStatusAppliedFunc GetEventStatusAppliedFuncPtr;
-    GetEventStatusRemovedFunc GetEventStatusRemovedFuncPtr;
-    GetEventStatusCheckFunc GetEventStatusCheckFuncPtr;
-    
-    GetContextKeyAttackerFunc GetContextKeyAttackerFuncPtr;
-    GetContextKeyTargetFunc GetContextKeyTargetFuncPtr;
-    GetContextKeyWeaponFunc GetContextKeyWeaponFuncPtr;
-    GetContextKeyDamageTypeFunc GetContextKeyDamageTypeFuncPtr;
-    GetContextKeyAdvantageFunc GetContextKeyAdvantageFuncPtr;
-    GetContextKeyRollFunc GetContextKeyRollFuncPtr;
-    GetContextKeyOldPositionFunc GetContextKeyOldPositionFuncPtr;
-    GetContextKeyNewPositionFunc GetContextKeyNewPositionFuncPtr;
-    GetContextKeyRoomIDFunc GetContextKeyRoomIDFuncPtr;
-    
-    CreateModifierFunc CreateModifierFuncPtr;
-    CreateIntModifierFunc CreateIntModifierFuncPtr;
-    CreateDiceModifierFunc CreateDiceModifierFuncPtr;
-    
-    GetDurationPermanentFunc GetDurationPermanentFuncPtr;
-    GetDurationRoundsFunc GetDurationRoundsFuncPtr;
-    GetDurationMinutesFunc GetDurationMinutesFuncPtr;
-    GetDurationHoursFunc GetDurationHoursFuncPtr;
-    GetDurationEncounterFunc GetDurationEncounterFuncPtr;
-    GetDurationConcentrationFunc GetDurationConcentrationFuncPtr;
-    GetDurationShortRestFunc GetDurationShortRestFuncPtr;
-    GetDurationLongRestFunc GetDurationLongRestFuncPtr;
-    GetDurationUntilDamagedFunc GetDurationUntilDamagedFuncPtr;
-    GetDurationUntilSaveFunc GetDurationUntilSaveFuncPtr;
-    
-    FreeEventStringFunc FreeEventStringFuncPtr;
-    
-    /** Whether the DLL functions were successfully loaded */
+    /** Shared toolkit function table (borrowed from FRPGToolkitModule) */
+    const FRPGToolkitAPI* Toolkit;
+    
+    /** Shared worker pool for off-game-thread publishes */
+    FRPGToolkitExecutor* Executor = nullptr;
+    
+    /** In-process handler registry (always available, with or without the toolkit) */
+    TSharedPtr<FRPGEventDispatcher> Dispatcher;
+    
+    /** Dispatch counters and handler timing (must outlive Dispatcher) */
+    TSharedPtr<FRPGEventProfiler> Profiler;
+    
+    /** Per-frame context storage (must outlive EventQueue) */
+    TSharedPtr<FRPGEventArena> EventArena;
+    
+    /** Deferred events waiting for the flush phase */
+    TSharedPtr<FRPGEventQueue> EventQueue;
+    
+    /** End-of-frame arena reset */
+    FDelegateHandle EndFrameHandle;
+    
+    /** Joins read-only handlers before garbage collection */
+    FDelegateHandle PreGarbageCollectHandle;
+    
+    /** Events forwarded by toolkit subscribers, written from Go threads (null without RegisterEventCallback) */
+    TSharedPtr<FRPGToolkitEventInbox> ToolkitInbox;
+    
+    /** Decode target for inbox events before they are queued (holds no object references) */
+    FRPGEventContext InboxDecodeContext;
+    
+    /** Reused encode buffer for PublishEventBinary (game thread) */
+    TArray<uint8> WireBuffer;
+    
+    /** Tick delegate bound for the current flush phase */
+    FDelegateHandle FlushDelegateHandle;
+    ERPGEventFlushPhase BoundFlushPhase = ERPGEventFlushPhase::Manual;
+    
+    /** Whether the critical toolkit functions are available */
     bool bFunctionsLoaded;
     
-    /** Handle to the loaded DLL */
-    void* ToolkitDLLHandle;
+    /** Borrow the shared toolkit function table and check critical functions */
+    void BindToolkitFunctions();
+    
+    /** Bind the tick delegate for the configured flush phase, unbinding the previous one */
+    void BindFlushPhase(ERPGEventFlushPhase Phase);
+    
+    /** World tick phases - flush only for worlds owned by this game instance */
+    void HandleWorldTickPhase(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+    
+    /** FCoreDelegates::OnEndFrame - EndOfFrame flush, read-only handler join, then the arena reset */
+    void HandleEndFrame();
+    
+    /** Worker threads must not be inside a handler while objects are collected */
+    void HandlePreGarbageCollect();
+    
+    /** Whether the queue or the toolkit inbox has anything to flush */
+    bool HasPendingEvents() const;
     
-    /** Load the DLL and function pointers */
-    void LoadDLLFunctions();
+    /** Pre-binary publish: event type, entity IDs and a JSON header through PublishEvent */
+    bool PublishEventLegacy(const FRPGEventContext& EventContext);
     
     /** Helper to convert C string and free memory */
     FString ConvertAndFreeString(ANSICHAR* CStr) const;
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "RPGEventTypes.h"
+#include "RPGEventPayload.h"
 #include "../Entity/RPGEntity.h"
 #include "../RPGCoreTypes.h"
 #include "RPGEventContext.generated.h"
@@ -9,6 +10,12 @@
 /**
  * Event context data structure that carries information about an event
  * This is the primary data container for all RPG events
+ *
+ * Blueprint migration from the map-based context: EventID is an FGuid (GetContextEventIDString gives the old
+ * string), EventName is an FName (Blueprint converts it to a string implicitly), Modifiers is the ModifierMask
+ * bitmask, and the StringData/IntData/FloatData/BoolData/ObjectData maps live in Data. Pins that read or set the
+ * removed properties move to the URPGEvent "Context Data|Legacy" nodes, which take and return the same maps and
+ * arrays, or to the keyed Get/SetContext* nodes.
  */
 USTRUCT(BlueprintType)
 struct SESHAT_API FRPGEventContext
@@ -21,29 +28,32 @@ struct SESHAT_API FRPGEventContext
         , Timestamp(0.0f)
         , bCancelled(false)
         , bHandled(false)
+        , ModifierMask(0)
     {
     }
 
     FRPGEventContext(ERPGEventType InEventType, TScriptInterface<IRPGEntityInterface> InSource = nullptr)
-        : EventType(InEventType)
+        : EventID(FGuid::NewGuid())
+        , EventType(InEventType)
         , SourceEntity(InSource)
         , Priority(ERPGEventPriority::Normal)
         , Timestamp(FApp::GetCurrentTime())
         , bCancelled(false)
         , bHandled(false)
+        , ModifierMask(0)
     {
-        EventID = FGuid::NewGuid().ToString();
     }
 
     // Core event identification
     UPROPERTY(BlueprintReadOnly, Category = "RPG Event Context")
-    FString EventID;
+    FGuid EventID;
 
     UPROPERTY(BlueprintReadOnly, Category = "RPG Event Context")
     ERPGEventType EventType;
 
-    UPROPERTY(BlueprintReadOnly, Category = "RPG Event Context")
-    FString EventName;
+    /** Custom event name (interned; Custom events dispatch to the channel subscribed under this name) */
+    UPROPERTY(BlueprintReadWrite, Category = "RPG Event Context")
+    FName EventName;
 
     // Entity references
     UPROPERTY(BlueprintReadOnly, Category = "RPG Event Context")
@@ -68,117 +78,120 @@ struct SESHAT_API FRPGEventContext
     UPROPERTY(BlueprintReadWrite, Category = "RPG Event Context")
     bool bHandled;
 
-    // Event modifiers
-    UPROPERTY(BlueprintReadWrite, Category = "RPG Event Context")
-    TArray<ERPGEventModifier> Modifiers;
-
-    // Generic data storage using key-value pairs
-    UPROPERTY(BlueprintReadWrite, Category = "RPG Event Context")
-    TMap<FString, FString> StringData;
+    // Event modifiers - one bit per ERPGEventModifier value
+    UPROPERTY(BlueprintReadWrite, Category = "RPG Event Context", meta = (Bitmask, BitmaskEnum = "/Script/Seshat.ERPGEventModifier"))
+    int32 ModifierMask;
 
-    UPROPERTY(BlueprintReadWrite, Category = "RPG Event Context")
-    TMap<FString, int32> IntData;
+    // Generic key/value data (Blueprint access through the URPGEvent context data helpers)
+    UPROPERTY()
+    FRPGEventPayload Data;
 
-    UPROPERTY(BlueprintReadWrite, Category = "RPG Event Context")
-    TMap<FString, float> FloatData;
+    // Utility methods for data access (regular C++ methods only in USTRUCT)
+    void SetStringData(const FRPGEventKey& Key, FStringView Value)
+    {
+        Data.SetString(Key.Name, Value);
+    }
 
-    UPROPERTY(BlueprintReadWrite, Category = "RPG Event Context")
-    TMap<FString, bool> BoolData;
+    /** String value, or the ID of an entity stored under Key (see SetEntityData) */
+    FString GetStringData(const FRPGEventKey& Key, const FString& DefaultValue = TEXT("")) const
+    {
+        FStringView Value;
+        return FindStringOrEntityID(Key, Value) ? FString(Value) : DefaultValue;
+    }
 
-    // Custom payload data (for complex data structures)
-    UPROPERTY(BlueprintReadWrite, Category = "RPG Event Context")
-    TMap<FString, UObject*> ObjectData;
+    /** Allocation-free string read; the view is invalidated by the next SetStringData */
+    FStringView GetStringView(const FRPGEventKey& Key) const
+    {
+        FStringView Value;
+        FindStringOrEntityID(Key, Value);
+        return Value;
+    }
 
-    // Utility methods for data access (regular C++ methods only in USTRUCT)
-    void SetStringData(const FString& Key, const FString& Value)
+    /** Store an entity by reference - its ID is only turned into a string by readers and the wire format */
+    void SetEntityData(const FRPGEventKey& Key, const TScriptInterface<IRPGEntityInterface>& Entity)
     {
-        StringData.Add(Key, Value);
+        Data.SetObject(Key.Name, Entity.GetObject());
     }
 
-    FString GetStringData(const FString& Key, const FString& DefaultValue = TEXT("")) const
+    /** Compact ID of an entity stored under Key, or of a string ID that was converted before; invalid otherwise */
+    FRPGEntityId GetEntityIdData(const FRPGEventKey& Key) const
     {
-        if (const FString* Value = StringData.Find(Key))
+        if (const IRPGEntityInterface* Entity = Cast<IRPGEntityInterface>(Data.FindObject(Key.Name)))
         {
-            return *Value;
+            return Entity->GetCompactID();
         }
-        return DefaultValue;
+
+        FStringView Value;
+        return Data.FindString(Key.Name, Value) ? FRPGEntityId::Find(Value) : FRPGEntityId();
     }
 
-    void SetIntData(const FString& Key, int32 Value)
+    void SetIntData(const FRPGEventKey& Key, int32 Value)
     {
-        IntData.Add(Key, Value);
+        Data.SetInt(Key.Name, Value);
     }
 
-    int32 GetIntData(const FString& Key, int32 DefaultValue = 0) const
+    int32 GetIntData(const FRPGEventKey& Key, int32 DefaultValue = 0) const
     {
-        if (const int32* Value = IntData.Find(Key))
-        {
-            return *Value;
-        }
-        return DefaultValue;
+        const int32* Value = Data.FindInt(Key.Name);
+        return Value ? *Value : DefaultValue;
     }
 
-    void SetFloatData(const FString& Key, float Value)
+    void SetFloatData(const FRPGEventKey& Key, float Value)
     {
-        FloatData.Add(Key, Value);
+        Data.SetFloat(Key.Name, Value);
     }
 
-    float GetFloatData(const FString& Key, float DefaultValue = 0.0f) const
+    float GetFloatData(const FRPGEventKey& Key, float DefaultValue = 0.0f) const
     {
-        if (const float* Value = FloatData.Find(Key))
-        {
-            return *Value;
-        }
-        return DefaultValue;
+        const float* Value = Data.FindFloat(Key.Name);
+        return Value ? *Value : DefaultValue;
     }
 
-    void SetBoolData(const FString& Key, bool Value)
+    void SetBoolData(const FRPGEventKey& Key, bool Value)
     {
-        BoolData.Add(Key, Value);
+        Data.SetBool(Key.Name, Value);
     }
 
-    bool GetBoolData(const FString& Key, bool DefaultValue = false) const
+    bool GetBoolData(const FRPGEventKey& Key, bool DefaultValue = false) const
     {
-        if (const bool* Value = BoolData.Find(Key))
-        {
-            return *Value;
-        }
-        return DefaultValue;
+        const bool* Value = Data.FindBool(Key.Name);
+        return Value ? *Value : DefaultValue;
     }
 
-    void SetObjectData(const FString& Key, UObject* Value)
+    void SetObjectData(const FRPGEventKey& Key, UObject* Value)
     {
-        ObjectData.Add(Key, Value);
+        Data.SetObject(Key.Name, Value);
     }
 
-    UObject* GetObjectData(const FString& Key) const
+    UObject* GetObjectData(const FRPGEventKey& Key) const
     {
-        if (UObject* const* Value = ObjectData.Find(Key))
-        {
-            return *Value;
-        }
-        return nullptr;
+        return Data.FindObject(Key.Name);
     }
 
     // Modifier management
+    static int32 GetModifierBit(ERPGEventModifier Modifier)
+    {
+        return 1 << static_cast<int32>(Modifier);
+    }
+
     void AddModifier(ERPGEventModifier Modifier)
     {
-        Modifiers.AddUnique(Modifier);
+        ModifierMask |= GetModifierBit(Modifier);
     }
 
     void RemoveModifier(ERPGEventModifier Modifier)
     {
-        Modifiers.Remove(Modifier);
+        ModifierMask &= ~GetModifierBit(Modifier);
     }
 
     bool HasModifier(ERPGEventModifier Modifier) const
     {
-        return Modifiers.Contains(Modifier);
+        return (ModifierMask & GetModifierBit(Modifier)) != 0;
     }
 
     void ClearModifiers()
     {
-        Modifiers.Empty();
+        ModifierMask = 0;
     }
 
     // Entity management helpers
@@ -197,12 +210,12 @@ struct SESHAT_API FRPGEventContext
             return false;
         }
 
-        FString EntityID = Entity->GetID();
-        FString EntityType = Entity->GetType();
+        const FRPGEntityId EntityID = Entity->GetCompactID();
+        const FString& EntityType = Entity->GetType();
 
         // Check source entity
         if (SourceEntity.GetInterface() && 
-            SourceEntity->GetID() == EntityID && 
+            SourceEntity->GetCompactID() == EntityID && 
             SourceEntity->GetType() == EntityType)
         {
             return true;
@@ -210,7 +223,7 @@ struct SESHAT_API FRPGEventContext
 
         // Check target entity
         if (TargetEntity.GetInterface() && 
-            TargetEntity->GetID() == EntityID && 
+            TargetEntity->GetCompactID() == EntityID && 
             TargetEntity->GetType() == EntityType)
         {
             return true;
@@ -220,7 +233,7 @@ struct SESHAT_API FRPGEventContext
         for (const auto& AdditionalEntity : AdditionalEntities)
         {
             if (AdditionalEntity.GetInterface() && 
-                AdditionalEntity->GetID() == EntityID && 
+                AdditionalEntity->GetCompactID() == EntityID && 
                 AdditionalEntity->GetType() == EntityType)
             {
                 return true;
@@ -233,13 +246,13 @@ struct SESHAT_API FRPGEventContext
     // Validation and utility
     bool IsValid() const
     {
-        return EventType != ERPGEventType::Unknown && !EventID.IsEmpty();
+        return EventType != ERPGEventType::Unknown && EventID.IsValid();
     }
 
     FString ToString() const
     {
         FString Result = FString::Printf(TEXT("Event[%s]: %s"), 
-            *EventID, 
+            *EventID.ToString(), 
             *RPGEventTypes::EventTypeToString(EventType));
         
         if (SourceEntity.GetInterface())
@@ -269,24 +282,36 @@ struct SESHAT_API FRPGEventContext
         return Result;
     }
 
-    // Reset context for reuse
+    // Reset context for reuse (keeps payload and entity storage)
     void Reset()
     {
-        EventID = FGuid::NewGuid().ToString();
+        EventID = FGuid::NewGuid();
         EventType = ERPGEventType::Unknown;
-        EventName.Empty();
+        EventName = NAME_None;
         SourceEntity = nullptr;
         TargetEntity = nullptr;
-        AdditionalEntities.Empty();
+        AdditionalEntities.Reset();
         Priority = ERPGEventPriority::Normal;
         Timestamp = FApp::GetCurrentTime();
         bCancelled = false;
         bHandled = false;
-        Modifiers.Empty();
-        StringData.Empty();
-        IntData.Empty();
-        FloatData.Empty();
-        BoolData.Empty();
-        ObjectData.Empty();
+        ModifierMask = 0;
+        Data.Reset();
+    }
+
+private:
+    bool FindStringOrEntityID(const FRPGEventKey& Key, FStringView& OutValue) const
+    {
+        if (Data.FindString(Key.Name, OutValue))
+        {
+            return true;
+        }
+
+        if (const IRPGEntityInterface* Entity = Cast<IRPGEntityInterface>(Data.FindObject(Key.Name)))
+        {
+            OutValue = Entity->GetID();
+            return true;
+        }
+        return false;
     }
 };
\ No newline at end of file
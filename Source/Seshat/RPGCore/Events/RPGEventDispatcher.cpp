@@ -0,0 +1,826 @@
+#include "RPGEventDispatcher.h"
+#include "RPGEvent.h"
+#include "RPGEventProfiler.h"
+#include "RPGEventArena.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/ScopeExit.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+DECLARE_CYCLE_STAT(TEXT("Event Dispatch"), STAT_RPGEventDispatch, STATGROUP_RPGEvents);
+
+namespace
+{
+    bool GRPGParallelReadOnlyHandlers = true;
+    FAutoConsoleVariableRef CVarRPGParallelReadOnlyHandlers(
+        TEXT("rpg.Events.ParallelReadOnlyHandlers"),
+        GRPGParallelReadOnlyHandlers,
+        TEXT("Run native read-only event handlers on the task graph (0 runs them on the game thread after the priority chain)"));
+
+    /** Compact ID of an event entity, from the interface or (toolkit events) the payload; invalid if unknown */
+    FRPGEntityId FindEventEntityID(const TScriptInterface<IRPGEntityInterface>& Entity, const FRPGEventContext& Context, FName PayloadKey)
+    {
+        if (const IRPGEntityInterface* Native = Entity.GetInterface())
+        {
+            return Native->GetCompactID();
+        }
+
+        // Find, not FromString: a string ID that was never converted cannot have scoped subscribers
+        FStringView ID;
+        if (Context.Data.FindString(PayloadKey, ID))
+        {
+            return FRPGEntityId::Find(ID);
+        }
+        return FRPGEntityId();
+    }
+}
+
+FRPGEventDispatcher::FRPGEventDispatcher()
+{
+    // Built-in event types own the first channels, indexed by enum value
+    Channels.SetNum(RPGEventTypes::NumEventTypes);
+
+    if (FTaskGraphInterface::IsRunning())
+    {
+        NumLanes = FMath::Clamp(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1, MaxReadOnlyLanes);
+    }
+}
+
+FRPGEventDispatcher::~FRPGEventDispatcher()
+{
+    WaitForReadOnlyHandlers();
+}
+
+FRPGEventHandle FRPGEventDispatcher::Subscribe(ERPGEventType EventType, const TScriptInterface<IRPGEventInterface>& Handler, ERPGEventPriority Priority,
+    ERPGEventSubscriptionType SubscriptionType, double Duration, ERPGEventHandlerAccess Access)
+{
+    const int32 ChannelIndex = static_cast<int32>(EventType);
+    if (ChannelIndex >= RPGEventTypes::NumEventTypes)
+    {
+        return FRPGEventHandle();
+    }
+
+    return AddEntry(ChannelIndex, Handler, Priority, SubscriptionType, Duration, Access);
+}
+
+FRPGEventHandle FRPGEventDispatcher::SubscribeCustom(FName CustomEventName, const TScriptInterface<IRPGEventInterface>& Handler, ERPGEventPriority Priority,
+    ERPGEventSubscriptionType SubscriptionType, double Duration, ERPGEventHandlerAccess Access)
+{
+    if (CustomEventName.IsNone())
+    {
+        return Subscribe(ERPGEventType::Custom, Handler, Priority, SubscriptionType, Duration, Access);
+    }
+
+    int32* ChannelIndex = CustomChannels.Find(CustomEventName);
+    if (!ChannelIndex)
+    {
+        ChannelIndex = &CustomChannels.Add(CustomEventName, Channels.AddDefaulted());
+    }
+
+    return AddEntry(*ChannelIndex, Handler, Priority, SubscriptionType, Duration, Access);
+}
+
+FRPGEventHandle FRPGEventDispatcher::SubscribeEntity(ERPGEventType EventType, FRPGEntityId EntityID, ERPGEventEntityScope Scope,
+    const TScriptInterface<IRPGEventInterface>& Handler, ERPGEventPriority Priority,
+    ERPGEventSubscriptionType SubscriptionType, double Duration, ERPGEventHandlerAccess Access)
+{
+    const int32 TypeIndex = static_cast<int32>(EventType);
+    if (!EntityID.IsValid() || TypeIndex >= RPGEventTypes::NumEventTypes || !Handler.GetObject())
+    {
+        return FRPGEventHandle();
+    }
+
+    if (EmptyEntityChannels.Num() > 0)
+    {
+        ReleaseEmptyEntityChannels();
+    }
+
+    const FEntityChannelKey Key{ EntityID, EventType, Scope };
+    int32* ChannelIndex = EntityChannels.Find(Key);
+    if (!ChannelIndex)
+    {
+        const int32 NewIndex = FreeChannels.Num() > 0 ? FreeChannels.Pop(EAllowShrinking::No) : Channels.AddDefaulted();
+        FChannel& Channel = Channels[NewIndex];
+        Channel.bEntityScoped = true;
+        Channel.EntityKey = Key;
+        ++NumEntityChannelsByType[TypeIndex];
+        ChannelIndex = &EntityChannels.Add(Key, NewIndex);
+    }
+
+    return AddEntry(*ChannelIndex, Handler, Priority, SubscriptionType, Duration, Access);
+}
+
+FRPGEventHandle FRPGEventDispatcher::AddEntry(int32 ChannelIndex, const TScriptInterface<IRPGEventInterface>& Handler, ERPGEventPriority Priority,
+    ERPGEventSubscriptionType SubscriptionType, double Duration, ERPGEventHandlerAccess Access)
+{
+    UObject* Object = Handler.GetObject();
+    if (!Object)
+    {
+        return FRPGEventHandle();
+    }
+
+    uint32 SlotIndex;
+    if (FreeSlots.Num() > 0)
+    {
+        SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        SlotIndex = static_cast<uint32>(Slots.AddDefaulted());
+    }
+
+    FChannel& Channel = Channels[ChannelIndex];
+
+    FEntry Entry;
+    Entry.Native = Handler.GetInterface();
+    Entry.Object = Object;
+    Entry.ExpirationTime = SubscriptionType == ERPGEventSubscriptionType::TimeLimited ? FApp::GetCurrentTime() + Duration : 0.0;
+    Entry.Slot = SlotIndex;
+    Entry.Priority = Priority;
+    Entry.SubscriptionType = SubscriptionType;
+    Entry.bReadOnly = Access == ERPGEventHandlerAccess::ReadOnly;
+
+    // Appending keeps the order unless the new entry outranks the current tail
+    if (Channel.Entries.Num() > 0 && static_cast<uint8>(Channel.Entries.Last().Priority) < static_cast<uint8>(Priority))
+    {
+        Channel.bNeedsSort = true;
+    }
+
+    FSlot& Slot = Slots[SlotIndex];
+    Slot.Channel = ChannelIndex;
+    Slot.EntryIndex = Channel.Entries.Add(MoveTemp(Entry));
+    ++Channel.NumActive;
+    if (Access == ERPGEventHandlerAccess::ReadOnly)
+    {
+        ++Channel.NumReadOnly;
+    }
+
+    return FRPGEventHandle(SlotIndex, Slot.Generation);
+}
+
+bool FRPGEventDispatcher::Unsubscribe(FRPGEventHandle Handle)
+{
+    if (!IsSubscribed(Handle))
+    {
+        return false;
+    }
+
+    const FSlot& Slot = Slots[Handle.GetSlot()];
+    FChannel& Channel = Channels[Slot.Channel];
+    RemoveEntry(Channel, Channel.Entries[Slot.EntryIndex]);
+    return true;
+}
+
+bool FRPGEventDispatcher::Unsubscribe(ERPGEventType EventType, const UObject* Handler)
+{
+    const int32 ChannelIndex = static_cast<int32>(EventType);
+    if (!Handler || ChannelIndex >= RPGEventTypes::NumEventTypes)
+    {
+        return false;
+    }
+
+    bool bRemoved = false;
+    auto RemoveFromChannel = [this, Handler, &bRemoved](FChannel& Channel)
+    {
+        for (FEntry& Entry : Channel.Entries)
+        {
+            if (Entry.bActive && Entry.Object.Get() == Handler)
+            {
+                RemoveEntry(Channel, Entry);
+                bRemoved = true;
+            }
+        }
+    };
+
+    RemoveFromChannel(Channels[ChannelIndex]);
+
+    if (NumEntityChannelsByType[ChannelIndex] > 0)
+    {
+        for (const TPair<FEntityChannelKey, int32>& Pair : EntityChannels)
+        {
+            if (Pair.Key.EventType == EventType)
+            {
+                RemoveFromChannel(Channels[Pair.Value]);
+            }
+        }
+        ReleaseEmptyEntityChannels();
+    }
+
+    return bRemoved;
+}
+
+int32 FRPGEventDispatcher::UnsubscribeEntity(FRPGEntityId EntityID)
+{
+    int32 NumRemoved = 0;
+    for (const TPair<FEntityChannelKey, int32>& Pair : EntityChannels)
+    {
+        if (Pair.Key.EntityID != EntityID)
+        {
+            continue;
+        }
+
+        FChannel& Channel = Channels[Pair.Value];
+        for (FEntry& Entry : Channel.Entries)
+        {
+            if (Entry.bActive)
+            {
+                RemoveEntry(Channel, Entry);
+                ++NumRemoved;
+            }
+        }
+    }
+
+    ReleaseEmptyEntityChannels();
+    return NumRemoved;
+}
+
+bool FRPGEventDispatcher::IsSubscribed(FRPGEventHandle Handle) const
+{
+    const uint32 SlotIndex = Handle.GetSlot();
+    return Handle.IsValid()
+        && Slots.IsValidIndex(static_cast<int32>(SlotIndex))
+        && Slots[SlotIndex].Generation == Handle.GetGeneration()
+        && Slots[SlotIndex].Channel != INDEX_NONE;
+}
+
+void FRPGEventDispatcher::Reset()
+{
+    for (FChannel& Channel : Channels)
+    {
+        for (FEntry& Entry : Channel.Entries)
+        {
+            if (Entry.bActive)
+            {
+                RemoveEntry(Channel, Entry);
+            }
+        }
+
+        if (Channel.WalkDepth == 0)
+        {
+            PrepareChannel(Channel);
+        }
+    }
+
+    ReleaseEmptyEntityChannels();
+}
+
+void FRPGEventDispatcher::RemoveEntry(FChannel& Channel, FEntry& Entry)
+{
+    Entry.bActive = false;
+    Channel.bHasTombstones = true;
+    --Channel.NumActive;
+    if (Entry.bReadOnly)
+    {
+        --Channel.NumReadOnly;
+    }
+
+    FSlot& Slot = Slots[Entry.Slot];
+
+    // Emptied entity channels are recycled once no walk is using them
+    if (Channel.bEntityScoped && Channel.NumActive == 0 && !Channel.bPendingRelease)
+    {
+        Channel.bPendingRelease = true;
+        EmptyEntityChannels.Add(Slot.Channel);
+    }
+
+    // Bumping the generation invalidates every outstanding handle to this slot
+    Slot.Channel = INDEX_NONE;
+    Slot.EntryIndex = INDEX_NONE;
+    ++Slot.Generation;
+    if (Slot.Generation == 0)
+    {
+        Slot.Generation = 1;
+    }
+    FreeSlots.Add(Entry.Slot);
+}
+
+void FRPGEventDispatcher::ReleaseEmptyEntityChannels()
+{
+    for (int32 Index = EmptyEntityChannels.Num() - 1; Index >= 0; --Index)
+    {
+        const int32 ChannelIndex = EmptyEntityChannels[Index];
+        FChannel& Channel = Channels[ChannelIndex];
+        if (Channel.WalkDepth > 0)
+        {
+            // Still being walked - retried after the walk
+            continue;
+        }
+
+        EmptyEntityChannels.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        Channel.bPendingRelease = false;
+        if (Channel.NumActive > 0)
+        {
+            // Subscribed to again before it was released
+            continue;
+        }
+
+        EntityChannels.Remove(Channel.EntityKey);
+        --NumEntityChannelsByType[static_cast<int32>(Channel.EntityKey.EventType)];
+
+        // Keep the entry allocation for the next entity that reuses this channel
+        Channel.Entries.Reset();
+        Channel.bNeedsSort = false;
+        Channel.bHasTombstones = false;
+        Channel.bEntityScoped = false;
+        Channel.EntityKey = FEntityChannelKey();
+        FreeChannels.Add(ChannelIndex);
+    }
+}
+
+void FRPGEventDispatcher::PrepareChannel(FChannel& Channel)
+{
+    if (Channel.bHasTombstones)
+    {
+        Channel.Entries.RemoveAll([](const FEntry& Entry) { return !Entry.bActive; });
+        Channel.bHasTombstones = false;
+    }
+
+    if (Channel.bNeedsSort)
+    {
+        // Stable: equal priorities keep subscription (append) order
+        Channel.Entries.StableSort([](const FEntry& A, const FEntry& B)
+        {
+            return static_cast<uint8>(A.Priority) > static_cast<uint8>(B.Priority);
+        });
+        Channel.bNeedsSort = false;
+    }
+
+    for (int32 Index = 0; Index < Channel.Entries.Num(); ++Index)
+    {
+        Slots[Channel.Entries[Index].Slot].EntryIndex = Index;
+    }
+}
+
+ERPGEventResult FRPGEventDispatcher::Dispatch(FRPGEventContext& Context)
+{
+    const int32 ChannelIndex = static_cast<int32>(Context.EventType);
+    if (ChannelIndex >= RPGEventTypes::NumEventTypes || Context.bCancelled)
+    {
+        return ERPGEventResult::Unhandled;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_RPGEventDispatch);
+    TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(*RPGEventTypes::EventTypeToString(Context.EventType), RPGEventsChannel);
+
+    if (Profiler)
+    {
+        Profiler->RecordPublish(Context.EventType);
+        Profiler->EnterDispatch();
+    }
+    ON_SCOPE_EXIT
+    {
+        if (Profiler)
+        {
+            Profiler->ExitDispatch();
+        }
+    };
+
+    if (EmptyEntityChannels.Num() > 0)
+    {
+        ReleaseEmptyEntityChannels();
+    }
+
+    // Handlers scoped to the event's source/target walk merged with the type's global handlers
+    int32 ChannelIndices[MaxMergedChannels];
+    int32 NumChannels = NumEntityChannelsByType[ChannelIndex] > 0 ? GatherEntityChannels(Context, ChannelIndices, 0) : 0;
+    ChannelIndices[NumChannels++] = ChannelIndex;
+
+    // Named custom channel first, then subscribers to every Custom event
+    const int32 CustomChannel = Context.EventType == ERPGEventType::Custom && !Context.EventName.IsNone()
+        ? FindCustomChannel(Context.EventName) : INDEX_NONE;
+
+    ERPGEventResult Result = ERPGEventResult::Unhandled;
+    if (CustomChannel != INDEX_NONE)
+    {
+        Result = DispatchChannel(CustomChannel, Context);
+    }
+    if (Result != ERPGEventResult::HandledStopProcessing && !Context.bCancelled)
+    {
+        const ERPGEventResult GenericResult = DispatchChannels(ChannelIndices, NumChannels, Context);
+        Result = GenericResult != ERPGEventResult::Unhandled ? GenericResult : Result;
+    }
+
+    // Read-only handlers see every dispatched event once the chain is done, even a stopped or cancelled one
+    FReadOnlyCalls ReadOnlyCalls;
+    const double Now = FApp::GetCurrentTime();
+    if (CustomChannel != INDEX_NONE)
+    {
+        GatherReadOnlyHandlers(CustomChannel, Context.EventType, Now, ReadOnlyCalls);
+    }
+    for (int32 Index = 0; Index < NumChannels; ++Index)
+    {
+        GatherReadOnlyHandlers(ChannelIndices[Index], Context.EventType, Now, ReadOnlyCalls);
+    }
+    if (ReadOnlyCalls.Num() > 0)
+    {
+        RunReadOnlyHandlers(Context, ReadOnlyCalls);
+    }
+
+    return Result;
+}
+
+int32 FRPGEventDispatcher::GatherEntityChannels(const FRPGEventContext& Context, int32* OutChannelIndices, int32 NumChannels) const
+{
+    auto AddChannel = [this, &Context, OutChannelIndices, &NumChannels](FRPGEntityId EntityID, ERPGEventEntityScope Scope)
+    {
+        if (!EntityID.IsValid())
+        {
+            return;
+        }
+
+        const int32* ChannelIndex = EntityChannels.Find(FEntityChannelKey{ EntityID, Context.EventType, Scope });
+        if (!ChannelIndex)
+        {
+            return;
+        }
+
+        // An entity that is both source and target matches its Either channel once
+        for (int32 Index = 0; Index < NumChannels; ++Index)
+        {
+            if (OutChannelIndices[Index] == *ChannelIndex)
+            {
+                return;
+            }
+        }
+        OutChannelIndices[NumChannels++] = *ChannelIndex;
+    };
+
+    const FRPGEntityId SourceID = FindEventEntityID(Context.SourceEntity, Context, RPGEventKeys::SourceID);
+    const FRPGEntityId TargetID = FindEventEntityID(Context.TargetEntity, Context, RPGEventKeys::TargetID);
+
+    AddChannel(SourceID, ERPGEventEntityScope::Source);
+    AddChannel(SourceID, ERPGEventEntityScope::Either);
+    AddChannel(TargetID, ERPGEventEntityScope::Target);
+    AddChannel(TargetID, ERPGEventEntityScope::Either);
+    return NumChannels;
+}
+
+ERPGEventResult FRPGEventDispatcher::DispatchChannels(const int32* ChannelIndices, int32 NumChannels, FRPGEventContext& Context)
+{
+    check(NumChannels <= MaxMergedChannels);
+
+    // Walk position per channel; entries appended by handlers during this walk wait for the next publish
+    struct FCursor
+    {
+        int32 Channel;
+        int32 Next;
+        int32 End;
+    };
+    FCursor Cursors[MaxMergedChannels];
+    int32 NumCursors = 0;
+
+    for (int32 Index = 0; Index < NumChannels; ++Index)
+    {
+        FChannel& Channel = Channels[ChannelIndices[Index]];
+        if (Channel.WalkDepth == 0 && (Channel.bNeedsSort || Channel.bHasTombstones))
+        {
+            PrepareChannel(Channel);
+        }
+
+        if (Channel.NumActive > 0)
+        {
+            ++Channel.WalkDepth;
+            Cursors[NumCursors++] = { ChannelIndices[Index], 0, Channel.Entries.Num() };
+        }
+    }
+
+    ERPGEventResult LastResult = ERPGEventResult::Unhandled;
+    if (NumCursors == 0)
+    {
+        return LastResult;
+    }
+
+    const double Now = FApp::GetCurrentTime();
+    for (;;)
+    {
+        // Every channel is sorted, so the next handler is the highest-priority head
+        FCursor* Best = nullptr;
+        uint8 BestPriority = 0;
+        for (int32 Index = 0; Index < NumCursors; ++Index)
+        {
+            FCursor& Cursor = Cursors[Index];
+            if (Cursor.Next < Cursor.End)
+            {
+                const uint8 Priority = static_cast<uint8>(Channels[Cursor.Channel].Entries[Cursor.Next].Priority);
+                if (!Best || Priority > BestPriority)
+                {
+                    Best = &Cursor;
+                    BestPriority = Priority;
+                }
+            }
+        }
+
+        if (!Best)
+        {
+            break;
+        }
+
+        const int32 EntryIndex = Best->Next++;
+        if (DeliverEntry(Best->Channel, EntryIndex, Context, Now, LastResult))
+        {
+            break;
+        }
+    }
+
+    for (int32 Index = 0; Index < NumCursors; ++Index)
+    {
+        FChannel& WalkedChannel = Channels[Cursors[Index].Channel];
+        --WalkedChannel.WalkDepth;
+        if (WalkedChannel.WalkDepth == 0 && (WalkedChannel.bNeedsSort || WalkedChannel.bHasTombstones))
+        {
+            PrepareChannel(WalkedChannel);
+        }
+    }
+
+    return LastResult;
+}
+
+UObject* FRPGEventDispatcher::ResolveEntry(int32 ChannelIndex, int32 EntryIndex, double Now)
+{
+    FEntry& Entry = Channels[ChannelIndex].Entries[EntryIndex];
+    if (!Entry.bActive)
+    {
+        return nullptr;
+    }
+
+    if (Entry.SubscriptionType == ERPGEventSubscriptionType::TimeLimited && Now > Entry.ExpirationTime)
+    {
+        RemoveEntry(Channels[ChannelIndex], Entry);
+        return nullptr;
+    }
+
+    UObject* Object = Entry.Object.Get();
+    if (!Object)
+    {
+        RemoveEntry(Channels[ChannelIndex], Entry);
+        return nullptr;
+    }
+    return Object;
+}
+
+void FRPGEventDispatcher::SpendOneTimeEntry(int32 ChannelIndex, int32 EntryIndex)
+{
+    // Fetched again by index: ShouldHandle may have subscribed or unsubscribed
+    FEntry& Entry = Channels[ChannelIndex].Entries[EntryIndex];
+    if (Entry.bActive)
+    {
+        RemoveEntry(Channels[ChannelIndex], Entry);
+    }
+}
+
+bool FRPGEventDispatcher::DeliverEntry(int32 ChannelIndex, int32 EntryIndex, FRPGEventContext& Context, double Now, ERPGEventResult& OutLastResult)
+{
+    // Fetched by index: a handler may subscribe and grow Channels or this channel's array
+    const FEntry& Entry = Channels[ChannelIndex].Entries[EntryIndex];
+    if (Entry.bReadOnly)
+    {
+        return false;
+    }
+
+    IRPGEventInterface* Native = Entry.Native;
+    const bool bOneTime = Entry.SubscriptionType == ERPGEventSubscriptionType::OneTime;
+    UObject* Object = ResolveEntry(ChannelIndex, EntryIndex, Now);
+    if (!Object)
+    {
+        return false;
+    }
+
+    // Entry must not be touched past this point - the handler may grow Channels or this channel's array
+    const bool bProfileHandler = Profiler && FRPGEventProfiler::IsHandlerProfilingEnabled();
+    const uint64 StartCycles = bProfileHandler ? FPlatformTime::Cycles64() : 0;
+
+    const bool bShouldHandle = Native
+        ? Native->ShouldHandle(Context.EventType)
+        : IRPGEventInterface::Execute_ShouldHandleEventType(Object, Context.EventType);
+    if (!bShouldHandle)
+    {
+        // A declined event leaves a one-time subscription waiting for one it accepts
+        return false;
+    }
+
+    // Spent once the handler is committed to run, and before the call so a re-entrant publish cannot deliver twice
+    if (bOneTime)
+    {
+        SpendOneTimeEntry(ChannelIndex, EntryIndex);
+    }
+
+    const ERPGEventResult Result = Native
+        ? Native->HandleEvent(Context)
+        : IRPGEventInterface::Execute_HandleRPGEvent(Object, Context);
+
+    if (bProfileHandler)
+    {
+        Profiler->RecordHandler(Object, FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    OutLastResult = Result;
+
+    if (Result == ERPGEventResult::Handled || Result == ERPGEventResult::HandledStopProcessing)
+    {
+        Context.bHandled = true;
+    }
+    else if (Result == ERPGEventResult::Cancelled)
+    {
+        Context.bCancelled = true;
+    }
+
+    return Result == ERPGEventResult::HandledStopProcessing || Context.bCancelled;
+}
+
+void FRPGEventDispatcher::GatherReadOnlyHandlers(int32 ChannelIndex, ERPGEventType EventType, double Now, FReadOnlyCalls& OutCalls)
+{
+    if (Channels[ChannelIndex].NumReadOnly == 0)
+    {
+        return;
+    }
+
+    for (int32 EntryIndex = 0; EntryIndex < Channels[ChannelIndex].Entries.Num(); ++EntryIndex)
+    {
+        const FEntry& Entry = Channels[ChannelIndex].Entries[EntryIndex];
+        if (!Entry.bReadOnly)
+        {
+            continue;
+        }
+
+        IRPGEventInterface* Native = Entry.Native;
+        const bool bOneTime = Entry.SubscriptionType == ERPGEventSubscriptionType::OneTime;
+        UObject* Object = ResolveEntry(ChannelIndex, EntryIndex, Now);
+        if (!Object)
+        {
+            continue;
+        }
+
+        // One-time entries are only spent on an event they accept, so ask now rather than on the lane
+        if (bOneTime)
+        {
+            const bool bShouldHandle = Native
+                ? Native->ShouldHandle(EventType)
+                : IRPGEventInterface::Execute_ShouldHandleEventType(Object, EventType);
+            if (!bShouldHandle)
+            {
+                continue;
+            }
+            SpendOneTimeEntry(ChannelIndex, EntryIndex);
+        }
+
+        OutCalls.Add({ Native, Object, static_cast<int32>(GetTypeHash(Object) % static_cast<uint32>(NumLanes)) });
+    }
+}
+
+void FRPGEventDispatcher::RunReadOnlyHandlers(const FRPGEventContext& Context, FReadOnlyCalls& Calls)
+{
+    const bool bParallel = GRPGParallelReadOnlyHandlers && FApp::ShouldUseThreadingForPerformance() && FTaskGraphInterface::IsRunning();
+    const bool bProfileHandlers = Profiler && FRPGEventProfiler::IsHandlerProfilingEnabled();
+
+    // Blueprint implementations go through ProcessEvent and stay on the game thread
+    for (int32 Index = Calls.Num() - 1; Index >= 0; --Index)
+    {
+        const FReadOnlyCall& Call = Calls[Index];
+        if (bParallel && Call.Native)
+        {
+            continue;
+        }
+
+        const uint64 StartCycles = bProfileHandlers ? FPlatformTime::Cycles64() : 0;
+        bool bCalled = false;
+        if (Call.Native)
+        {
+            if (Call.Native->ShouldHandle(Context.EventType))
+            {
+                Call.Native->HandleEvent(Context);
+                bCalled = true;
+            }
+        }
+        else if (IRPGEventInterface::Execute_ShouldHandleEventType(Call.Object, Context.EventType))
+        {
+            IRPGEventInterface::Execute_HandleRPGEvent(Call.Object, Context);
+            bCalled = true;
+        }
+
+        if (bProfileHandlers && bCalled)
+        {
+            Profiler->RecordHandler(Call.Object, FPlatformTime::Cycles64() - StartCycles);
+        }
+        Calls.RemoveAt(Index, 1, EAllowShrinking::No);
+    }
+
+    if (Calls.Num() == 0)
+    {
+        return;
+    }
+
+    // Workers read a copy - the caller's context may be reused or reset by the arena before they run
+    const TSharedRef<const FRPGEventContext> Snapshot = MakeShared<const FRPGEventContext>(Context);
+
+    // Stable: a lane keeps subscription order
+    Calls.StableSort([](const FReadOnlyCall& A, const FReadOnlyCall& B) { return A.Lane < B.Lane; });
+
+    for (int32 First = 0; First < Calls.Num();)
+    {
+        const int32 Lane = Calls[First].Lane;
+        int32 End = First + 1;
+        while (End < Calls.Num() && Calls[End].Lane == Lane)
+        {
+            ++End;
+        }
+
+        TArray<FReadOnlyCall, TInlineAllocator<8>> LaneHandlers(&Calls[First], End - First);
+
+        // The profiler is game-thread only - time on the lane and merge once the lanes are joined
+        TArray<FLaneSample>* Samples = bProfileHandlers ? &LaneSamples[Lane] : nullptr;
+
+        // Chained behind the lane's previous task so each handler sees events in publish order, one at a time
+        FGraphEventArray Prerequisites;
+        if (LaneTasks[Lane].IsValid() && !LaneTasks[Lane]->IsComplete())
+        {
+            Prerequisites.Add(LaneTasks[Lane]);
+        }
+
+        LaneTasks[Lane] = FFunctionGraphTask::CreateAndDispatchWhenReady([Snapshot, LaneHandlers = MoveTemp(LaneHandlers), Samples]()
+        {
+            TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(RPGReadOnlyEventHandlers, RPGEventsChannel);
+            for (const FReadOnlyCall& Call : LaneHandlers)
+            {
+                if (!Call.Native->ShouldHandle(Snapshot->EventType))
+                {
+                    continue;
+                }
+
+                const uint64 StartCycles = Samples ? FPlatformTime::Cycles64() : 0;
+                Call.Native->HandleEvent(*Snapshot);
+                if (Samples)
+                {
+                    Samples->Add({ Call.Object, FPlatformTime::Cycles64() - StartCycles });
+                }
+            }
+        }, TStatId(), &Prerequisites, ENamedThreads::AnyHiPriThreadNormalTask);
+
+        First = End;
+    }
+}
+
+void FRPGEventDispatcher::WaitForReadOnlyHandlers()
+{
+    FGraphEventArray Pending;
+    for (FGraphEventRef& Task : LaneTasks)
+    {
+        if (Task.IsValid() && !Task->IsComplete())
+        {
+            Pending.Add(Task);
+        }
+        Task = nullptr;
+    }
+
+    if (Pending.Num() > 0)
+    {
+        TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(RPGWaitForReadOnlyEventHandlers, RPGEventsChannel);
+        FTaskGraphInterface::Get().WaitUntilTasksComplete(Pending, ENamedThreads::GameThread);
+    }
+
+    // Every lane is idle, so their samples can be read; handler objects are still alive (this runs before GC)
+    for (TArray<FLaneSample>& Samples : LaneSamples)
+    {
+        if (Profiler)
+        {
+            for (const FLaneSample& Sample : Samples)
+            {
+                Profiler->RecordHandler(Sample.Object, Sample.Cycles);
+            }
+        }
+        Samples.Reset();
+    }
+}
+
+bool FRPGEventDispatcher::HasReadOnlyHandlersInFlight() const
+{
+    for (const FGraphEventRef& Task : LaneTasks)
+    {
+        if (Task.IsValid() && !Task->IsComplete())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int32 FRPGEventDispatcher::FindCustomChannel(FName CustomEventName) const
+{
+    const int32* ChannelIndex = CustomChannels.Find(CustomEventName);
+    return ChannelIndex ? *ChannelIndex : INDEX_NONE;
+}
+
+int32 FRPGEventDispatcher::GetNumSubscriptions(ERPGEventType EventType) const
+{
+    const int32 ChannelIndex = static_cast<int32>(EventType);
+    return ChannelIndex < RPGEventTypes::NumEventTypes ? Channels[ChannelIndex].NumActive : 0;
+}
+
+int32 FRPGEventDispatcher::GetNumSubscriptions() const
+{
+    int32 Count = 0;
+    for (const FChannel& Channel : Channels)
+    {
+        Count += Channel.NumActive;
+    }
+    return Count;
+}
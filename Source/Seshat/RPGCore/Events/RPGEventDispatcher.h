@@ -0,0 +1,273 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "RPGEventTypes.h"
+#include "RPGEventContext.h"
+
+// Forward declarations
+class IRPGEventInterface;
+class FRPGEventProfiler;
+
+/**
+ * In-process priority event dispatcher
+ * Subscriptions live in a dense table of channels: one per ERPGEventType, followed by one per
+ * interned Custom event name and one per (event type, entity ID, entity scope) for entity-scoped
+ * subscriptions. Each channel is a contiguous array of 32-byte entries walked in priority order.
+ *
+ * Entity-scoped channels are found through a hash index keyed on the entity ID, so a targeted event
+ * visits the handlers scoped to its source and target plus the global handlers for its type - not every
+ * handler watching some other entity. Scoped and global channels are walked as one priority-ordered
+ * merge (scoped handlers first among equal priorities). A scoped channel is recycled once it empties.
+ *
+ * Dispatch rules:
+ * - Higher ERPGEventPriority runs first; equal priorities run in subscription order
+ * - HandledStopProcessing marks the event handled and ends the walk
+ * - Cancelled (or a context that is already bCancelled) ends the walk
+ * - OneTime subscriptions are removed after their first delivery to a handler whose ShouldHandle accepts the event
+ * - TimeLimited subscriptions are removed once FApp::GetCurrentTime() passes their expiration
+ *
+ * Subscribe and Unsubscribe are O(1): subscribing appends, unsubscribing leaves a tombstone, and the
+ * channel is re-sorted/compacted lazily before its next publish. Handles are generation-checked, so a
+ * stale handle can never remove a newer subscription that reused its slot.
+ *
+ * Read-only subscriptions (ERPGEventHandlerAccess::ReadOnly) are skipped by the priority walk. Once the chain
+ * finishes they get a copy of the final context: native handlers run on the task graph, spread over a few
+ * lanes by handler object so one handler never runs concurrently with itself and sees events in publish order;
+ * Blueprint-only handlers run on the game thread. WaitForReadOnlyHandlers joins every lane and must run
+ * before the next frame and before garbage collection.
+ *
+ * Handlers are held weakly; subscriptions whose object has been destroyed are dropped on the next publish.
+ * Subscribing or unsubscribing from inside a handler is safe - a channel is never reordered while it is being walked.
+ */
+class SESHAT_API FRPGEventDispatcher
+{
+public:
+    FRPGEventDispatcher();
+
+    /** Joins read-only handlers still running */
+    ~FRPGEventDispatcher();
+
+    /**
+     * Add a handler for one event type
+     * @param Duration Lifetime in seconds for TimeLimited subscriptions (ignored otherwise)
+     * @return Handle for Unsubscribe, invalid if Handler is null
+     */
+    FRPGEventHandle Subscribe(ERPGEventType EventType, const TScriptInterface<IRPGEventInterface>& Handler, ERPGEventPriority Priority,
+        ERPGEventSubscriptionType SubscriptionType = ERPGEventSubscriptionType::Persistent, double Duration = 0.0,
+        ERPGEventHandlerAccess Access = ERPGEventHandlerAccess::Mutating);
+
+    /** Add a handler for one named Custom event (the name is interned to a channel on first use) */
+    FRPGEventHandle SubscribeCustom(FName CustomEventName, const TScriptInterface<IRPGEventInterface>& Handler, ERPGEventPriority Priority,
+        ERPGEventSubscriptionType SubscriptionType = ERPGEventSubscriptionType::Persistent, double Duration = 0.0,
+        ERPGEventHandlerAccess Access = ERPGEventHandlerAccess::Mutating);
+
+    /**
+     * Add a handler for one event type, delivered only when EntityID is the event's source and/or target
+     * Source and target IDs come from SourceEntity/TargetEntity, or the SourceID/TargetID payload entries
+     * for events that crossed from the toolkit
+     */
+    FRPGEventHandle SubscribeEntity(ERPGEventType EventType, FRPGEntityId EntityID, ERPGEventEntityScope Scope,
+        const TScriptInterface<IRPGEventInterface>& Handler, ERPGEventPriority Priority,
+        ERPGEventSubscriptionType SubscriptionType = ERPGEventSubscriptionType::Persistent, double Duration = 0.0,
+        ERPGEventHandlerAccess Access = ERPGEventHandlerAccess::Mutating);
+
+    /** Remove a subscription; false if the handle is stale or invalid */
+    bool Unsubscribe(FRPGEventHandle Handle);
+
+    /** Remove every subscription Handler has for EventType, global and entity-scoped (linear in those channels) */
+    bool Unsubscribe(ERPGEventType EventType, const UObject* Handler);
+
+    /** Remove every subscription scoped to EntityID (e.g. when the entity is destroyed); returns the count removed */
+    int32 UnsubscribeEntity(FRPGEntityId EntityID);
+
+    /** Whether Handle still refers to a live subscription */
+    bool IsSubscribed(FRPGEventHandle Handle) const;
+
+    /** Remove every subscription (interned Custom channels are kept) */
+    void Reset();
+
+    /**
+     * Deliver an event to its handlers, highest priority first
+     * Custom events go to the channel interned for Context.EventName, then to plain Custom subscribers
+     * @return The last handler result (Unhandled if no handler ran)
+     */
+    ERPGEventResult Dispatch(FRPGEventContext& Context);
+
+    /** Channel index for a Custom event name, INDEX_NONE if nothing ever subscribed to it */
+    int32 FindCustomChannel(FName CustomEventName) const;
+
+    /** Active subscriptions for one event type (for Custom, the plain Custom channel only) */
+    int32 GetNumSubscriptions(ERPGEventType EventType) const;
+
+    /** Active subscriptions across every channel */
+    int32 GetNumSubscriptions() const;
+
+    /** Block until every read-only handler launched so far has returned, then record their timings (game thread) */
+    void WaitForReadOnlyHandlers();
+
+    /** Whether read-only handlers may still be running on worker threads */
+    bool HasReadOnlyHandlersInFlight() const;
+
+    /** Publish counts, dispatch depth and (when enabled) handler timing go to Profiler; null to stop */
+    void SetProfiler(FRPGEventProfiler* InProfiler) { Profiler = InProfiler; }
+
+    /** Live entity-scoped channels (one per event type, entity and scope with subscribers) */
+    int32 GetNumEntityChannels() const { return EntityChannels.Num(); }
+
+private:
+    /** Hot per-handler data - two entries per 64-byte cache line */
+    struct FEntry
+    {
+        /** Native interface pointer, or nullptr for Blueprint-only implementers (called through Execute_) */
+        IRPGEventInterface* Native = nullptr;
+        FWeakObjectPtr Object;
+        double ExpirationTime = 0.0;
+        uint32 Slot = 0;
+        ERPGEventPriority Priority = ERPGEventPriority::Normal;
+        ERPGEventSubscriptionType SubscriptionType = ERPGEventSubscriptionType::Persistent;
+        bool bActive = true;
+
+        /** Skipped by the priority walk, delivered by RunReadOnlyHandlers */
+        bool bReadOnly = false;
+    };
+
+    /** Entity-scoped channel index key */
+    struct FEntityChannelKey
+    {
+        FRPGEntityId EntityID;
+        ERPGEventType EventType = ERPGEventType::Unknown;
+        ERPGEventEntityScope Scope = ERPGEventEntityScope::Either;
+
+        bool operator==(const FEntityChannelKey& Other) const
+        {
+            return EntityID == Other.EntityID && EventType == Other.EventType && Scope == Other.Scope;
+        }
+
+        friend uint32 GetTypeHash(const FEntityChannelKey& Key)
+        {
+            return HashCombineFast(GetTypeHash(Key.EntityID), (static_cast<uint32>(Key.EventType) << 8) | static_cast<uint32>(Key.Scope));
+        }
+    };
+
+    struct FChannel
+    {
+        TArray<FEntry> Entries;
+        int32 NumActive = 0;
+
+        /** Active read-only entries (included in NumActive) */
+        int32 NumReadOnly = 0;
+
+        /** Nesting depth of Dispatch calls walking this channel */
+        int32 WalkDepth = 0;
+
+        bool bNeedsSort = false;
+        bool bHasTombstones = false;
+
+        /** Entity-scoped channel, released back to FreeChannels once empty */
+        bool bEntityScoped = false;
+        bool bPendingRelease = false;
+        FEntityChannelKey EntityKey;
+    };
+
+    /** Global channel plus source/target/either lookups for both entities */
+    static constexpr int32 MaxMergedChannels = 5;
+
+    /** Worker lanes for read-only handlers; a handler object always maps to the same lane */
+    static constexpr int32 MaxReadOnlyLanes = 8;
+
+    /** A read-only handler resolved on the game thread for one event */
+    struct FReadOnlyCall
+    {
+        IRPGEventInterface* Native = nullptr;
+        UObject* Object = nullptr;
+        int32 Lane = 0;
+    };
+    using FReadOnlyCalls = TArray<FReadOnlyCall, TInlineAllocator<16>>;
+
+    /** One read-only handler call timed on a worker lane; Object is only dereferenced on the game thread */
+    struct FLaneSample
+    {
+        const UObject* Object = nullptr;
+        uint64 Cycles = 0;
+    };
+
+    /** Handle slot: where the subscription lives now */
+    struct FSlot
+    {
+        uint32 Generation = 1;
+        int32 Channel = INDEX_NONE;
+        int32 EntryIndex = INDEX_NONE;
+    };
+
+    FRPGEventHandle AddEntry(int32 ChannelIndex, const TScriptInterface<IRPGEventInterface>& Handler, ERPGEventPriority Priority,
+        ERPGEventSubscriptionType SubscriptionType, double Duration, ERPGEventHandlerAccess Access);
+
+    /** Tombstone an entry and retire its handle */
+    void RemoveEntry(FChannel& Channel, FEntry& Entry);
+
+    /** Sort and compact a channel that is not being walked, then point its slots at the new positions */
+    void PrepareChannel(FChannel& Channel);
+
+    /** Walk several channels as one priority-ordered list; ChannelIndices earlier in the array win ties */
+    ERPGEventResult DispatchChannels(const int32* ChannelIndices, int32 NumChannels, FRPGEventContext& Context);
+
+    ERPGEventResult DispatchChannel(int32 ChannelIndex, FRPGEventContext& Context)
+    {
+        return DispatchChannels(&ChannelIndex, 1, Context);
+    }
+
+    /**
+     * Deliver one entry of a channel being walked
+     * @return True if the walk should stop (HandledStopProcessing or cancelled)
+     */
+    bool DeliverEntry(int32 ChannelIndex, int32 EntryIndex, FRPGEventContext& Context, double Now, ERPGEventResult& OutLastResult);
+
+    /**
+     * Expire or drop an entry about to be delivered
+     * @return The handler object, or null if the entry must be skipped
+     */
+    UObject* ResolveEntry(int32 ChannelIndex, int32 EntryIndex, double Now);
+
+    /** Remove a one-time entry whose handler accepted the event (no-op if a handler already removed it) */
+    void SpendOneTimeEntry(int32 ChannelIndex, int32 EntryIndex);
+
+    /** Append the live read-only handlers of a channel; one-time entries are asked ShouldHandle here */
+    void GatherReadOnlyHandlers(int32 ChannelIndex, ERPGEventType EventType, double Now, FReadOnlyCalls& OutCalls);
+
+    /** Launch native read-only handlers on their lanes with a copy of Context; call the rest inline */
+    void RunReadOnlyHandlers(const FRPGEventContext& Context, FReadOnlyCalls& Calls);
+
+    /** Append the entity-scoped channels matching Context's source and target; returns the new count */
+    int32 GatherEntityChannels(const FRPGEventContext& Context, int32* OutChannelIndices, int32 NumChannels) const;
+
+    /** Recycle entity-scoped channels that emptied and are not being walked */
+    void ReleaseEmptyEntityChannels();
+
+    TArray<FChannel> Channels;
+    TMap<FName, int32> CustomChannels;
+    TMap<FEntityChannelKey, int32> EntityChannels;
+
+    /** Live entity channels per event type - dispatch skips resolving entity IDs when zero */
+    int32 NumEntityChannelsByType[RPGEventTypes::NumEventTypes] = {};
+
+    /** Released entity channel indices for reuse, and emptied ones waiting to be released */
+    TArray<int32> FreeChannels;
+    TArray<int32> EmptyEntityChannels;
+    TArray<FSlot> Slots;
+    TArray<uint32> FreeSlots;
+
+    /** Last task launched on each lane - the next task on a lane waits for it */
+    FGraphEventRef LaneTasks[MaxReadOnlyLanes];
+    int32 NumLanes = 1;
+
+    /**
+     * Handler timings per lane, handed to Profiler by WaitForReadOnlyHandlers
+     * Written only by the lane's tasks (which run one at a time) and read by the game thread once they are joined
+     */
+    TArray<FLaneSample> LaneSamples[MaxReadOnlyLanes];
+
+    /** Owned by the subsystem, outlives the dispatcher */
+    FRPGEventProfiler* Profiler = nullptr;
+};
@@ -0,0 +1,167 @@
+#include "RPGEventPayload.h"
+#include "UObject/GarbageCollection.h"
+
+FRPGEventPayload::FEntry* FRPGEventPayload::FindEntry(FName Key, ERPGEventValueType Type)
+{
+    for (FEntry& Entry : Entries)
+    {
+        if (Entry.Type == Type && Entry.Key == Key)
+        {
+            return &Entry;
+        }
+    }
+    return nullptr;
+}
+
+const FRPGEventPayload::FEntry* FRPGEventPayload::FindEntry(FName Key, ERPGEventValueType Type) const
+{
+    return const_cast<FRPGEventPayload*>(this)->FindEntry(Key, Type);
+}
+
+FRPGEventPayload::FEntry& FRPGEventPayload::FindOrAddEntry(FName Key, ERPGEventValueType Type)
+{
+    if (FEntry* Existing = FindEntry(Key, Type))
+    {
+        return *Existing;
+    }
+
+    FEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.Key = Key;
+    Entry.Type = Type;
+    return Entry;
+}
+
+void FRPGEventPayload::SetInt(FName Key, int32 Value)
+{
+    FindOrAddEntry(Key, ERPGEventValueType::Int).Int = Value;
+}
+
+void FRPGEventPayload::SetFloat(FName Key, float Value)
+{
+    FindOrAddEntry(Key, ERPGEventValueType::Float).Float = Value;
+}
+
+void FRPGEventPayload::SetBool(FName Key, bool Value)
+{
+    FindOrAddEntry(Key, ERPGEventValueType::Bool).Bool = Value;
+}
+
+void FRPGEventPayload::SetObject(FName Key, UObject* Value)
+{
+    FindOrAddEntry(Key, ERPGEventValueType::Object).Object = Value;
+}
+
+void FRPGEventPayload::SetString(FName Key, FStringView Value)
+{
+    FEntry* Entry = FindEntry(Key, ERPGEventValueType::String);
+    const int32 Length = Value.Len();
+
+    // Overwrite in place when the new value fits the old slice
+    if (Entry && Length <= Entry->String.Length)
+    {
+        if (Length > 0)
+        {
+            FMemory::Memcpy(Strings.GetData() + Entry->String.Offset, Value.GetData(), Length * sizeof(TCHAR));
+        }
+        Entry->String.Length = Length;
+        return;
+    }
+
+    // Value may point into Strings (copying one entry to another) - rebase it after growing
+    const TCHAR* Source = Value.GetData();
+    const int32 Offset = Strings.Num();
+    if (Length > 0 && Source >= Strings.GetData() && Source < Strings.GetData() + Offset)
+    {
+        const int32 SourceOffset = static_cast<int32>(Source - Strings.GetData());
+        Strings.Reserve(Offset + Length);
+        Source = Strings.GetData() + SourceOffset;
+    }
+    Strings.Append(Source, Length);
+
+    if (!Entry)
+    {
+        Entry = &Entries.AddDefaulted_GetRef();
+        Entry->Key = Key;
+        Entry->Type = ERPGEventValueType::String;
+    }
+    Entry->String.Offset = Offset;
+    Entry->String.Length = Length;
+}
+
+const int32* FRPGEventPayload::FindInt(FName Key) const
+{
+    const FEntry* Entry = FindEntry(Key, ERPGEventValueType::Int);
+    return Entry ? &Entry->Int : nullptr;
+}
+
+const float* FRPGEventPayload::FindFloat(FName Key) const
+{
+    const FEntry* Entry = FindEntry(Key, ERPGEventValueType::Float);
+    return Entry ? &Entry->Float : nullptr;
+}
+
+const bool* FRPGEventPayload::FindBool(FName Key) const
+{
+    const FEntry* Entry = FindEntry(Key, ERPGEventValueType::Bool);
+    return Entry ? &Entry->Bool : nullptr;
+}
+
+bool FRPGEventPayload::FindString(FName Key, FStringView& OutValue) const
+{
+    const FEntry* Entry = FindEntry(Key, ERPGEventValueType::String);
+    if (!Entry)
+    {
+        return false;
+    }
+
+    OutValue = FStringView(Strings.GetData() + Entry->String.Offset, Entry->String.Length);
+    return true;
+}
+
+UObject* FRPGEventPayload::FindObject(FName Key) const
+{
+    const FEntry* Entry = FindEntry(Key, ERPGEventValueType::Object);
+    return Entry ? Entry->Object : nullptr;
+}
+
+FStringView FRPGEventPayload::GetStringAt(int32 Index) const
+{
+    const FEntry& Entry = Entries[Index];
+    return FStringView(Strings.GetData() + Entry.String.Offset, Entry.String.Length);
+}
+
+bool FRPGEventPayload::Contains(FName Key, ERPGEventValueType Type) const
+{
+    return FindEntry(Key, Type) != nullptr;
+}
+
+bool FRPGEventPayload::Remove(FName Key, ERPGEventValueType Type)
+{
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        if (Entries[Index].Type == Type && Entries[Index].Key == Key)
+        {
+            // String characters stay in the pool until Reset
+            Entries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+            return true;
+        }
+    }
+    return false;
+}
+
+void FRPGEventPayload::Reset()
+{
+    Entries.Reset();
+    Strings.Reset();
+}
+
+void FRPGEventPayload::AddStructReferencedObjects(FReferenceCollector& Collector)
+{
+    for (FEntry& Entry : Entries)
+    {
+        if (Entry.Type == ERPGEventValueType::Object && Entry.Object)
+        {
+            Collector.AddReferencedObject(Entry.Object);
+        }
+    }
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectMacros.h"
+#include "RPGEventPayload.generated.h"
+
+class FReferenceCollector;
+
+/**
+ * Key for event payload data
+ * Converts implicitly from FName, FString and string literals so every existing call site keeps compiling.
+ * Prefer the interned RPGEventKeys constants (or a cached FName) on hot paths.
+ */
+struct FRPGEventKey
+{
+    FRPGEventKey(FName InName) : Name(InName) {}
+    FRPGEventKey(const TCHAR* InName) : Name(InName) {}
+    FRPGEventKey(const FString& InName) : Name(*InName) {}
+
+    FName Name;
+};
+
+/** Value type held by one payload entry */
+enum class ERPGEventValueType : uint8
+{
+    Int,
+    Float,
+    Bool,
+    String,
+    Object
+};
+
+/**
+ * Small-buffer key/value store for FRPGEventContext
+ * Entries are (FName key, tagged value) pairs searched linearly; a key may hold one value of each type.
+ * The first InlineEntries entries and InlineStringChars characters of string values live inside the struct,
+ * so a typical event is built and copied without touching the heap. Larger payloads spill to the heap transparently.
+ * Object values are reported to the garbage collector while the payload is reachable from a UPROPERTY.
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGEventPayload
+{
+    GENERATED_BODY()
+
+    static constexpr int32 InlineEntries = 8;
+    static constexpr int32 InlineStringChars = 128;
+
+    void SetInt(FName Key, int32 Value);
+    void SetFloat(FName Key, float Value);
+    void SetBool(FName Key, bool Value);
+    void SetString(FName Key, FStringView Value);
+    void SetObject(FName Key, UObject* Value);
+
+    /** Value pointers are invalidated by the next Set */
+    const int32* FindInt(FName Key) const;
+    const float* FindFloat(FName Key) const;
+    const bool* FindBool(FName Key) const;
+    bool FindString(FName Key, FStringView& OutValue) const;
+    UObject* FindObject(FName Key) const;
+
+    bool Contains(FName Key, ERPGEventValueType Type) const;
+    bool Remove(FName Key, ERPGEventValueType Type);
+
+    /** Drop every entry, keeping the inline (and any spilled) storage */
+    void Reset();
+
+    int32 Num() const { return Entries.Num(); }
+
+    /** Whether the payload still fits its inline buffers */
+    bool IsInline() const { return Entries.Max() <= InlineEntries && Strings.Max() <= InlineStringChars; }
+
+    /** Visit every entry: Func(FName Key, ERPGEventValueType Type, const FRPGEventPayload& Payload, int32 Index) */
+    template <typename FuncType>
+    void ForEach(FuncType&& Func) const
+    {
+        for (int32 Index = 0; Index < Entries.Num(); ++Index)
+        {
+            Func(Entries[Index].Key, Entries[Index].Type, *this, Index);
+        }
+    }
+
+    /** Typed reads by ForEach index */
+    int32 GetIntAt(int32 Index) const { return Entries[Index].Int; }
+    float GetFloatAt(int32 Index) const { return Entries[Index].Float; }
+    bool GetBoolAt(int32 Index) const { return Entries[Index].Bool; }
+    FStringView GetStringAt(int32 Index) const;
+    UObject* GetObjectAt(int32 Index) const { return Entries[Index].Object; }
+
+    void AddStructReferencedObjects(FReferenceCollector& Collector);
+
+private:
+    /** Slice of Strings */
+    struct FStringRange
+    {
+        int32 Offset;
+        int32 Length;
+    };
+
+    /** 24 bytes: key, type tag and an 8-byte value */
+    struct FEntry
+    {
+        FName Key;
+        ERPGEventValueType Type = ERPGEventValueType::Int;
+        union
+        {
+            uint64 Bits = 0;
+            int32 Int;
+            float Float;
+            bool Bool;
+            FStringRange String;
+            UObject* Object;
+        };
+    };
+
+    FEntry* FindEntry(FName Key, ERPGEventValueType Type);
+    const FEntry* FindEntry(FName Key, ERPGEventValueType Type) const;
+    FEntry& FindOrAddEntry(FName Key, ERPGEventValueType Type);
+
+    TArray<FEntry, TInlineAllocator<InlineEntries>> Entries;
+
+    /** Character pool for string values (overwritten values that no longer fit are abandoned until Reset) */
+    TArray<TCHAR, TInlineAllocator<InlineStringChars>> Strings;
+};
+
+template<>
+struct TStructOpsTypeTraits<FRPGEventPayload> : public TStructOpsTypeTraitsBase2<FRPGEventPayload>
+{
+    enum
+    {
+        WithAddStructReferencedObjects = true
+    };
+};
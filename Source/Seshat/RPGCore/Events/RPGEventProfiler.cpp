@@ -0,0 +1,257 @@
+#include "RPGEventProfiler.h"
+#include "RPGEventArena.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/StringBuilder.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(RPGEventsChannel);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Events Published"), STAT_RPGEventsPublished, STATGROUP_RPGEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Handler Calls"), STAT_RPGEventHandlerCalls, STATGROUP_RPGEvents);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Handler Time (ms)"), STAT_RPGEventHandlerTime, STATGROUP_RPGEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dispatch Depth"), STAT_RPGEventDispatchDepth, STATGROUP_RPGEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queue Depth"), STAT_RPGEventQueueDepth, STATGROUP_RPGEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queue Cascade Depth"), STAT_RPGEventCascadeDepth, STATGROUP_RPGEvents);
+
+TRACE_DECLARE_INT_COUNTER(RPGEventsPublished, TEXT("RPGEvents/Published"));
+TRACE_DECLARE_INT_COUNTER(RPGEventsHandlerCalls, TEXT("RPGEvents/HandlerCalls"));
+TRACE_DECLARE_FLOAT_COUNTER(RPGEventsHandlerMs, TEXT("RPGEvents/HandlerMs"));
+TRACE_DECLARE_INT_COUNTER(RPGEventsDispatchDepth, TEXT("RPGEvents/DispatchDepth"));
+TRACE_DECLARE_INT_COUNTER(RPGEventsQueueDepth, TEXT("RPGEvents/QueueDepth"));
+
+namespace
+{
+    bool GRPGProfileHandlers = false;
+    FAutoConsoleVariableRef CVarRPGProfileHandlers(
+        TEXT("rpg.Events.ProfileHandlers"),
+        GRPGProfileHandlers,
+        TEXT("Time every event handler call for rpg.Events.DumpTopHandlers (adds two timer reads per call)"));
+
+    /** Live profilers, one per event bus subsystem, oldest first */
+    TArray<FRPGEventProfiler*>& GetLiveProfilers()
+    {
+        static TArray<FRPGEventProfiler*> Profilers;
+        return Profilers;
+    }
+
+    FAutoConsoleCommandWithArgsAndOutputDevice DumpTopHandlersCommand(
+        TEXT("rpg.Events.DumpTopHandlers"),
+        TEXT("rpg.Events.DumpTopHandlers [N=10] - the N most expensive event handlers by total time, with latency histograms"),
+        FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, FOutputDevice& Ar)
+        {
+            const int32 Count = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10;
+            if (GetLiveProfilers().Num() == 0)
+            {
+                Ar.Log(TEXT("rpg.Events.DumpTopHandlers: no event bus is running"));
+                return;
+            }
+
+            for (const FRPGEventProfiler* Profiler : GetLiveProfilers())
+            {
+                Profiler->Dump(Ar, Count);
+            }
+        }));
+
+    FAutoConsoleCommand ResetProfileCommand(
+        TEXT("rpg.Events.ResetProfile"),
+        TEXT("Clear event bus publish counts and handler profiles"),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            for (FRPGEventProfiler* Profiler : GetLiveProfilers())
+            {
+                Profiler->Reset();
+            }
+        }));
+}
+
+FRPGEventProfiler::FRPGEventProfiler(const FString& InOwnerName, bool bInLive)
+    : OwnerName(InOwnerName)
+    , bLive(bInLive)
+{
+    if (bLive)
+    {
+        GetLiveProfilers().Add(this);
+    }
+}
+
+FRPGEventProfiler::~FRPGEventProfiler()
+{
+    if (bLive)
+    {
+        // Keep the order so the oldest bus keeps the global counters
+        GetLiveProfilers().RemoveSingle(this);
+    }
+}
+
+bool FRPGEventProfiler::PublishesGlobalStats() const
+{
+    return bLive && GetLiveProfilers().Num() > 0 && GetLiveProfilers()[0] == this;
+}
+
+bool FRPGEventProfiler::IsHandlerProfilingEnabled()
+{
+    return GRPGProfileHandlers;
+}
+
+int32 FRPGEventProfiler::GetHistogramBucket(double Microseconds)
+{
+    if (Microseconds < 1.0)
+    {
+        return 0;
+    }
+    return FMath::Min(FMath::FloorLog2(static_cast<uint32>(FMath::Min(Microseconds, static_cast<double>(MAX_uint32)))) + 1, NumHistogramBuckets - 1);
+}
+
+void FRPGEventProfiler::RecordHandler(const UObject* Handler, uint64 Cycles)
+{
+    FHandlerProfile& Profile = Handlers.FindOrAdd(FObjectKey(Handler));
+    if (Profile.Calls == 0 && Handler)
+    {
+        Profile.Name = FString::Printf(TEXT("%s (%s)"), *Handler->GetName(), *Handler->GetClass()->GetName());
+    }
+
+    ++Profile.Calls;
+    Profile.TotalCycles += Cycles;
+    Profile.MaxCycles = FMath::Max(Profile.MaxCycles, Cycles);
+    ++Profile.Histogram[GetHistogramBucket(FPlatformTime::ToMilliseconds64(Cycles) * 1000.0)];
+
+    ++FrameHandlerCalls;
+    FrameHandlerCycles += Cycles;
+}
+
+void FRPGEventProfiler::RecordQueue(int32 Pending, int32 CascadeDepth)
+{
+    QueueDepth = Pending;
+    MaxCascadeDepth = FMath::Max(MaxCascadeDepth, CascadeDepth);
+}
+
+void FRPGEventProfiler::PublishFrameStats()
+{
+    if (!PublishesGlobalStats())
+    {
+        // Another bus owns the counters - last writer would otherwise win
+        ResetFrameCounters();
+        return;
+    }
+
+    const double FrameHandlerMs = FPlatformTime::ToMilliseconds64(FrameHandlerCycles);
+
+    SET_DWORD_STAT(STAT_RPGEventsPublished, FramePublished);
+    SET_DWORD_STAT(STAT_RPGEventHandlerCalls, FrameHandlerCalls);
+    SET_FLOAT_STAT(STAT_RPGEventHandlerTime, FrameHandlerMs);
+    SET_DWORD_STAT(STAT_RPGEventDispatchDepth, FrameMaxDispatchDepth);
+    SET_DWORD_STAT(STAT_RPGEventQueueDepth, QueueDepth);
+    SET_DWORD_STAT(STAT_RPGEventCascadeDepth, MaxCascadeDepth);
+
+    TRACE_COUNTER_SET(RPGEventsPublished, FramePublished);
+    TRACE_COUNTER_SET(RPGEventsHandlerCalls, FrameHandlerCalls);
+    TRACE_COUNTER_SET(RPGEventsHandlerMs, FrameHandlerMs);
+    TRACE_COUNTER_SET(RPGEventsDispatchDepth, FrameMaxDispatchDepth);
+    TRACE_COUNTER_SET(RPGEventsQueueDepth, QueueDepth);
+
+    ResetFrameCounters();
+}
+
+void FRPGEventProfiler::ResetFrameCounters()
+{
+    FramePublished = 0;
+    FrameHandlerCalls = 0;
+    FrameHandlerCycles = 0;
+    FrameMaxDispatchDepth = 0;
+}
+
+FRPGEventBusStats FRPGEventProfiler::GetStats() const
+{
+    FRPGEventBusStats Stats;
+    Stats.PublishCounts.Append(PublishCounts, RPGEventTypes::NumEventTypes);
+    for (int64 Count : PublishCounts)
+    {
+        Stats.TotalPublished += Count;
+    }
+
+    uint64 TotalCycles = 0;
+    for (const TPair<FObjectKey, FHandlerProfile>& Pair : Handlers)
+    {
+        Stats.HandlerCalls += Pair.Value.Calls;
+        TotalCycles += Pair.Value.TotalCycles;
+    }
+    Stats.HandlerMs = static_cast<float>(FPlatformTime::ToMilliseconds64(TotalCycles));
+
+    Stats.MaxDispatchDepth = MaxDispatchDepth;
+    Stats.QueueDepth = QueueDepth;
+    Stats.MaxCascadeDepth = MaxCascadeDepth;
+    Stats.ProfiledHandlers = Handlers.Num();
+    return Stats;
+}
+
+TArray<FRPGEventHandlerProfile> FRPGEventProfiler::GetTopHandlers(int32 Count) const
+{
+    TArray<const FHandlerProfile*> Sorted;
+    Sorted.Reserve(Handlers.Num());
+    for (const TPair<FObjectKey, FHandlerProfile>& Pair : Handlers)
+    {
+        Sorted.Add(&Pair.Value);
+    }
+    Sorted.Sort([](const FHandlerProfile& A, const FHandlerProfile& B) { return A.TotalCycles > B.TotalCycles; });
+
+    TArray<FRPGEventHandlerProfile> Result;
+    for (int32 Index = 0; Index < FMath::Min(Count, Sorted.Num()); ++Index)
+    {
+        const FHandlerProfile& Profile = *Sorted[Index];
+
+        FRPGEventHandlerProfile& Entry = Result.AddDefaulted_GetRef();
+        Entry.HandlerName = Profile.Name;
+        Entry.Calls = Profile.Calls;
+        Entry.TotalMs = static_cast<float>(FPlatformTime::ToMilliseconds64(Profile.TotalCycles));
+        Entry.AverageMs = Profile.Calls > 0 ? Entry.TotalMs / Profile.Calls : 0.0f;
+        Entry.MaxMs = static_cast<float>(FPlatformTime::ToMilliseconds64(Profile.MaxCycles));
+        Entry.HistogramUs.Append(Profile.Histogram, NumHistogramBuckets);
+    }
+    return Result;
+}
+
+void FRPGEventProfiler::Reset()
+{
+    FMemory::Memzero(PublishCounts);
+    Handlers.Reset();
+    DispatchDepth = 0;
+    MaxDispatchDepth = 0;
+    QueueDepth = 0;
+    MaxCascadeDepth = 0;
+    ResetFrameCounters();
+}
+
+void FRPGEventProfiler::Dump(FOutputDevice& Ar, int32 Count) const
+{
+    const FRPGEventBusStats Stats = GetStats();
+    Ar.Logf(TEXT("RPG event bus [%s]: %lld published, %lld handler calls, %.3f ms in handlers, max dispatch depth %d, queue depth %d, max cascade depth %d"),
+        *OwnerName, Stats.TotalPublished, Stats.HandlerCalls, Stats.HandlerMs, Stats.MaxDispatchDepth, Stats.QueueDepth, Stats.MaxCascadeDepth);
+
+    for (int32 TypeIndex = 0; TypeIndex < RPGEventTypes::NumEventTypes; ++TypeIndex)
+    {
+        if (PublishCounts[TypeIndex] > 0)
+        {
+            Ar.Logf(TEXT("  %-20s %lld"), *RPGEventTypes::EventTypeToString(static_cast<ERPGEventType>(TypeIndex)), PublishCounts[TypeIndex]);
+        }
+    }
+
+    if (!IsHandlerProfilingEnabled() && Handlers.Num() == 0)
+    {
+        Ar.Log(TEXT("  Handler timing is off - set rpg.Events.ProfileHandlers 1"));
+        return;
+    }
+
+    Ar.Logf(TEXT("  Top %d handlers by total time (histogram buckets: <1us, <2us, <4us, ... >=%dus):"), Count, 1 << (NumHistogramBuckets - 2));
+    for (const FRPGEventHandlerProfile& Profile : GetTopHandlers(Count))
+    {
+        TStringBuilder<128> Histogram;
+        for (int32 Bucket = 0; Bucket < Profile.HistogramUs.Num(); ++Bucket)
+        {
+            Histogram.Appendf(Bucket == 0 ? TEXT("%d") : TEXT(" %d"), Profile.HistogramUs[Bucket]);
+        }
+
+        Ar.Logf(TEXT("  %-48s calls %8lld  total %9.3f ms  avg %7.4f ms  max %7.3f ms  [%s]"),
+            *Profile.HandlerName, Profile.Calls, Profile.TotalMs, Profile.AverageMs, Profile.MaxMs, Histogram.ToString());
+    }
+}
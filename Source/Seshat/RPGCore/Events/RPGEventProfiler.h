@@ -0,0 +1,181 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "UObject/ObjectKey.h"
+#include "RPGEventTypes.h"
+#include "RPGEventProfiler.generated.h"
+
+/** Unreal Insights channel for event dispatch and handler scopes (-trace=cpu,RPGEvents or Trace.Enable RPGEvents) */
+UE_TRACE_CHANNEL_EXTERN(RPGEventsChannel, SESHAT_API);
+
+/**
+ * Execution-time profile of one event handler
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGEventHandlerProfile
+{
+    GENERATED_BODY()
+
+    /** Handler object and class at the time it was first seen */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    FString HandlerName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    int64 Calls = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    float TotalMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    float AverageMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    float MaxMs = 0.0f;
+
+    /** Call counts per power-of-two microsecond bucket: [0] under 1us, [i] under 2^i us, last bucket open-ended */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    TArray<int32> HistogramUs;
+};
+
+/**
+ * Event bus counters
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGEventBusStats
+{
+    GENERATED_BODY()
+
+    /** Dispatches per event type, indexed by ERPGEventType */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    TArray<int64> PublishCounts;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    int64 TotalPublished = 0;
+
+    /** Handler calls and time (only while rpg.Events.ProfileHandlers is on) */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    int64 HandlerCalls = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    float HandlerMs = 0.0f;
+
+    /** Deepest nesting of synchronous dispatches (a handler publishing from inside a handler) */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    int32 MaxDispatchDepth = 0;
+
+    /** Queue depth at the last end of frame */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    int32 QueueDepth = 0;
+
+    /** Deepest queued cascade (events queued by handlers of queued events) */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    int32 MaxCascadeDepth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Profiler")
+    int32 ProfiledHandlers = 0;
+};
+
+/**
+ * Event bus instrumentation, fed by FRPGEventDispatcher and the owning subsystem (game thread only)
+ * Publish counts and depths are always recorded; per-handler timing costs two timer reads and a map lookup
+ * per handler call, so it only runs while rpg.Events.ProfileHandlers is on.
+ *
+ * Everything is reported three ways: STATGROUP_RPGEvents counters (stat RPGEvents), Insights scopes and
+ * counters on RPGEventsChannel, and the rpg.Events.DumpTopHandlers [N] console command. The stat and
+ * Insights counters are global, so only the oldest live profiler publishes them; the others are still
+ * listed by rpg.Events.DumpTopHandlers.
+ */
+class SESHAT_API FRPGEventProfiler
+{
+public:
+    static constexpr int32 NumHistogramBuckets = 16;
+
+    /**
+     * @param InOwnerName Name shown by rpg.Events.DumpTopHandlers when several buses are live (e.g. PIE clients)
+     * @param bInLive False for private profilers (benchmarks): kept out of the console commands and the global counters
+     */
+    explicit FRPGEventProfiler(const FString& InOwnerName, bool bInLive = true);
+    ~FRPGEventProfiler();
+
+    FRPGEventProfiler(const FRPGEventProfiler&) = delete;
+    FRPGEventProfiler& operator=(const FRPGEventProfiler&) = delete;
+
+    /** Whether per-handler timing is on (rpg.Events.ProfileHandlers) */
+    static bool IsHandlerProfilingEnabled();
+
+    FORCEINLINE void RecordPublish(ERPGEventType EventType)
+    {
+        ++PublishCounts[static_cast<int32>(EventType)];
+        ++FramePublished;
+    }
+
+    FORCEINLINE void EnterDispatch()
+    {
+        ++DispatchDepth;
+        MaxDispatchDepth = FMath::Max(MaxDispatchDepth, DispatchDepth);
+        FrameMaxDispatchDepth = FMath::Max(FrameMaxDispatchDepth, DispatchDepth);
+    }
+
+    FORCEINLINE void ExitDispatch()
+    {
+        // Reset may have run inside a handler
+        DispatchDepth = FMath::Max(DispatchDepth - 1, 0);
+    }
+
+    /** One handler call that took Cycles (FPlatformTime::Cycles64 units) */
+    void RecordHandler(const UObject* Handler, uint64 Cycles);
+
+    /** Queue depth and cascade depth, sampled once per frame by the owner */
+    void RecordQueue(int32 Pending, int32 CascadeDepth);
+
+    /** Push this frame's counters to the stats system and Insights (oldest live profiler only), then start a new frame */
+    void PublishFrameStats();
+
+    FRPGEventBusStats GetStats() const;
+
+    /** Handlers ordered by total time, most expensive first */
+    TArray<FRPGEventHandlerProfile> GetTopHandlers(int32 Count) const;
+
+    /** Clear every counter and handler profile */
+    void Reset();
+
+    /** Write the top handlers and per-type publish counts to Ar */
+    void Dump(FOutputDevice& Ar, int32 Count) const;
+
+    const FString& GetOwnerName() const { return OwnerName; }
+
+    /** Whether this profiler owns the global stat and Insights counters */
+    bool PublishesGlobalStats() const;
+
+private:
+    struct FHandlerProfile
+    {
+        FString Name;
+        int64 Calls = 0;
+        uint64 TotalCycles = 0;
+        uint64 MaxCycles = 0;
+        int32 Histogram[NumHistogramBuckets] = {};
+    };
+
+    static int32 GetHistogramBucket(double Microseconds);
+
+    void ResetFrameCounters();
+
+    FString OwnerName;
+    bool bLive;
+
+    int64 PublishCounts[RPGEventTypes::NumEventTypes] = {};
+    TMap<FObjectKey, FHandlerProfile> Handlers;
+
+    int32 DispatchDepth = 0;
+    int32 MaxDispatchDepth = 0;
+    int32 QueueDepth = 0;
+    int32 MaxCascadeDepth = 0;
+
+    /** Reset by PublishFrameStats */
+    int32 FramePublished = 0;
+    int32 FrameHandlerCalls = 0;
+    uint64 FrameHandlerCycles = 0;
+    int32 FrameMaxDispatchDepth = 0;
+};
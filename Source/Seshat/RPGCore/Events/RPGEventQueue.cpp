@@ -0,0 +1,180 @@
+#include "RPGEventQueue.h"
+#include "RPGEventDispatcher.h"
+#include "RPGEventArena.h"
+#include "HAL/PlatformTime.h"
+
+FRPGEventQueue::FRPGEventQueue(FRPGEventArena& InArena)
+    : Arena(InArena)
+{
+}
+
+FRPGEventQueue::~FRPGEventQueue()
+{
+    Reset();
+}
+
+FRPGEventContext& FRPGEventQueue::AcquireSlot()
+{
+    FRPGEventContext& Slot = Arena.Acquire();
+    Arena.Retain(Slot);
+    return Slot;
+}
+
+bool FRPGEventQueue::Enqueue(const FRPGEventContext& Context)
+{
+    const int32 Depth = GetEnqueueDepth();
+    if (Depth == INDEX_NONE)
+    {
+        return false;
+    }
+
+    FRPGEventContext& Slot = AcquireSlot();
+    Slot = Context;
+    Back.Add({ &Slot, Depth });
+
+    ++Stats.TotalQueued;
+    Stats.MaxObservedDepth = FMath::Max(Stats.MaxObservedDepth, Depth);
+    Stats.Pending = Num();
+    return true;
+}
+
+bool FRPGEventQueue::Enqueue(FRPGEventContext&& Context)
+{
+    const int32 Depth = GetEnqueueDepth();
+    if (Depth == INDEX_NONE)
+    {
+        return false;
+    }
+
+    FRPGEventContext& Slot = AcquireSlot();
+    Slot = MoveTemp(Context);
+    Back.Add({ &Slot, Depth });
+
+    ++Stats.TotalQueued;
+    Stats.MaxObservedDepth = FMath::Max(Stats.MaxObservedDepth, Depth);
+    Stats.Pending = Num();
+    return true;
+}
+
+int32 FRPGEventQueue::GetEnqueueDepth()
+{
+    // Outside a flush every event starts a new chain
+    const int32 Depth = CurrentDepth == INDEX_NONE ? 0 : CurrentDepth + 1;
+    if (Settings.MaxCascadeDepth > 0 && Depth > Settings.MaxCascadeDepth)
+    {
+        ++Stats.TotalDroppedCascade;
+        UE_LOG(LogTemp, Warning, TEXT("FRPGEventQueue: Dropped event at cascade depth %d (max %d)"), Depth, Settings.MaxCascadeDepth);
+        return INDEX_NONE;
+    }
+    return Depth;
+}
+
+void FRPGEventQueue::SwapBuffers()
+{
+    if (FrontCursor > 0)
+    {
+        Front.RemoveAt(0, FrontCursor, EAllowShrinking::No);
+        FrontCursor = 0;
+    }
+
+    if (Front.Num() == 0)
+    {
+        Swap(Front, Back);
+    }
+    else
+    {
+        // Deferred events stay ahead of newer events with the same priority
+        Front.Append(Back);
+        Back.Reset();
+    }
+
+    Front.StableSort([](const FQueuedEvent& A, const FQueuedEvent& B)
+    {
+        return static_cast<uint8>(A.Context->Priority) > static_cast<uint8>(B.Context->Priority);
+    });
+}
+
+int32 FRPGEventQueue::Flush(FRPGEventDispatcher& Dispatcher)
+{
+    // A handler calling Flush would reorder the buffer being drained
+    if (IsFlushing())
+    {
+        return 0;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    const double Deadline = Settings.FrameBudgetMs > 0.0f ? StartTime + Settings.FrameBudgetMs / 1000.0 : 0.0;
+
+    int32 Dispatched = 0;
+    bool bOverBudget = false;
+
+    SwapBuffers();
+
+    while (true)
+    {
+        if (FrontCursor >= Front.Num())
+        {
+            // Front drained - pick up cascades queued during this flush
+            if (Back.Num() == 0)
+            {
+                break;
+            }
+            SwapBuffers();
+        }
+
+        if ((Settings.MaxEventsPerFrame > 0 && Dispatched >= Settings.MaxEventsPerFrame) ||
+            (Deadline > 0.0 && Dispatched > 0 && FPlatformTime::Seconds() >= Deadline))
+        {
+            bOverBudget = true;
+            break;
+        }
+
+        // Copy out first: handlers may enqueue, which only ever touches Back
+        const FQueuedEvent Queued = Front[FrontCursor++];
+        CurrentDepth = Queued.Depth;
+
+        Dispatcher.Dispatch(*Queued.Context);
+        Arena.Release(*Queued.Context);
+        ++Dispatched;
+    }
+
+    CurrentDepth = INDEX_NONE;
+
+    // Compact now so the next Enqueue/Num see only live events
+    if (FrontCursor >= Front.Num())
+    {
+        Front.Reset();
+        FrontCursor = 0;
+    }
+
+    Stats.LastFlushDispatched = Dispatched;
+    Stats.LastFlushDeferred = bOverBudget ? Num() : 0;
+    Stats.LastFlushMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    Stats.TotalDispatched += Dispatched;
+    Stats.TotalOverBudgetFlushes += bOverBudget ? 1 : 0;
+    Stats.Pending = Num();
+
+    if (bOverBudget)
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("FRPGEventQueue: Budget reached after %d events, %d deferred to next frame"), Dispatched, Stats.LastFlushDeferred);
+    }
+
+    return Dispatched;
+}
+
+void FRPGEventQueue::Reset()
+{
+    for (int32 Index = FrontCursor; Index < Front.Num(); ++Index)
+    {
+        Arena.Release(*Front[Index].Context);
+    }
+    for (const FQueuedEvent& Queued : Back)
+    {
+        Arena.Release(*Queued.Context);
+    }
+
+    Front.Reset();
+    Back.Reset();
+    FrontCursor = 0;
+    Stats.Pending = 0;
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RPGEventContext.h"
+#include "RPGEventQueue.generated.h"
+
+class FRPGEventDispatcher;
+class FRPGEventArena;
+
+/**
+ * When in the frame the event bus drains its queue
+ */
+UENUM(BlueprintType)
+enum class ERPGEventFlushPhase : uint8
+{
+    /** Before any actor ticks (FWorldDelegates::OnWorldTickStart) */
+    FrameStart      UMETA(DisplayName = "Frame Start"),
+    /** After level streaming and before actor tick groups (FWorldDelegates::OnWorldPreActorTick) */
+    PreActorTick    UMETA(DisplayName = "Pre Actor Tick"),
+    /** After every actor tick group (FWorldDelegates::OnWorldPostActorTick) */
+    PostActorTick   UMETA(DisplayName = "Post Actor Tick"),
+    /** After the world has ticked and rendered (FCoreDelegates::OnEndFrame) */
+    EndOfFrame      UMETA(DisplayName = "End Of Frame"),
+    /** Only when FlushEventQueue is called */
+    Manual          UMETA(DisplayName = "Manual")
+};
+
+/**
+ * Queued publish settings
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGEventQueueSettings
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Event Queue")
+    ERPGEventFlushPhase FlushPhase = ERPGEventFlushPhase::PostActorTick;
+
+    /** Events dispatched per flush before the rest are deferred to the next frame (0 = unlimited) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Event Queue")
+    int32 MaxEventsPerFrame = 1024;
+
+    /** Wall-clock budget per flush in milliseconds before the rest are deferred (0 = unlimited) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Event Queue")
+    float FrameBudgetMs = 2.0f;
+
+    /** Events queued by handlers of queued events, this many levels deep, are dropped */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Event Queue")
+    int32 MaxCascadeDepth = 16;
+};
+
+/**
+ * Queued publish counters
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGEventQueueStats
+{
+    GENERATED_BODY()
+
+    /** Events waiting for the next flush */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Queue")
+    int32 Pending = 0;
+
+    /** Events dispatched by the last flush */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Queue")
+    int32 LastFlushDispatched = 0;
+
+    /** Events the last flush pushed to the next frame because the budget ran out */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Queue")
+    int32 LastFlushDeferred = 0;
+
+    /** Time spent in the last flush */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Queue")
+    float LastFlushMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Queue")
+    int64 TotalQueued = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Event Queue")
+    int64 TotalDispatched = 0;
+
+    /** Flushes that ran out of budget */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Queue")
+    int64 TotalOverBudgetFlushes = 0;
+
+    /** Events dropped for exceeding MaxCascadeDepth */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Queue")
+    int64 TotalDroppedCascade = 0;
+
+    /** Deepest cascade seen */
+    UPROPERTY(BlueprintReadOnly, Category = "Event Queue")
+    int32 MaxObservedDepth = 0;
+};
+
+/**
+ * Double-buffered deferred event queue
+ * Publishing appends to the back buffer; a flush swaps buffers and drains the front in priority order
+ * (FIFO within a priority). Events queued by handlers during a flush land in the back buffer one
+ * cascade level deeper and drain in the same flush while budget remains. Whatever does not fit
+ * in the frame budget stays queued, ahead of newer events of the same priority, for the next flush.
+ * Queued contexts are copied into retained FRPGEventArena slots and released once dispatched, so the buffers
+ * only shuffle pointers and both keep their capacity between frames.
+ */
+class SESHAT_API FRPGEventQueue
+{
+public:
+    explicit FRPGEventQueue(FRPGEventArena& InArena);
+    ~FRPGEventQueue();
+
+    /** Queue an event; false if it was dropped for exceeding the cascade depth cap */
+    bool Enqueue(const FRPGEventContext& Context);
+
+    /** Move-in overload for callers that built the context just to queue it */
+    bool Enqueue(FRPGEventContext&& Context);
+
+    /**
+     * Drain queued events into Dispatcher within the budget
+     * @return Number of events dispatched
+     */
+    int32 Flush(FRPGEventDispatcher& Dispatcher);
+
+    /** Drop every queued event, releasing its arena slot */
+    void Reset();
+
+    bool IsFlushing() const { return CurrentDepth != INDEX_NONE; }
+    int32 Num() const { return (Front.Num() - FrontCursor) + Back.Num(); }
+
+    FRPGEventQueueSettings Settings;
+
+    const FRPGEventQueueStats& GetStats() const { return Stats; }
+
+private:
+    struct FQueuedEvent
+    {
+        FRPGEventContext* Context = nullptr;
+        int32 Depth = 0;
+    };
+
+    /** Retained arena slot holding a copy of the next queued event */
+    FRPGEventContext& AcquireSlot();
+
+    /** Cascade depth for an event queued right now, or INDEX_NONE if it must be dropped */
+    int32 GetEnqueueDepth();
+
+    /** Move the back buffer behind the undrained front events and re-sort by priority */
+    void SwapBuffers();
+
+    FRPGEventArena& Arena;
+
+    TArray<FQueuedEvent> Front;
+    TArray<FQueuedEvent> Back;
+
+    /** First undrained event in Front */
+    int32 FrontCursor = 0;
+
+    /** Depth of the event being dispatched, INDEX_NONE outside a flush */
+    int32 CurrentDepth = INDEX_NONE;
+
+    FRPGEventQueueStats Stats;
+};
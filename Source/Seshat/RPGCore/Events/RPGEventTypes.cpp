@@ -2,67 +2,64 @@
 
 namespace RPGEventTypes
 {
-    FString EventTypeToString(ERPGEventType EventType)
+    namespace
     {
-        switch (EventType)
+        /** Names indexed by ERPGEventType, built once */
+        const FString EventTypeNames[NumEventTypes] =
         {
-            case ERPGEventType::Unknown:                return TEXT("Unknown");
-            case ERPGEventType::EntityCreated:          return TEXT("EntityCreated");
-            case ERPGEventType::EntityDestroyed:        return TEXT("EntityDestroyed");
-            case ERPGEventType::EntityModified:         return TEXT("EntityModified");
-            case ERPGEventType::DiceRolled:             return TEXT("DiceRolled");
-            case ERPGEventType::RandomSelection:        return TEXT("RandomSelection");
-            case ERPGEventType::EntityMoved:            return TEXT("EntityMoved");
-            case ERPGEventType::EntityPositioned:       return TEXT("EntityPositioned");
-            case ERPGEventType::AreaEntered:            return TEXT("AreaEntered");
-            case ERPGEventType::AreaExited:             return TEXT("AreaExited");
-            case ERPGEventType::AttackInitiated:        return TEXT("AttackInitiated");
-            case ERPGEventType::AttackResolved:         return TEXT("AttackResolved");
-            case ERPGEventType::DamageDealt:            return TEXT("DamageDealt");
-            case ERPGEventType::DamageReceived:         return TEXT("DamageReceived");
-            case ERPGEventType::ConditionApplied:       return TEXT("ConditionApplied");
-            case ERPGEventType::ConditionRemoved:       return TEXT("ConditionRemoved");
-            case ERPGEventType::ConditionTriggered:     return TEXT("ConditionTriggered");
-            case ERPGEventType::ResourceChanged:        return TEXT("ResourceChanged");
-            case ERPGEventType::ResourceDepleted:       return TEXT("ResourceDepleted");
-            case ERPGEventType::ResourceRestored:       return TEXT("ResourceRestored");
-            case ERPGEventType::TurnStarted:            return TEXT("TurnStarted");
-            case ERPGEventType::TurnEnded:              return TEXT("TurnEnded");
-            case ERPGEventType::RoundStarted:           return TEXT("RoundStarted");
-            case ERPGEventType::RoundEnded:             return TEXT("RoundEnded");
-            case ERPGEventType::Custom:                 return TEXT("Custom");
-            default:                                    return TEXT("Unknown");
+            TEXT("Unknown"),
+            TEXT("EntityCreated"),
+            TEXT("EntityDestroyed"),
+            TEXT("EntityModified"),
+            TEXT("DiceRolled"),
+            TEXT("RandomSelection"),
+            TEXT("EntityMoved"),
+            TEXT("EntityPositioned"),
+            TEXT("AreaEntered"),
+            TEXT("AreaExited"),
+            TEXT("AttackInitiated"),
+            TEXT("AttackResolved"),
+            TEXT("DamageDealt"),
+            TEXT("DamageReceived"),
+            TEXT("ConditionApplied"),
+            TEXT("ConditionRemoved"),
+            TEXT("ConditionTriggered"),
+            TEXT("ResourceChanged"),
+            TEXT("ResourceDepleted"),
+            TEXT("ResourceRestored"),
+            TEXT("TurnStarted"),
+            TEXT("TurnEnded"),
+            TEXT("RoundStarted"),
+            TEXT("RoundEnded"),
+            TEXT("Custom")
+        };
+
+        /** Reverse lookup (FString keys hash case-insensitively, matching the old == chain) */
+        const TMap<FString, ERPGEventType>& GetEventTypeLookup()
+        {
+            static const TMap<FString, ERPGEventType> Lookup = []()
+            {
+                TMap<FString, ERPGEventType> Result;
+                for (int32 Index = 0; Index < NumEventTypes; ++Index)
+                {
+                    Result.Add(EventTypeNames[Index], static_cast<ERPGEventType>(Index));
+                }
+                return Result;
+            }();
+            return Lookup;
         }
     }
 
+    const FString& EventTypeToString(ERPGEventType EventType)
+    {
+        const int32 Index = static_cast<int32>(EventType);
+        return Index < NumEventTypes ? EventTypeNames[Index] : EventTypeNames[0];
+    }
+
     ERPGEventType StringToEventType(const FString& TypeString)
     {
-        if (TypeString == TEXT("EntityCreated"))           return ERPGEventType::EntityCreated;
-        if (TypeString == TEXT("EntityDestroyed"))         return ERPGEventType::EntityDestroyed;
-        if (TypeString == TEXT("EntityModified"))          return ERPGEventType::EntityModified;
-        if (TypeString == TEXT("DiceRolled"))              return ERPGEventType::DiceRolled;
-        if (TypeString == TEXT("RandomSelection"))         return ERPGEventType::RandomSelection;
-        if (TypeString == TEXT("EntityMoved"))             return ERPGEventType::EntityMoved;
-        if (TypeString == TEXT("EntityPositioned"))        return ERPGEventType::EntityPositioned;
-        if (TypeString == TEXT("AreaEntered"))             return ERPGEventType::AreaEntered;
-        if (TypeString == TEXT("AreaExited"))              return ERPGEventType::AreaExited;
-        if (TypeString == TEXT("AttackInitiated"))         return ERPGEventType::AttackInitiated;
-        if (TypeString == TEXT("AttackResolved"))          return ERPGEventType::AttackResolved;
-        if (TypeString == TEXT("DamageDealt"))             return ERPGEventType::DamageDealt;
-        if (TypeString == TEXT("DamageReceived"))          return ERPGEventType::DamageReceived;
-        if (TypeString == TEXT("ConditionApplied"))        return ERPGEventType::ConditionApplied;
-        if (TypeString == TEXT("ConditionRemoved"))        return ERPGEventType::ConditionRemoved;
-        if (TypeString == TEXT("ConditionTriggered"))      return ERPGEventType::ConditionTriggered;
-        if (TypeString == TEXT("ResourceChanged"))         return ERPGEventType::ResourceChanged;
-        if (TypeString == TEXT("ResourceDepleted"))        return ERPGEventType::ResourceDepleted;
-        if (TypeString == TEXT("ResourceRestored"))        return ERPGEventType::ResourceRestored;
-        if (TypeString == TEXT("TurnStarted"))             return ERPGEventType::TurnStarted;
-        if (TypeString == TEXT("TurnEnded"))               return ERPGEventType::TurnEnded;
-        if (TypeString == TEXT("RoundStarted"))            return ERPGEventType::RoundStarted;
-        if (TypeString == TEXT("RoundEnded"))              return ERPGEventType::RoundEnded;
-        if (TypeString == TEXT("Custom"))                  return ERPGEventType::Custom;
-        
-        return ERPGEventType::Unknown;
+        const ERPGEventType* Found = GetEventTypeLookup().Find(TypeString);
+        return Found ? *Found : ERPGEventType::Unknown;
     }
 
     FString ModifierTypeToString(ERPGEventModifier ModifierType)
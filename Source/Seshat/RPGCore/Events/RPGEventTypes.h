@@ -133,9 +133,65 @@ enum class ERPGEventSubscriptionType : uint8
     TimeLimited         UMETA(DisplayName = "Time Limited")
 };
 
+/**
+ * Which entity of an event an entity-scoped subscription matches
+ */
+UENUM(BlueprintType)
+enum class ERPGEventEntityScope : uint8
+{
+    Source              UMETA(DisplayName = "Source Entity"),
+    Target              UMETA(DisplayName = "Target Entity"),
+    Either              UMETA(DisplayName = "Source or Target Entity")
+};
+
+/**
+ * What a subscribed handler may do with the events it receives
+ * Read-only handlers (logging, UI, analytics) run after the priority-ordered chain, in parallel on the
+ * task graph when the handler is native; they see the final context and cannot handle or cancel it
+ */
+UENUM(BlueprintType)
+enum class ERPGEventHandlerAccess : uint8
+{
+    Mutating            UMETA(DisplayName = "Mutating (Game Thread, Priority Order)"),
+    ReadOnly            UMETA(DisplayName = "Read-Only (Parallel)")
+};
+
+/**
+ * Generation-checked handle to an in-process event subscription
+ * Low 32 bits: slot index, high 32 bits: slot generation (never 0 for a live handle)
+ * A handle whose subscription was removed stays invalid even after its slot is reused
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGEventHandle
+{
+    GENERATED_BODY()
+
+    FRPGEventHandle() = default;
+
+    FRPGEventHandle(uint32 InSlot, uint32 InGeneration)
+        : Value(static_cast<int64>((static_cast<uint64>(InGeneration) << 32) | InSlot))
+    {
+    }
+
+    UPROPERTY(BlueprintReadOnly, Category = "RPG Event Subscription")
+    int64 Value = 0;
+
+    bool IsValid() const { return Value != 0; }
+    uint32 GetSlot() const { return static_cast<uint32>(static_cast<uint64>(Value)); }
+    uint32 GetGeneration() const { return static_cast<uint32>(static_cast<uint64>(Value) >> 32); }
+
+    bool operator==(const FRPGEventHandle& Other) const { return Value == Other.Value; }
+    bool operator!=(const FRPGEventHandle& Other) const { return Value != Other.Value; }
+
+    friend uint32 GetTypeHash(const FRPGEventHandle& Handle) { return ::GetTypeHash(Handle.Value); }
+};
+
 // Event type utility functions
 namespace RPGEventTypes
 {
+    /** Number of ERPGEventType values - the size of enum-indexed tables */
+    constexpr int32 NumEventTypes = static_cast<int32>(ERPGEventType::Custom) + 1;
+
     // Common event type constants as strings
     const FString EntityCreated = TEXT("EntityCreated");
     const FString EntityDestroyed = TEXT("EntityDestroyed");
@@ -147,8 +203,33 @@ namespace RPGEventTypes
     const FString TurnEnded = TEXT("TurnEnded");
     
     // Utility functions for type conversion
-    SESHAT_API FString EventTypeToString(ERPGEventType EventType);
+    SESHAT_API const FString& EventTypeToString(ERPGEventType EventType);
     SESHAT_API ERPGEventType StringToEventType(const FString& TypeString);
     SESHAT_API FString ModifierTypeToString(ERPGEventModifier ModifierType);
     SESHAT_API ERPGEventModifier StringToModifierType(const FString& ModifierString);
+}
+
+// Event context keys matching the toolkit constants (events/context.go, GetContextKey* exports)
+namespace RPGEventKeys
+{
+    const FName Attacker(TEXT("attacker"));
+    const FName Target(TEXT("target"));
+    const FName Weapon(TEXT("weapon"));
+    const FName DamageType(TEXT("damage_type"));
+    const FName Advantage(TEXT("advantage"));
+    const FName Roll(TEXT("roll"));
+    const FName OldPosition(TEXT("old_position"));
+    const FName NewPosition(TEXT("new_position"));
+    const FName RoomID(TEXT("room_id"));
+    
+    // Grid cells on EntityMoved events (URPGEvent::CreateMoveEvent), read by the entity subsystem's spatial index
+    const FName OldCellX(TEXT("old_cell_x"));
+    const FName OldCellY(TEXT("old_cell_y"));
+    const FName NewCellX(TEXT("new_cell_x"));
+    const FName NewCellY(TEXT("new_cell_y"));
+    
+    // Set on events delivered from the toolkit (entity interfaces cannot cross the boundary, so their IDs do)
+    const FName SourceID(TEXT("source_id"));
+    const FName TargetID(TEXT("target_id"));
+    const FName ToolkitOrigin(TEXT("toolkit_origin"));
 }
\ No newline at end of file
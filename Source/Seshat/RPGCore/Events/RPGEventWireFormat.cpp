@@ -0,0 +1,304 @@
+#include "RPGEventWireFormat.h"
+#include "Containers/StringConv.h"
+#include "Misc/StringBuilder.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "FRPGEventWireFormat writes host-order integers and expects little-endian");
+
+namespace
+{
+    template <typename T>
+    void WriteValue(TArray<uint8>& Out, T Value)
+    {
+        const int32 Offset = Out.AddUninitialized(sizeof(T));
+        FMemory::Memcpy(Out.GetData() + Offset, &Value, sizeof(T));
+    }
+
+    template <typename T>
+    void WriteValueAt(TArray<uint8>& Out, int32 Offset, T Value)
+    {
+        FMemory::Memcpy(Out.GetData() + Offset, &Value, sizeof(T));
+    }
+
+    /** Append UTF-8 bytes, clamped to MaxBytes; returns the byte count written */
+    int32 WriteUTF8(TArray<uint8>& Out, FStringView Text, int32 MaxBytes)
+    {
+        FTCHARToUTF8 Converted(Text.GetData(), Text.Len());
+        const uint8* Bytes = reinterpret_cast<const uint8*>(Converted.Get());
+        int32 Length = FMath::Min(Converted.Length(), MaxBytes);
+        if (Length < Converted.Length())
+        {
+            // Back up over continuation bytes so a truncated string never ends in half a codepoint
+            while (Length > 0 && (Bytes[Length] & 0xC0) == 0x80)
+            {
+                --Length;
+            }
+        }
+        Out.Append(Bytes, Length);
+        return Length;
+    }
+
+    bool IsValidPriority(uint8 Value)
+    {
+        switch (static_cast<ERPGEventPriority>(Value))
+        {
+        case ERPGEventPriority::Lowest:
+        case ERPGEventPriority::Low:
+        case ERPGEventPriority::Normal:
+        case ERPGEventPriority::High:
+        case ERPGEventPriority::Highest:
+        case ERPGEventPriority::Critical:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    void WriteShortString(TArray<uint8>& Out, FStringView Text)
+    {
+        const int32 LengthOffset = Out.AddUninitialized(sizeof(uint16));
+        const int32 Length = WriteUTF8(Out, Text, MAX_uint16);
+        WriteValueAt(Out, LengthOffset, static_cast<uint16>(Length));
+    }
+
+    /** Bounds-checked reader; the first failed read latches bError */
+    struct FWireReader
+    {
+        const uint8* Data;
+        int32 Length;
+        int32 Position = 0;
+        bool bError = false;
+
+        const uint8* Take(int32 Count)
+        {
+            if (bError || Count < 0 || Position + Count > Length)
+            {
+                bError = true;
+                return nullptr;
+            }
+            const uint8* Result = Data + Position;
+            Position += Count;
+            return Result;
+        }
+
+        template <typename T>
+        T Read()
+        {
+            T Value{};
+            if (const uint8* Bytes = Take(sizeof(T)))
+            {
+                FMemory::Memcpy(&Value, Bytes, sizeof(T));
+            }
+            return Value;
+        }
+
+        FString ReadString(int32 Count)
+        {
+            const uint8* Bytes = Take(Count);
+            if (!Bytes || Count == 0)
+            {
+                return FString();
+            }
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes), Count);
+            return FString(Converted.Length(), Converted.Get());
+        }
+
+        FName ReadName(int32 Count)
+        {
+            const uint8* Bytes = Take(Count);
+            if (!Bytes || Count == 0)
+            {
+                return NAME_None;
+            }
+            FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes), Count);
+            return FName(Converted.Length(), Converted.Get());
+        }
+    };
+}
+
+int32 FRPGEventWireFormat::Encode(const FRPGEventContext& Context, TArray<uint8>& Out)
+{
+    const int32 Start = Out.Num();
+
+    // Entity strings are referenced in place, not copied
+    static const FString EmptyString;
+    const IRPGEntityInterface* Source = Context.SourceEntity.GetInterface();
+    const IRPGEntityInterface* Target = Context.TargetEntity.GetInterface();
+    const FString& SourceID = Source ? Source->GetID() : EmptyString;
+    const FString& SourceType = Source ? Source->GetType() : EmptyString;
+    const FString& TargetID = Target ? Target->GetID() : EmptyString;
+    const FString& TargetType = Target ? Target->GetType() : EmptyString;
+
+    TStringBuilder<64> NameBuilder;
+    if (!Context.EventName.IsNone())
+    {
+        Context.EventName.AppendString(NameBuilder);
+    }
+
+    // Header - string lengths are patched in as each string is written
+    Out.AddZeroed(HeaderSize);
+    WriteValueAt(Out, Start + 0, Magic);
+    WriteValueAt(Out, Start + 4, Version);
+    WriteValueAt(Out, Start + 6, static_cast<uint8>(Context.EventType));
+    WriteValueAt(Out, Start + 7, static_cast<uint8>(Context.Priority));
+    WriteValueAt(Out, Start + 8, (Context.bCancelled ? FlagCancelled : 0u) | (Context.bHandled ? FlagHandled : 0u));
+    WriteValueAt(Out, Start + 12, static_cast<uint32>(Context.ModifierMask));
+    WriteValueAt(Out, Start + 16, Context.EventID.A);
+    WriteValueAt(Out, Start + 20, Context.EventID.B);
+    WriteValueAt(Out, Start + 24, Context.EventID.C);
+    WriteValueAt(Out, Start + 28, Context.EventID.D);
+    WriteValueAt(Out, Start + 32, Context.Timestamp);
+
+    const FStringView Strings[] = { NameBuilder.ToView(), SourceID, SourceType, TargetID, TargetType };
+    for (int32 Index = 0; Index < UE_ARRAY_COUNT(Strings); ++Index)
+    {
+        const int32 Length = WriteUTF8(Out, Strings[Index], MAX_uint16);
+        WriteValueAt(Out, Start + 40 + Index * 2, static_cast<uint16>(Length));
+    }
+
+    const int32 NumEntries = FMath::Min(Context.Data.Num(), static_cast<int32>(MAX_uint16));
+    WriteValueAt(Out, Start + 50, static_cast<uint16>(NumEntries));
+
+    Context.Data.ForEach([&Out, NumEntries](FName Key, ERPGEventValueType Type, const FRPGEventPayload& Payload, int32 Index)
+    {
+        if (Index >= NumEntries)
+        {
+            return;
+        }
+
+        WriteValue(Out, static_cast<uint8>(Type));
+
+        TStringBuilder<64> KeyBuilder;
+        Key.AppendString(KeyBuilder);
+        const int32 KeyLengthOffset = Out.AddUninitialized(sizeof(uint8));
+        WriteValueAt(Out, KeyLengthOffset, static_cast<uint8>(WriteUTF8(Out, KeyBuilder.ToView(), MAX_uint8)));
+
+        switch (Type)
+        {
+        case ERPGEventValueType::Int:
+            WriteValue(Out, Payload.GetIntAt(Index));
+            break;
+        case ERPGEventValueType::Float:
+            WriteValue(Out, Payload.GetFloatAt(Index));
+            break;
+        case ERPGEventValueType::Bool:
+            WriteValue(Out, static_cast<uint8>(Payload.GetBoolAt(Index) ? 1 : 0));
+            break;
+        case ERPGEventValueType::String:
+            WriteShortString(Out, Payload.GetStringAt(Index));
+            break;
+        case ERPGEventValueType::Object:
+        {
+            // Entities travel by ID, anything else by name
+            UObject* Object = Payload.GetObjectAt(Index);
+            IRPGEntityInterface* Entity = Cast<IRPGEntityInterface>(Object);
+            if (Entity)
+            {
+                WriteShortString(Out, Entity->GetID());
+            }
+            else
+            {
+                WriteShortString(Out, Object ? Object->GetName() : FString());
+            }
+            break;
+        }
+        }
+    });
+
+    return Out.Num() - Start;
+}
+
+bool FRPGEventWireFormat::Decode(const uint8* Data, int32 Length, FRPGEventContext& OutContext, FRPGEventWireEntities* OutEntities)
+{
+    if (!Data || Length < HeaderSize)
+    {
+        return false;
+    }
+
+    FWireReader Reader{ Data, Length };
+    if (Reader.Read<uint32>() != Magic || Reader.Read<uint16>() != Version)
+    {
+        return false;
+    }
+
+    const uint8 EventType = Reader.Read<uint8>();
+    if (EventType >= RPGEventTypes::NumEventTypes)
+    {
+        return false;
+    }
+
+    const uint8 Priority = Reader.Read<uint8>();
+    if (!IsValidPriority(Priority))
+    {
+        return false;
+    }
+
+    OutContext.Reset();
+    OutContext.EventType = static_cast<ERPGEventType>(EventType);
+    OutContext.Priority = static_cast<ERPGEventPriority>(Priority);
+
+    const uint32 Flags = Reader.Read<uint32>();
+    OutContext.bCancelled = (Flags & FlagCancelled) != 0;
+    OutContext.bHandled = (Flags & FlagHandled) != 0;
+    OutContext.ModifierMask = static_cast<int32>(Reader.Read<uint32>());
+
+    OutContext.EventID.A = Reader.Read<uint32>();
+    OutContext.EventID.B = Reader.Read<uint32>();
+    OutContext.EventID.C = Reader.Read<uint32>();
+    OutContext.EventID.D = Reader.Read<uint32>();
+    OutContext.Timestamp = Reader.Read<double>();
+
+    uint16 StringLengths[5];
+    for (uint16& StringLength : StringLengths)
+    {
+        StringLength = Reader.Read<uint16>();
+    }
+    const int32 NumEntries = Reader.Read<uint16>();
+
+    OutContext.EventName = Reader.ReadName(StringLengths[0]);
+    if (OutEntities)
+    {
+        OutEntities->SourceID = Reader.ReadString(StringLengths[1]);
+        OutEntities->SourceType = Reader.ReadString(StringLengths[2]);
+        OutEntities->TargetID = Reader.ReadString(StringLengths[3]);
+        OutEntities->TargetType = Reader.ReadString(StringLengths[4]);
+    }
+    else
+    {
+        Reader.Take(StringLengths[1] + StringLengths[2] + StringLengths[3] + StringLengths[4]);
+    }
+
+    for (int32 Index = 0; Index < NumEntries && !Reader.bError; ++Index)
+    {
+        const uint8 Type = Reader.Read<uint8>();
+        const FName Key = Reader.ReadName(Reader.Read<uint8>());
+
+        switch (static_cast<ERPGEventValueType>(Type))
+        {
+        case ERPGEventValueType::Int:
+            OutContext.Data.SetInt(Key, Reader.Read<int32>());
+            break;
+        case ERPGEventValueType::Float:
+            OutContext.Data.SetFloat(Key, Reader.Read<float>());
+            break;
+        case ERPGEventValueType::Bool:
+            OutContext.Data.SetBool(Key, Reader.Read<uint8>() != 0);
+            break;
+        case ERPGEventValueType::String:
+        case ERPGEventValueType::Object:
+        {
+            const int32 StringLength = Reader.Read<uint16>();
+            const uint8* Bytes = Reader.Take(StringLength);
+            if (Bytes)
+            {
+                FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Bytes), StringLength);
+                OutContext.Data.SetString(Key, FStringView(Converted.Get(), Converted.Length()));
+            }
+            break;
+        }
+        default:
+            return false;
+        }
+    }
+
+    return !Reader.bError;
+}
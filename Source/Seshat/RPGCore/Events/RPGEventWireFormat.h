@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RPGEventContext.h"
+
+/**
+ * Entity references carried by the wire format
+ * Entity interfaces cannot be rebuilt from bytes, so Decode hands back their IDs and types
+ */
+struct FRPGEventWireEntities
+{
+    FString SourceID;
+    FString SourceType;
+    FString TargetID;
+    FString TargetType;
+};
+
+/**
+ * Binary layout for FRPGEventContext across the CGO boundary (decoded by event_wire.go)
+ *
+ * Header (52 bytes, little-endian):
+ *   0  uint32  Magic "RPGE"
+ *   4  uint16  Version
+ *   6  uint8   ERPGEventType
+ *   7  uint8   ERPGEventPriority
+ *   8  uint32  Flags (bit 0 bCancelled, bit 1 bHandled)
+ *   12 uint32  ModifierMask
+ *   16 FGuid   EventID (A, B, C, D)
+ *   32 double  Timestamp
+ *   40 uint16  Lengths of EventName, SourceID, SourceType, TargetID, TargetType (UTF-8 bytes)
+ *   50 uint16  Entry count
+ * followed by the five strings, then per payload entry:
+ *   uint8 ERPGEventValueType, uint8 key length, key, value
+ *   (int32 | float | uint8 bool | uint16 length + UTF-8 for strings and objects)
+ *
+ * Object values travel as the entity ID (IRPGEntityInterface) or object name and decode as string entries.
+ */
+struct SESHAT_API FRPGEventWireFormat
+{
+    static constexpr uint32 Magic = 0x45475052;
+    static constexpr uint16 Version = 1;
+    static constexpr int32 HeaderSize = 52;
+
+    static constexpr uint32 FlagCancelled = 1 << 0;
+    static constexpr uint32 FlagHandled = 1 << 1;
+
+    /**
+     * Append the encoding of Context to Out (reuse Out across calls to avoid reallocating)
+     * Strings longer than 65535 UTF-8 bytes and keys longer than 255 are truncated
+     * @return Bytes appended
+     */
+    static int32 Encode(const FRPGEventContext& Context, TArray<uint8>& Out);
+
+    /**
+     * Decode one event into OutContext (entities are left empty; see OutEntities)
+     * @return False if the buffer is truncated, corrupt or from another version
+     */
+    static bool Decode(const uint8* Data, int32 Length, FRPGEventContext& OutContext, FRPGEventWireEntities* OutEntities = nullptr);
+};
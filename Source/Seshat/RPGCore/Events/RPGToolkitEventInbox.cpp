@@ -0,0 +1,110 @@
+#include "RPGToolkitEventInbox.h"
+#include "RPGEventArena.h"
+#include "RPGEventWireFormat.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Toolkit Inbox Depth"), STAT_RPGToolkitInboxDepth, STATGROUP_RPGEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Toolkit Inbox Peak Depth"), STAT_RPGToolkitInboxPeakDepth, STATGROUP_RPGEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Toolkit Inbox Last Drained"), STAT_RPGToolkitInboxLastDrained, STATGROUP_RPGEvents);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Toolkit Inbox Dropped"), STAT_RPGToolkitInboxDropped, STATGROUP_RPGEvents);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Toolkit Inbox Latency (ms)"), STAT_RPGToolkitInboxLatency, STATGROUP_RPGEvents);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Toolkit Inbox Max Latency (ms)"), STAT_RPGToolkitInboxMaxLatency, STATGROUP_RPGEvents);
+
+static_assert(FRPGToolkitEventInbox::MaxEventBytes > FRPGEventWireFormat::HeaderSize, "Inbox slots must hold at least a wire header");
+
+FRPGToolkitEventInbox::FRPGToolkitEventInbox(int32 InCapacity)
+    : Capacity(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 2))))
+    , Mask(Capacity - 1)
+{
+    Slots = MakeUnique<FSlot[]>(Capacity);
+
+    // Slot i is free for the producer that claims position i
+    for (uint64 Index = 0; Index < Capacity; ++Index)
+    {
+        Slots[Index].Sequence.store(Index, std::memory_order_relaxed);
+    }
+
+    Stats.Capacity = static_cast<int32>(Capacity);
+}
+
+int32 FRPGToolkitEventInbox::Receive(const uint8* Data, int32 Length, void* UserData)
+{
+    FRPGToolkitEventInbox* Inbox = static_cast<FRPGToolkitEventInbox*>(UserData);
+    return Inbox && Inbox->Push(Data, Length) ? 1 : 0;
+}
+
+bool FRPGToolkitEventInbox::Push(const uint8* Data, int32 Length)
+{
+    Received.fetch_add(1, std::memory_order_relaxed);
+
+    if (!Data || Length <= 0 || Length > MaxEventBytes)
+    {
+        DroppedOversize.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    uint64 Position = EnqueuePos.load(std::memory_order_relaxed);
+    FSlot* Slot = nullptr;
+    for (;;)
+    {
+        Slot = &Slots[Position & Mask];
+        const uint64 Sequence = Slot->Sequence.load(std::memory_order_acquire);
+        const int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+
+        if (Difference == 0)
+        {
+            // Slot is free at our position - claim it
+            if (EnqueuePos.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (Difference < 0)
+        {
+            // Consumer has not freed this slot yet: the ring is full
+            DroppedFull.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            // Another producer claimed it first
+            Position = EnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    FMemory::Memcpy(Slot->Bytes, Data, Length);
+    Slot->Length = Length;
+    Slot->EnqueueCycles = FPlatformTime::Cycles64();
+
+    // Publish to the consumer
+    Slot->Sequence.store(Position + 1, std::memory_order_release);
+    return true;
+}
+
+void FRPGToolkitEventInbox::RecordLatency(double LatencyMs)
+{
+    TotalLatencyMs += LatencyMs;
+    Stats.LastLatencyMs = static_cast<float>(LatencyMs);
+    Stats.MaxLatencyMs = FMath::Max(Stats.MaxLatencyMs, Stats.LastLatencyMs);
+}
+
+FRPGToolkitEventInboxStats FRPGToolkitEventInbox::GetStats() const
+{
+    FRPGToolkitEventInboxStats Result = Stats;
+    Result.Depth = Num();
+    Result.AverageLatencyMs = Stats.TotalDrained > 0 ? static_cast<float>(TotalLatencyMs / Stats.TotalDrained) : 0.0f;
+    Result.TotalReceived = Received.load(std::memory_order_relaxed);
+    Result.TotalDroppedFull = DroppedFull.load(std::memory_order_relaxed);
+    Result.TotalDroppedOversize = DroppedOversize.load(std::memory_order_relaxed);
+    return Result;
+}
+
+void FRPGToolkitEventInbox::PublishStats() const
+{
+    const FRPGToolkitEventInboxStats Current = GetStats();
+    SET_DWORD_STAT(STAT_RPGToolkitInboxDepth, Current.Depth);
+    SET_DWORD_STAT(STAT_RPGToolkitInboxPeakDepth, Current.PeakDepth);
+    SET_DWORD_STAT(STAT_RPGToolkitInboxLastDrained, Current.LastDrained);
+    SET_DWORD_STAT(STAT_RPGToolkitInboxDropped, Current.TotalDroppedFull + Current.TotalDroppedOversize);
+    SET_FLOAT_STAT(STAT_RPGToolkitInboxLatency, Current.LastLatencyMs);
+    SET_FLOAT_STAT(STAT_RPGToolkitInboxMaxLatency, Current.MaxLatencyMs);
+}
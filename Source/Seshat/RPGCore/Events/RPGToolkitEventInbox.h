@@ -0,0 +1,160 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "RPGToolkitEventInbox.generated.h"
+#include <atomic>
+
+/**
+ * Toolkit inbox counters
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGToolkitEventInboxStats
+{
+    GENERATED_BODY()
+
+    /** Events waiting in the ring */
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    int32 Depth = 0;
+
+    /** Deepest the ring has been when drained */
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    int32 PeakDepth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    int32 Capacity = 0;
+
+    /** Events taken by the last drain */
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    int32 LastDrained = 0;
+
+    /** Time from the Go callback to the game thread drain */
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    float LastLatencyMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    float AverageLatencyMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    float MaxLatencyMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    int64 TotalReceived = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    int64 TotalDrained = 0;
+
+    /** Events rejected because the ring was full */
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    int64 TotalDroppedFull = 0;
+
+    /** Events rejected for not fitting in a slot */
+    UPROPERTY(BlueprintReadOnly, Category = "Toolkit Inbox")
+    int64 TotalDroppedOversize = 0;
+};
+
+/**
+ * Bounded multi-producer/single-consumer ring of wire-format events sent from the toolkit
+ * Go subscribers call Receive (registered with RegisterEventCallback) from any goroutine; it copies the
+ * encoded event into a fixed slot and returns without locking or allocating. The game thread drains the
+ * ring once per tick and decodes the events into FRPGEventContext.
+ *
+ * Each slot carries a sequence number (bounded MPMC queue after Vyukov): producers claim a position
+ * with a CAS on EnqueuePos and publish the slot by advancing its sequence, so the consumer never sees
+ * a half-written event.
+ */
+class SESHAT_API FRPGToolkitEventInbox
+{
+public:
+    /** Largest encoded event a slot holds (slots are 512 bytes) */
+    static constexpr int32 MaxEventBytes = 488;
+
+    /** Capacity is rounded up to a power of two */
+    explicit FRPGToolkitEventInbox(int32 InCapacity = 1024);
+
+    FRPGToolkitEventInbox(const FRPGToolkitEventInbox&) = delete;
+    FRPGToolkitEventInbox& operator=(const FRPGToolkitEventInbox&) = delete;
+
+    /** C callback for RegisterEventCallback (UserData is the inbox); returns 0 if the event was dropped */
+    static int32 Receive(const uint8* Data, int32 Length, void* UserData);
+
+    /** Producer (any thread): copy one encoded event into the ring, false if full or oversize */
+    bool Push(const uint8* Data, int32 Length);
+
+    /**
+     * Consumer (game thread): hand up to MaxEvents events to Func oldest first
+     * Func(const uint8* Data, int32 Length) must not keep Data
+     * @return Number of events drained
+     */
+    template <typename FuncType>
+    int32 Drain(FuncType&& Func, int32 MaxEvents = MAX_int32)
+    {
+        const int32 Depth = Num();
+        Stats.PeakDepth = FMath::Max(Stats.PeakDepth, Depth);
+
+        const uint64 NowCycles = FPlatformTime::Cycles64();
+        int32 Drained = 0;
+        while (Drained < MaxEvents)
+        {
+            FSlot& Slot = Slots[DequeuePos & Mask];
+            if (Slot.Sequence.load(std::memory_order_acquire) != DequeuePos + 1)
+            {
+                break;
+            }
+
+            RecordLatency(FPlatformTime::ToMilliseconds64(NowCycles - FMath::Min(NowCycles, Slot.EnqueueCycles)));
+            Func(static_cast<const uint8*>(Slot.Bytes), Slot.Length);
+
+            // Hand the slot back to producers one lap ahead
+            Slot.Sequence.store(DequeuePos + Capacity, std::memory_order_release);
+            ++DequeuePos;
+            ++Drained;
+        }
+
+        Stats.LastDrained = Drained;
+        Stats.TotalDrained += Drained;
+        return Drained;
+    }
+
+    /** Events waiting (approximate while producers are active) */
+    int32 Num() const
+    {
+        return static_cast<int32>(EnqueuePos.load(std::memory_order_acquire) - DequeuePos);
+    }
+
+    int32 GetCapacity() const { return static_cast<int32>(Capacity); }
+
+    /** Counters, consistent from the game thread */
+    FRPGToolkitEventInboxStats GetStats() const;
+
+    /** Push the current counters to the STATGROUP_RPGEvents stats */
+    void PublishStats() const;
+
+private:
+    struct FSlot
+    {
+        std::atomic<uint64> Sequence{ 0 };
+        uint64 EnqueueCycles = 0;
+        int32 Length = 0;
+        uint8 Bytes[MaxEventBytes];
+    };
+
+    void RecordLatency(double LatencyMs);
+
+    TUniquePtr<FSlot[]> Slots;
+    uint64 Capacity;
+    uint64 Mask;
+
+    /** Next position to claim (producers) and to read (game thread), on separate cache lines */
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePos{ 0 };
+    alignas(PLATFORM_CACHE_LINE_SIZE) uint64 DequeuePos = 0;
+
+    /** Producer-side counters */
+    std::atomic<int64> Received{ 0 };
+    std::atomic<int64> DroppedFull{ 0 };
+    std::atomic<int64> DroppedOversize{ 0 };
+
+    /** Consumer-side counters (game thread) */
+    FRPGToolkitEventInboxStats Stats;
+    double TotalLatencyMs = 0.0;
+};
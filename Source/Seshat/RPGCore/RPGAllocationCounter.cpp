@@ -0,0 +1,142 @@
+#include "RPGAllocationCounter.h"
+
+#if RPG_WITH_ALLOCATION_COUNTER
+
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformAtomics.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    /** Innermost active counter on this thread */
+    thread_local FRPGAllocationCounter* ActiveCounter = nullptr;
+}
+
+/** Forwards everything to the real allocator, counting on threads with an active scope */
+class FRPGCountingMalloc final : public FMalloc
+{
+public:
+    explicit FRPGCountingMalloc(FMalloc* InInner)
+        : Inner(InInner)
+    {
+    }
+
+    virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+    {
+        Record(Count);
+        return Inner->Malloc(Count, Alignment);
+    }
+
+    virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+    {
+        Record(Count);
+        return Inner->TryMalloc(Count, Alignment);
+    }
+
+    virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+    {
+        RecordRealloc(Original, Count);
+        return Inner->Realloc(Original, Count, Alignment);
+    }
+
+    virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+    {
+        RecordRealloc(Original, Count);
+        return Inner->TryRealloc(Original, Count, Alignment);
+    }
+
+    virtual void Free(void* Original) override { Inner->Free(Original); }
+    virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+    virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+    virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+    virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+    virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+    virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+    virtual void UpdateStats() override { Inner->UpdateStats(); }
+    virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+    virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+    virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+    virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+    virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+    FMalloc* GetInner() const { return Inner; }
+
+private:
+    static void Record(SIZE_T Count)
+    {
+        if (FRPGAllocationCounter* Counter = ActiveCounter)
+        {
+            ++Counter->Allocations;
+            Counter->Bytes += static_cast<int64>(Count);
+        }
+    }
+
+    static void RecordRealloc(void* Original, SIZE_T Count)
+    {
+        // Realloc(nullptr) allocates, Realloc(ptr, 0) frees; anything else may move the block
+        if (Count > 0)
+        {
+            Record(Count);
+        }
+    }
+
+    FMalloc* Inner;
+};
+
+namespace
+{
+    FCriticalSection InstallLock;
+
+    /** Never freed: threads may hold the pointer for the rest of the process */
+    FRPGCountingMalloc* CountingMalloc = nullptr;
+
+    /** Live counters across all threads; the proxy is in front of GMalloc while this is non-zero */
+    int32 NumLiveCounters = 0;
+
+    void InstallCountingMalloc()
+    {
+        FScopeLock Lock(&InstallLock);
+        if (NumLiveCounters++ == 0 && GMalloc)
+        {
+            // A new proxy if something else has wrapped GMalloc since the last install
+            if (!CountingMalloc || CountingMalloc->GetInner() != GMalloc)
+            {
+                CountingMalloc = new FRPGCountingMalloc(GMalloc);
+            }
+            FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void**>(&GMalloc), CountingMalloc);
+        }
+    }
+
+    void UninstallCountingMalloc()
+    {
+        FScopeLock Lock(&InstallLock);
+        if (--NumLiveCounters == 0 && CountingMalloc && GMalloc == CountingMalloc)
+        {
+            // Blocks allocated through the proxy came from the inner allocator, so they free the same way
+            FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void**>(&GMalloc), CountingMalloc->GetInner());
+        }
+    }
+}
+
+FRPGAllocationCounter::FRPGAllocationCounter()
+{
+    InstallCountingMalloc();
+    Outer = ActiveCounter;
+    ActiveCounter = this;
+}
+
+FRPGAllocationCounter::~FRPGAllocationCounter()
+{
+    ActiveCounter = Outer;
+
+    // Nested scopes also count toward the enclosing one
+    if (Outer)
+    {
+        Outer->Allocations += Allocations;
+        Outer->Bytes += Bytes;
+    }
+
+    UninstallCountingMalloc();
+}
+
+#endif // RPG_WITH_ALLOCATION_COUNTER
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Allocation counting is a development tool; shipping builds never touch GMalloc */
+#define RPG_WITH_ALLOCATION_COUNTER !UE_BUILD_SHIPPING
+
+#if RPG_WITH_ALLOCATION_COUNTER
+
+/**
+ * Scoped heap allocation counter for benchmarks
+ * Counts Malloc/Realloc calls made through GMalloc by the calling thread while the scope is alive.
+ * While any counter is alive, a forwarding proxy sits in front of GMalloc; the last counter to go puts
+ * the real allocator back. The proxy object itself is kept (and reused) because other threads may still
+ * be inside a call through it.
+ * Only meant for benchmarks - never for shipping code paths.
+ */
+class SESHAT_API FRPGAllocationCounter
+{
+public:
+    FRPGAllocationCounter();
+    ~FRPGAllocationCounter();
+
+    FRPGAllocationCounter(const FRPGAllocationCounter&) = delete;
+    FRPGAllocationCounter& operator=(const FRPGAllocationCounter&) = delete;
+
+    /** Allocations (Malloc, plus Realloc calls that grow or create a block) so far */
+    int64 GetAllocations() const { return Allocations; }
+
+    /** Bytes requested by those allocations */
+    int64 GetBytes() const { return Bytes; }
+
+private:
+    friend class FRPGCountingMalloc;
+
+    int64 Allocations = 0;
+    int64 Bytes = 0;
+
+    /** Enclosing counter on this thread, restored on destruction */
+    FRPGAllocationCounter* Outer = nullptr;
+};
+
+#endif // RPG_WITH_ALLOCATION_COUNTER
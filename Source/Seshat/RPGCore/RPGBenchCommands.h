@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "HAL/IConsoleManager.h"
+
+/**
+ * Helpers for the rpg.Bench.* console commands that run the subsystem benchmarks and self-checks
+ * The benchmarks are development tools and are not compiled into shipping builds.
+ */
+namespace RPGBench
+{
+    /** Subsystem of the game instance the command ran in; null (with a note in Ar) outside a game world */
+    template <typename SubsystemType>
+    SubsystemType* FindSubsystem(UWorld* World, FOutputDevice& Ar)
+    {
+        UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+        SubsystemType* Subsystem = GameInstance ? GameInstance->GetSubsystem<SubsystemType>() : nullptr;
+        if (!Subsystem)
+        {
+            Ar.Logf(TEXT("%s is not running - start PIE or a game first"), *SubsystemType::StaticClass()->GetName());
+        }
+        return Subsystem;
+    }
+
+    /** Argument Index as an integer, or Default when it was not given */
+    inline int32 IntArg(const TArray<FString>& Args, int32 Index, int32 Default)
+    {
+        return Args.IsValidIndex(Index) ? FCString::Atoi(*Args[Index]) : Default;
+    }
+
+    inline int64 Int64Arg(const TArray<FString>& Args, int32 Index, int64 Default)
+    {
+        return Args.IsValidIndex(Index) ? FCString::Atoi64(*Args[Index]) : Default;
+    }
+
+    inline float FloatArg(const TArray<FString>& Args, int32 Index, float Default)
+    {
+        return Args.IsValidIndex(Index) ? FCString::Atof(*Args[Index]) : Default;
+    }
+
+    inline FString StringArg(const TArray<FString>& Args, int32 Index, const TCHAR* Default)
+    {
+        return Args.IsValidIndex(Index) ? Args[Index] : FString(Default);
+    }
+}
+
+#endif
@@ -1,4 +1,223 @@
 #include "RPGCoreTypes.h"
+#include "Misc/ScopeRWLock.h"
+#include "Misc/StringBuilder.h"
+#include "Serialization/Archive.h"
+
+namespace
+{
+    /** Interned IDs are A = 'RPGI', B = C = 0, D = table index + 1 */
+    constexpr uint32 InternedMarker = 0x49475052;
+
+    /** Interned strings are never released, so the table stops growing here rather than leaking for the session */
+    constexpr int32 MaxInternedEntityIds = 65536;
+
+    bool IsInterned(const FGuid& Value)
+    {
+        return Value.A == InternedMarker && Value.B == 0 && Value.C == 0 && Value.D != 0;
+    }
+
+    int32 HexDigit(TCHAR Char)
+    {
+        if (Char >= TEXT('0') && Char <= TEXT('9'))
+        {
+            return Char - TEXT('0');
+        }
+        if (Char >= TEXT('A') && Char <= TEXT('F'))
+        {
+            return Char - TEXT('A') + 10;
+        }
+        return INDEX_NONE;
+    }
+
+    /** Only the exact FGuid::ToString() form - anything else must round-trip through the intern table */
+    bool ParseCanonicalGuid(FStringView Text, FGuid& OutGuid)
+    {
+        if (Text.Len() != 32)
+        {
+            return false;
+        }
+
+        uint32 Words[4];
+        for (int32 Word = 0; Word < 4; ++Word)
+        {
+            uint32 Bits = 0;
+            for (int32 Digit = 0; Digit < 8; ++Digit)
+            {
+                const int32 Nibble = HexDigit(Text[Word * 8 + Digit]);
+                if (Nibble == INDEX_NONE)
+                {
+                    return false;
+                }
+                Bits = (Bits << 4) | static_cast<uint32>(Nibble);
+            }
+            Words[Word] = Bits;
+        }
+
+        OutGuid = FGuid(Words[0], Words[1], Words[2], Words[3]);
+        return true;
+    }
+
+    /** Case-sensitive like the toolkit, and probed with string views so lookups never allocate */
+    struct FInternedKeyFuncs : TDefaultMapHashableKeyFuncs<FString, uint32, false>
+    {
+        static FORCEINLINE bool Matches(const FString& A, const FString& B)
+        {
+            return A.Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static FORCEINLINE bool Matches(const FString& A, FStringView B)
+        {
+            return FStringView(A).Equals(B, ESearchCase::CaseSensitive);
+        }
+
+        static FORCEINLINE uint32 GetKeyHash(const FString& Key)
+        {
+            return GetViewHash(Key);
+        }
+
+        static FORCEINLINE uint32 GetViewHash(FStringView Key)
+        {
+            return FCrc::MemCrc32(Key.GetData(), Key.Len() * sizeof(TCHAR));
+        }
+    };
+
+    struct FInternedEntityIds
+    {
+        FRWLock Lock;
+        TArray<FString> Strings;
+        TMap<FString, uint32, FDefaultSetAllocator, FInternedKeyFuncs> Indices;
+    };
+
+    FInternedEntityIds& GetInternedEntityIds()
+    {
+        static FInternedEntityIds Table;
+        return Table;
+    }
+
+    FRPGEntityId ConvertEntityId(FStringView Text, bool bIntern)
+    {
+        if (Text.IsEmpty())
+        {
+            return FRPGEntityId();
+        }
+
+        FGuid Guid;
+        if (ParseCanonicalGuid(Text, Guid) && !IsInterned(Guid))
+        {
+            return FRPGEntityId(Guid);
+        }
+
+        FInternedEntityIds& Table = GetInternedEntityIds();
+        const uint32 Hash = FInternedKeyFuncs::GetViewHash(Text);
+        {
+            FReadScopeLock ReadLock(Table.Lock);
+            if (const uint32* Index = Table.Indices.FindByHash(Hash, Text))
+            {
+                return FRPGEntityId(FGuid(InternedMarker, 0, 0, *Index + 1));
+            }
+        }
+
+        if (!bIntern)
+        {
+            return FRPGEntityId();
+        }
+
+        FWriteScopeLock WriteLock(Table.Lock);
+        if (const uint32* Index = Table.Indices.FindByHash(Hash, Text))
+        {
+            return FRPGEntityId(FGuid(InternedMarker, 0, 0, *Index + 1));
+        }
+
+        if (Table.Strings.Num() >= MaxInternedEntityIds)
+        {
+            static bool bWarned = false;
+            if (!bWarned)
+            {
+                bWarned = true;
+                UE_LOG(LogTemp, Warning, TEXT("FRPGEntityId: intern table is full (%d IDs) - non-GUID entity IDs such as '%.*s' are rejected; use GUID IDs"),
+                    MaxInternedEntityIds, Text.Len(), Text.GetData());
+            }
+            return FRPGEntityId();
+        }
+
+        const uint32 Index = static_cast<uint32>(Table.Strings.Emplace(Text));
+        Table.Indices.AddByHash(Hash, Table.Strings[Index], Index);
+        return FRPGEntityId(FGuid(InternedMarker, 0, 0, Index + 1));
+    }
+}
+
+FRPGEntityId FRPGEntityId::NewId()
+{
+    FGuid Guid = FGuid::NewGuid();
+    if (IsInterned(Guid))
+    {
+        // Keep random IDs out of the interned range
+        Guid.B = 1;
+    }
+    return FRPGEntityId(Guid);
+}
+
+FRPGEntityId FRPGEntityId::FromString(FStringView Text)
+{
+    return ConvertEntityId(Text, true);
+}
+
+FRPGEntityId FRPGEntityId::Find(FStringView Text)
+{
+    return ConvertEntityId(Text, false);
+}
+
+FString FRPGEntityId::ToString() const
+{
+    if (IsInterned(Value))
+    {
+        FInternedEntityIds& Table = GetInternedEntityIds();
+        FReadScopeLock ReadLock(Table.Lock);
+        return Table.Strings.IsValidIndex(Value.D - 1) ? Table.Strings[Value.D - 1] : FString();
+    }
+    return IsValid() ? Value.ToString() : FString();
+}
+
+void FRPGEntityId::AppendString(FStringBuilderBase& Out) const
+{
+    if (IsInterned(Value))
+    {
+        FInternedEntityIds& Table = GetInternedEntityIds();
+        FReadScopeLock ReadLock(Table.Lock);
+        if (Table.Strings.IsValidIndex(Value.D - 1))
+        {
+            Out << Table.Strings[Value.D - 1];
+        }
+    }
+    else if (IsValid())
+    {
+        Out.Appendf(TEXT("%08X%08X%08X%08X"), Value.A, Value.B, Value.C, Value.D);
+    }
+}
+
+bool FRPGEntityId::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    // Interned indices differ between processes, so those travel as their string
+    uint8 bInterned = IsInterned(Value) ? 1 : 0;
+    Ar.SerializeBits(&bInterned, 1);
+
+    if (bInterned)
+    {
+        FString Text = Ar.IsSaving() ? ToString() : FString();
+        Ar << Text;
+        if (Ar.IsLoading())
+        {
+            *this = FromString(Text);
+        }
+    }
+    else
+    {
+        Ar << Value.A << Value.B << Value.C << Value.D;
+    }
+
+    bOutSuccess = !Ar.IsError();
+    return true;
+}
 
 FString FRPGEntityError::GetFormattedMessage() const
 {
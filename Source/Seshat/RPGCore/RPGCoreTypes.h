@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/Engine.h"
+#include "Misc/Guid.h"
 #include "RPGCoreTypes.generated.h"
 
 /**
@@ -88,6 +89,107 @@ struct SESHAT_API FRPGEntityValidationResult
     FRPGEntityError Error;
 };
 
+/**
+ * Compact 128-bit entity identifier - hashing, comparing and copying never allocate
+ * Generated IDs are random GUIDs whose toolkit string form is the 32-digit uppercase hex GUID
+ * (FGuid::ToString()). Any other ID string, such as "goblin-01" typed into the editor, is interned in a
+ * process-wide case-sensitive table so it still round-trips (entries are never released and the table is
+ * capped, so bulk or generated IDs should be GUIDs); interned values are only meaningful within
+ * one process, so persist the string form. Strings are built only at the toolkit and network edges.
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGEntityId
+{
+    GENERATED_BODY()
+
+    FRPGEntityId() = default;
+
+    explicit FRPGEntityId(const FGuid& InValue)
+        : Value(InValue)
+    {
+    }
+
+    /** A new random ID */
+    static FRPGEntityId NewId();
+
+    /** ID for a toolkit string, interning non-GUID strings; invalid for an empty string or once the intern table is full */
+    static FRPGEntityId FromString(FStringView Text);
+
+    /** FromString without interning - invalid for a non-GUID string that was never converted before */
+    static FRPGEntityId Find(FStringView Text);
+
+    /** Toolkit string form */
+    FString ToString() const;
+    void AppendString(FStringBuilderBase& Out) const;
+
+    bool IsValid() const { return Value.IsValid(); }
+
+    /** Network edge: GUID IDs as 16 bytes, interned IDs as their string */
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+    bool operator==(const FRPGEntityId& Other) const { return Value == Other.Value; }
+    bool operator!=(const FRPGEntityId& Other) const { return Value != Other.Value; }
+
+    friend uint32 GetTypeHash(const FRPGEntityId& Id)
+    {
+        return HashCombineFast(Id.Value.A ^ Id.Value.C, Id.Value.B ^ Id.Value.D);
+    }
+
+    UPROPERTY(BlueprintReadOnly, Category = "RPG Entity")
+    FGuid Value;
+};
+
+template<>
+struct TStructOpsTypeTraits<FRPGEntityId> : public TStructOpsTypeTraitsBase2<FRPGEntityId>
+{
+    enum
+    {
+        WithNetSerializer = true,
+        WithIdenticalViaEquality = true
+    };
+};
+
+/**
+ * Generation-checked handle to an entity in the URPGEntitySubsystem registry
+ * Low 32 bits: slot index, high 32 bits: slot generation (never 0 for a live handle)
+ * A handle to an unregistered entity stays invalid even after its slot is reused
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGEntityHandle
+{
+    GENERATED_BODY()
+
+    FRPGEntityHandle() = default;
+
+    FRPGEntityHandle(uint32 InSlot, uint32 InGeneration)
+        : Value(static_cast<int64>((static_cast<uint64>(InGeneration) << 32) | InSlot))
+    {
+    }
+
+    UPROPERTY(BlueprintReadOnly, Category = "RPG Entity")
+    int64 Value = 0;
+
+    bool IsValid() const { return Value != 0; }
+    uint32 GetSlot() const { return static_cast<uint32>(static_cast<uint64>(Value)); }
+    uint32 GetGeneration() const { return static_cast<uint32>(static_cast<uint64>(Value) >> 32); }
+
+    bool operator==(const FRPGEntityHandle& Other) const { return Value == Other.Value; }
+    bool operator!=(const FRPGEntityHandle& Other) const { return Value != Other.Value; }
+
+    friend uint32 GetTypeHash(const FRPGEntityHandle& Handle) { return ::GetTypeHash(Handle.Value); }
+};
+
+/**
+ * Cell layout of the entity subsystem's spatial grid (rpg-toolkit's square and hex grids)
+ * Square grids count diagonal steps as one move; hex grids are pointy-top, addressed in odd-row offset coordinates
+ */
+UENUM(BlueprintType)
+enum class ERPGGridShape : uint8
+{
+    Square      UMETA(DisplayName = "Square"),
+    Hex         UMETA(DisplayName = "Hex")
+};
+
 // Common entity types as constants
 namespace RPGEntityTypes
 {
@@ -0,0 +1,319 @@
+#include "RPGSpatialIndex.h"
+
+namespace
+{
+    /** Vertical spacing of pointy-top hex rows when adjacent centers are 1 apart */
+    constexpr double HexRowSpacing = UE_DOUBLE_SQRT_3 / 2.0;
+
+    /** Odd-row offset -> axial (q, r); cube s is -q - r */
+    FIntPoint OffsetToAxial(FIntPoint Cell)
+    {
+        return FIntPoint(Cell.X - (Cell.Y - (Cell.Y & 1)) / 2, Cell.Y);
+    }
+
+    FIntPoint AxialToOffset(int32 Q, int32 R)
+    {
+        return FIntPoint(Q + (R - (R & 1)) / 2, R);
+    }
+
+    /** Nearest hex to fractional axial coordinates (cube rounding) */
+    FIntPoint RoundAxialToOffset(double Q, double R)
+    {
+        const double S = -Q - R;
+        double RoundedQ = FMath::RoundHalfFromZero(Q);
+        double RoundedR = FMath::RoundHalfFromZero(R);
+        const double RoundedS = FMath::RoundHalfFromZero(S);
+
+        // Fix the component that moved furthest so the three still sum to zero
+        const double DiffQ = FMath::Abs(RoundedQ - Q);
+        const double DiffR = FMath::Abs(RoundedR - R);
+        const double DiffS = FMath::Abs(RoundedS - S);
+        if (DiffQ > DiffR && DiffQ > DiffS)
+        {
+            RoundedQ = -RoundedR - RoundedS;
+        }
+        else if (DiffR > DiffS)
+        {
+            RoundedR = -RoundedQ - RoundedS;
+        }
+        return AxialToOffset(static_cast<int32>(RoundedQ), static_cast<int32>(RoundedR));
+    }
+}
+
+FRPGSpatialIndex::FRPGSpatialIndex(ERPGGridShape InShape, int32 InWidth, int32 InHeight, int32 InBucketSize)
+    : Shape(InShape)
+    , Width(FMath::Max(InWidth, 0))
+    , Height(FMath::Max(InHeight, 0))
+    , BucketSize(FMath::Max(InBucketSize, 1))
+{
+    BucketsX = FMath::DivideAndRoundUp(Width, BucketSize);
+    Buckets.SetNum(BucketsX * FMath::DivideAndRoundUp(Height, BucketSize));
+}
+
+template <typename FunctorType>
+void FRPGSpatialIndex::ForEachItemInRect(FIntPoint Min, FIntPoint Max, FunctorType&& Functor) const
+{
+    Min.X = FMath::Max(Min.X, 0);
+    Min.Y = FMath::Max(Min.Y, 0);
+    Max.X = FMath::Min(Max.X, Width - 1);
+    Max.Y = FMath::Min(Max.Y, Height - 1);
+    if (Min.X > Max.X || Min.Y > Max.Y)
+    {
+        return;
+    }
+
+    for (int32 BucketY = Min.Y / BucketSize; BucketY <= Max.Y / BucketSize; ++BucketY)
+    {
+        for (int32 BucketX = Min.X / BucketSize; BucketX <= Max.X / BucketSize; ++BucketX)
+        {
+            for (const FItem& Item : Buckets[BucketY * BucketsX + BucketX])
+            {
+                // Edge buckets straddle the rectangle
+                if (Item.Cell.X >= Min.X && Item.Cell.X <= Max.X && Item.Cell.Y >= Min.Y && Item.Cell.Y <= Max.Y)
+                {
+                    Functor(Item);
+                }
+            }
+        }
+    }
+}
+
+bool FRPGSpatialIndex::Place(FRPGEntityHandle Handle, FIntPoint Cell)
+{
+    if (!Handle.IsValid() || !IsInBounds(Cell))
+    {
+        return false;
+    }
+
+    const uint32 Slot = Handle.GetSlot();
+    if (Slot >= static_cast<uint32>(Locations.Num()))
+    {
+        Locations.SetNum(Slot + 1);
+    }
+
+    const int32 Bucket = GetBucketIndex(Cell);
+    if (Locations[Slot].Bucket == INDEX_NONE)
+    {
+        ++NumEntities;
+    }
+    else if (Locations[Slot].Generation == Handle.GetGeneration() && Locations[Slot].Bucket == Bucket)
+    {
+        // Still in the same bucket - the common single-step move
+        Buckets[Bucket][Locations[Slot].Index].Cell = Cell;
+        return true;
+    }
+    else
+    {
+        // Another bucket, or a stale entity whose slot has been reused - replaced either way
+        RemoveFromBucket(Locations[Slot].Bucket, Locations[Slot].Index);
+    }
+
+    FLocation& Location = Locations[Slot];
+    Location.Bucket = Bucket;
+    Location.Index = Buckets[Bucket].Add({ Cell, Handle });
+    Location.Generation = Handle.GetGeneration();
+    return true;
+}
+
+bool FRPGSpatialIndex::Remove(FRPGEntityHandle Handle)
+{
+    FLocation* Location = FindLocation(Handle);
+    if (!Location)
+    {
+        return false;
+    }
+
+    RemoveFromBucket(Location->Bucket, Location->Index);
+    Location->Bucket = INDEX_NONE;
+    Location->Index = INDEX_NONE;
+    --NumEntities;
+    return true;
+}
+
+bool FRPGSpatialIndex::GetCell(FRPGEntityHandle Handle, FIntPoint& OutCell) const
+{
+    const FLocation* Location = FindLocation(Handle);
+    if (!Location)
+    {
+        return false;
+    }
+
+    OutCell = Buckets[Location->Bucket][Location->Index].Cell;
+    return true;
+}
+
+int32 FRPGSpatialIndex::GetDistance(FIntPoint A, FIntPoint B) const
+{
+    if (Shape == ERPGGridShape::Hex)
+    {
+        const FIntPoint AxialA = OffsetToAxial(A);
+        const FIntPoint AxialB = OffsetToAxial(B);
+        const int32 DeltaQ = AxialA.X - AxialB.X;
+        const int32 DeltaR = AxialA.Y - AxialB.Y;
+        return (FMath::Abs(DeltaQ) + FMath::Abs(DeltaR) + FMath::Abs(DeltaQ + DeltaR)) / 2;
+    }
+
+    return FMath::Max(FMath::Abs(A.X - B.X), FMath::Abs(A.Y - B.Y));
+}
+
+FVector2D FRPGSpatialIndex::GetCellCenter(FIntPoint Cell) const
+{
+    if (Shape == ERPGGridShape::Hex)
+    {
+        return FVector2D(Cell.X + 0.5 * (Cell.Y & 1), Cell.Y * HexRowSpacing);
+    }
+
+    return FVector2D(Cell.X + 0.5, Cell.Y + 0.5);
+}
+
+FIntPoint FRPGSpatialIndex::GetCellAt(FVector2D Point) const
+{
+    if (Shape == ERPGGridShape::Hex)
+    {
+        const double R = Point.Y / HexRowSpacing;
+        return RoundAxialToOffset(Point.X - R / 2.0, R);
+    }
+
+    return FIntPoint(FMath::FloorToInt32(Point.X), FMath::FloorToInt32(Point.Y));
+}
+
+void FRPGSpatialIndex::QueryRadius(FIntPoint Center, int32 Radius, TArray<FRPGEntityHandle>& OutEntities) const
+{
+    if (Radius < 0)
+    {
+        return;
+    }
+
+    // Both grids fit a radius inside a (2 * Radius + 1) square of offset cells
+    ForEachItemInRect(FIntPoint(Center.X - Radius, Center.Y - Radius), FIntPoint(Center.X + Radius, Center.Y + Radius),
+        [this, Center, Radius, &OutEntities](const FItem& Item)
+        {
+            if (GetDistance(Center, Item.Cell) <= Radius)
+            {
+                OutEntities.Add(Item.Handle);
+            }
+        });
+}
+
+void FRPGSpatialIndex::QueryCone(FIntPoint Origin, FVector2D Direction, int32 Length, float HalfAngleDegrees, TArray<FRPGEntityHandle>& OutEntities) const
+{
+    const FVector2D Axis = Direction.GetSafeNormal();
+    if (Length <= 0 || Axis.IsZero())
+    {
+        return;
+    }
+
+    const double MinCosine = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp<double>(HalfAngleDegrees, 0.0, 180.0)));
+    const FVector2D OriginCenter = GetCellCenter(Origin);
+    ForEachItemInRect(FIntPoint(Origin.X - Length, Origin.Y - Length), FIntPoint(Origin.X + Length, Origin.Y + Length),
+        [this, Origin, Length, MinCosine, &OriginCenter, &Axis, &OutEntities](const FItem& Item)
+        {
+            if (Item.Cell == Origin || GetDistance(Origin, Item.Cell) > Length)
+            {
+                return;
+            }
+
+            const FVector2D ToCell = (GetCellCenter(Item.Cell) - OriginCenter).GetSafeNormal();
+            if (FVector2D::DotProduct(ToCell, Axis) >= MinCosine)
+            {
+                OutEntities.Add(Item.Handle);
+            }
+        });
+}
+
+void FRPGSpatialIndex::QueryLine(FIntPoint From, FIntPoint To, TArray<FRPGEntityHandle>& OutEntities) const
+{
+    TArray<FIntPoint> Cells;
+    GetLineCells(From, To, Cells);
+
+    // Each cell is on the line once, so every entity is found at most once
+    for (const FIntPoint& Cell : Cells)
+    {
+        if (!IsInBounds(Cell))
+        {
+            continue;
+        }
+
+        for (const FItem& Item : Buckets[GetBucketIndex(Cell)])
+        {
+            if (Item.Cell == Cell)
+            {
+                OutEntities.Add(Item.Handle);
+            }
+        }
+    }
+}
+
+void FRPGSpatialIndex::GetLineCells(FIntPoint From, FIntPoint To, TArray<FIntPoint>& OutCells) const
+{
+    const int32 Steps = GetDistance(From, To);
+    OutCells.Reset(Steps + 1);
+    if (Steps == 0)
+    {
+        OutCells.Add(From);
+        return;
+    }
+
+    if (Shape == ERPGGridShape::Hex)
+    {
+        // Lerp in cube space; the nudge keeps samples off hex edges so ties round the same way every time
+        const FIntPoint AxialFrom = OffsetToAxial(From);
+        const FIntPoint AxialTo = OffsetToAxial(To);
+        const double FromQ = AxialFrom.X + 1e-6;
+        const double FromR = AxialFrom.Y + 2e-6;
+        const double ToQ = AxialTo.X + 1e-6;
+        const double ToR = AxialTo.Y + 2e-6;
+        for (int32 Step = 0; Step <= Steps; ++Step)
+        {
+            const double Alpha = static_cast<double>(Step) / Steps;
+            OutCells.Add(RoundAxialToOffset(FMath::Lerp(FromQ, ToQ, Alpha), FMath::Lerp(FromR, ToR, Alpha)));
+        }
+        return;
+    }
+
+    for (int32 Step = 0; Step <= Steps; ++Step)
+    {
+        const double Alpha = static_cast<double>(Step) / Steps;
+        OutCells.Add(FIntPoint(
+            FMath::RoundToInt32(FMath::Lerp<double>(From.X, To.X, Alpha)),
+            FMath::RoundToInt32(FMath::Lerp<double>(From.Y, To.Y, Alpha))));
+    }
+}
+
+void FRPGSpatialIndex::Reset()
+{
+    for (TArray<FItem>& Bucket : Buckets)
+    {
+        Bucket.Reset();
+    }
+    Locations.Reset();
+    NumEntities = 0;
+}
+
+FRPGSpatialIndex::FLocation* FRPGSpatialIndex::FindLocation(FRPGEntityHandle Handle)
+{
+    return const_cast<FLocation*>(static_cast<const FRPGSpatialIndex*>(this)->FindLocation(Handle));
+}
+
+const FRPGSpatialIndex::FLocation* FRPGSpatialIndex::FindLocation(FRPGEntityHandle Handle) const
+{
+    const uint32 Slot = Handle.GetSlot();
+    if (!Handle.IsValid() || Slot >= static_cast<uint32>(Locations.Num()))
+    {
+        return nullptr;
+    }
+
+    const FLocation& Location = Locations[Slot];
+    return Location.Bucket != INDEX_NONE && Location.Generation == Handle.GetGeneration() ? &Location : nullptr;
+}
+
+void FRPGSpatialIndex::RemoveFromBucket(int32 Bucket, int32 Index)
+{
+    TArray<FItem>& Items = Buckets[Bucket];
+    const int32 LastIndex = Items.Num() - 1;
+    if (Index != LastIndex)
+    {
+        Locations[Items[LastIndex].Handle.GetSlot()].Index = Index;
+    }
+    Items.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
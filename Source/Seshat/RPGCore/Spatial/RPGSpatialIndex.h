@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../RPGCoreTypes.h"
+
+/**
+ * Cell-bucketed spatial index of entities on a Width x Height tactical grid
+ * Cells are grouped into BucketSize x BucketSize buckets, each holding a packed (cell, handle) list of the
+ * entities inside it, so range queries only visit the buckets overlapping their bounds rather than every
+ * entity. Entities are addressed by registry handle: a move within a bucket is an in-place write, a move
+ * across buckets is one swap-remove and one append.
+ *
+ * Square grids measure Chebyshev distance; hex grids are pointy-top in odd-row offset coordinates and
+ * measure cube distance. Game thread only.
+ */
+class SESHAT_API FRPGSpatialIndex
+{
+public:
+    FRPGSpatialIndex(ERPGGridShape InShape = ERPGGridShape::Square, int32 InWidth = 0, int32 InHeight = 0, int32 InBucketSize = 8);
+
+    ERPGGridShape GetShape() const { return Shape; }
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+
+    bool IsInBounds(FIntPoint Cell) const { return Cell.X >= 0 && Cell.Y >= 0 && Cell.X < Width && Cell.Y < Height; }
+
+    /** Put an entity on Cell, moving it if it is already on the grid; false if Cell is off the map */
+    bool Place(FRPGEntityHandle Handle, FIntPoint Cell);
+
+    /** Take an entity off the grid; false if it was not on it */
+    bool Remove(FRPGEntityHandle Handle);
+
+    /** Cell an entity is on; false if it is not on the grid */
+    bool GetCell(FRPGEntityHandle Handle, FIntPoint& OutCell) const;
+
+    int32 Num() const { return NumEntities; }
+
+    /** Moves between two cells, ignoring obstacles */
+    int32 GetDistance(FIntPoint A, FIntPoint B) const;
+
+    /** Cell center in cell units (adjacent centers along a row are 1 apart on both grids) */
+    FVector2D GetCellCenter(FIntPoint Cell) const;
+
+    /** Cell containing a point in cell units (not clamped to the map) */
+    FIntPoint GetCellAt(FVector2D Point) const;
+
+    /** Entities within Radius moves of Center, Center included */
+    void QueryRadius(FIntPoint Center, int32 Radius, TArray<FRPGEntityHandle>& OutEntities) const;
+
+    /**
+     * Entities within Length moves of Origin whose cell center is within HalfAngleDegrees of Direction
+     * The origin cell (where the caster stands) is excluded
+     */
+    void QueryCone(FIntPoint Origin, FVector2D Direction, int32 Length, float HalfAngleDegrees, TArray<FRPGEntityHandle>& OutEntities) const;
+
+    /** Entities on the cells of the line From -> To, both ends included */
+    void QueryLine(FIntPoint From, FIntPoint To, TArray<FRPGEntityHandle>& OutEntities) const;
+
+    /** Cells of the line From -> To, one per move */
+    void GetLineCells(FIntPoint From, FIntPoint To, TArray<FIntPoint>& OutCells) const;
+
+    /** Take every entity off the grid (the map size is kept) */
+    void Reset();
+
+private:
+    struct FItem
+    {
+        FIntPoint Cell;
+        FRPGEntityHandle Handle;
+    };
+
+    /** Where a handle slot's item lives; Bucket is INDEX_NONE while the slot is off the grid */
+    struct FLocation
+    {
+        int32 Bucket = INDEX_NONE;
+        int32 Index = INDEX_NONE;
+        uint32 Generation = 0;
+    };
+
+    int32 GetBucketIndex(FIntPoint Cell) const { return (Cell.Y / BucketSize) * BucketsX + Cell.X / BucketSize; }
+
+    /** Location of a live handle, null if it is off the grid or stale */
+    FLocation* FindLocation(FRPGEntityHandle Handle);
+    const FLocation* FindLocation(FRPGEntityHandle Handle) const;
+
+    void RemoveFromBucket(int32 Bucket, int32 Index);
+
+    /** Call Functor for every item inside the inclusive cell rectangle Min..Max (clamped to the map) */
+    template <typename FunctorType>
+    void ForEachItemInRect(FIntPoint Min, FIntPoint Max, FunctorType&& Functor) const;
+
+    ERPGGridShape Shape;
+    int32 Width;
+    int32 Height;
+    int32 BucketSize;
+    int32 BucketsX;
+    int32 NumEntities = 0;
+
+    TArray<TArray<FItem>> Buckets;
+
+    /** Indexed by handle slot, like the registry's sparse arrays */
+    TArray<FLocation> Locations;
+};
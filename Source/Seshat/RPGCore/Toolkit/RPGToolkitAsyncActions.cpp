@@ -0,0 +1,147 @@
+#include "RPGToolkitAsyncActions.h"
+#include "RPGCore/Events/RPGEventBusSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+namespace
+{
+    /** Game-instance subsystem for a Blueprint world context, or nullptr */
+    template<typename SubsystemType>
+    SubsystemType* FindSubsystem(UObject* WorldContextObject)
+    {
+        UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+        UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+        return GameInstance ? GameInstance->GetSubsystem<SubsystemType>() : nullptr;
+    }
+}
+
+// Create Character Async
+URPGCreateCharacterAsyncAction* URPGCreateCharacterAsyncAction::CreateCharacterAsync(
+    UObject* WorldContextObject,
+    const FString& RaceDataJSON,
+    const FString& ClassDataJSON,
+    const FString& BackgroundDataJSON,
+    const FString& CharacterName,
+    int32 Strength, int32 Dexterity, int32 Constitution,
+    int32 Intelligence, int32 Wisdom, int32 Charisma)
+{
+    URPGCreateCharacterAsyncAction* Action = NewObject<URPGCreateCharacterAsyncAction>();
+    Action->Subsystem = FindSubsystem<URPGCharacterSubsystem>(WorldContextObject);
+    Action->RaceDataJSON = RaceDataJSON;
+    Action->ClassDataJSON = ClassDataJSON;
+    Action->BackgroundDataJSON = BackgroundDataJSON;
+    Action->CharacterName = CharacterName;
+    Action->AbilityScores[0] = Strength;
+    Action->AbilityScores[1] = Dexterity;
+    Action->AbilityScores[2] = Constitution;
+    Action->AbilityScores[3] = Intelligence;
+    Action->AbilityScores[4] = Wisdom;
+    Action->AbilityScores[5] = Charisma;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void URPGCreateCharacterAsyncAction::Activate()
+{
+    URPGCharacterSubsystem* CharacterSubsystem = Subsystem.Get();
+    if (!CharacterSubsystem)
+    {
+        Complete(FCharacterResult(TEXT("Character subsystem not available")));
+        return;
+    }
+
+    CharacterSubsystem->CreateCharacterAsync(RaceDataJSON, ClassDataJSON, BackgroundDataJSON, CharacterName,
+        AbilityScores[0], AbilityScores[1], AbilityScores[2], AbilityScores[3], AbilityScores[4], AbilityScores[5],
+        [WeakThis = TWeakObjectPtr<URPGCreateCharacterAsyncAction>(this)](FCharacterResult Result)
+        {
+            if (URPGCreateCharacterAsyncAction* Action = WeakThis.Get())
+            {
+                Action->Complete(Result);
+            }
+        });
+}
+
+void URPGCreateCharacterAsyncAction::Complete(const FCharacterResult& Result)
+{
+    OnCompleted.Broadcast(Result);
+    SetReadyToDestroy();
+}
+
+// Roll Dice Async
+URPGRollDiceAsyncAction* URPGRollDiceAsyncAction::RollDiceAsync(UObject* WorldContextObject, int32 Count, int32 Size, bool bBatchPerFrame)
+{
+    URPGRollDiceAsyncAction* Action = NewObject<URPGRollDiceAsyncAction>();
+    Action->Subsystem = FindSubsystem<URPGDiceSubsystem>(WorldContextObject);
+    Action->Count = Count;
+    Action->Size = Size;
+    Action->bBatchPerFrame = bBatchPerFrame;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void URPGRollDiceAsyncAction::Activate()
+{
+    URPGDiceSubsystem* DiceSubsystem = Subsystem.Get();
+    if (!DiceSubsystem)
+    {
+        Complete(FRollResult(TEXT("Dice subsystem not available")));
+        return;
+    }
+
+    DiceSubsystem->RollDiceAsync(Count, Size,
+        [WeakThis = TWeakObjectPtr<URPGRollDiceAsyncAction>(this)](FRollResult Result)
+        {
+            if (URPGRollDiceAsyncAction* Action = WeakThis.Get())
+            {
+                Action->Complete(Result);
+            }
+        },
+        bBatchPerFrame);
+}
+
+void URPGRollDiceAsyncAction::Complete(const FRollResult& Result)
+{
+    OnCompleted.Broadcast(Result);
+    SetReadyToDestroy();
+}
+
+// Publish Event Async
+URPGPublishEventAsyncAction* URPGPublishEventAsyncAction::PublishEventAsync(UObject* WorldContextObject, const FString& EventType, const FString& SourceID, const FString& TargetID, const FString& ContextData, bool bBatchPerFrame)
+{
+    URPGPublishEventAsyncAction* Action = NewObject<URPGPublishEventAsyncAction>();
+    Action->Subsystem = FindSubsystem<URPGEventBusSubsystem>(WorldContextObject);
+    Action->EventType = EventType;
+    Action->SourceID = SourceID;
+    Action->TargetID = TargetID;
+    Action->ContextData = ContextData;
+    Action->bBatchPerFrame = bBatchPerFrame;
+    Action->RegisterWithGameInstance(WorldContextObject);
+    return Action;
+}
+
+void URPGPublishEventAsyncAction::Activate()
+{
+    URPGEventBusSubsystem* EventBus = Subsystem.Get();
+    if (!EventBus)
+    {
+        Complete(false);
+        return;
+    }
+
+    EventBus->PublishEventAsync(EventType, SourceID, TargetID, ContextData,
+        [WeakThis = TWeakObjectPtr<URPGPublishEventAsyncAction>(this)](bool bSuccess)
+        {
+            if (URPGPublishEventAsyncAction* Action = WeakThis.Get())
+            {
+                Action->Complete(bSuccess);
+            }
+        },
+        bBatchPerFrame);
+}
+
+void URPGPublishEventAsyncAction::Complete(bool bSuccess)
+{
+    OnCompleted.Broadcast(bSuccess);
+    SetReadyToDestroy();
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "RPGCharacterSubsystem.h"
+#include "RPGDiceSubsystem.h"
+#include "RPGToolkitAsyncActions.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRPGCharacterAsyncResult, const FCharacterResult&, Result);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRPGRollAsyncResult, const FRollResult&, Result);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FRPGPublishAsyncResult, bool, bSuccess);
+
+/**
+ * Latent "Create Character Async" node
+ * Character creation (including the Go-side JSON unmarshal) runs on the toolkit worker pool
+ */
+UCLASS()
+class SESHAT_API URPGCreateCharacterAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    /** Fires on the game thread once the character is created (check HasError) */
+    UPROPERTY(BlueprintAssignable)
+    FRPGCharacterAsyncResult OnCompleted;
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Character", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Create Character Async"))
+    static URPGCreateCharacterAsyncAction* CreateCharacterAsync(
+        UObject* WorldContextObject,
+        const FString& RaceDataJSON,
+        const FString& ClassDataJSON,
+        const FString& BackgroundDataJSON,
+        const FString& CharacterName,
+        int32 Strength = 15, int32 Dexterity = 14, int32 Constitution = 13,
+        int32 Intelligence = 12, int32 Wisdom = 10, int32 Charisma = 8);
+
+    // Begin UBlueprintAsyncActionBase
+    virtual void Activate() override;
+    // End UBlueprintAsyncActionBase
+
+private:
+    void Complete(const FCharacterResult& Result);
+
+    TWeakObjectPtr<URPGCharacterSubsystem> Subsystem;
+    FString RaceDataJSON;
+    FString ClassDataJSON;
+    FString BackgroundDataJSON;
+    FString CharacterName;
+    int32 AbilityScores[6] = {};
+};
+
+/**
+ * Latent "Roll Dice Async" node
+ * Toolkit-backend rolls run on the toolkit worker pool; native backends complete on activation
+ */
+UCLASS()
+class SESHAT_API URPGRollDiceAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintAssignable)
+    FRPGRollAsyncResult OnCompleted;
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Roll Dice Async"))
+    static URPGRollDiceAsyncAction* RollDiceAsync(UObject* WorldContextObject, int32 Count, int32 Size, bool bBatchPerFrame = false);
+
+    // Begin UBlueprintAsyncActionBase
+    virtual void Activate() override;
+    // End UBlueprintAsyncActionBase
+
+private:
+    void Complete(const FRollResult& Result);
+
+    TWeakObjectPtr<URPGDiceSubsystem> Subsystem;
+    int32 Count = 1;
+    int32 Size = 20;
+    bool bBatchPerFrame = false;
+};
+
+/**
+ * Latent "Publish Event Async" node
+ * Publishes are batched per frame by default so a burst of events costs one pool hand-off
+ */
+UCLASS()
+class SESHAT_API URPGPublishEventAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintAssignable)
+    FRPGPublishAsyncResult OnCompleted;
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Events", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", DisplayName = "Publish Event Async"))
+    static URPGPublishEventAsyncAction* PublishEventAsync(UObject* WorldContextObject, const FString& EventType, const FString& SourceID, const FString& TargetID, const FString& ContextData, bool bBatchPerFrame = true);
+
+    // Begin UBlueprintAsyncActionBase
+    virtual void Activate() override;
+    // End UBlueprintAsyncActionBase
+
+private:
+    void Complete(bool bSuccess);
+
+    TWeakObjectPtr<class URPGEventBusSubsystem> Subsystem;
+    FString EventType;
+    FString SourceID;
+    FString TargetID;
+    FString ContextData;
+    bool bBatchPerFrame = true;
+};
@@ -0,0 +1,153 @@
+#include "RPGToolkitExecutor.h"
+#include "RPGToolkitModule.h"
+#include "Misc/IQueuedWork.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_STAT(STAT_RPGToolkitGameThreadCall);
+DEFINE_STAT(STAT_RPGToolkitWorkerCall);
+DEFINE_STAT(STAT_RPGToolkitBatchFlush);
+DEFINE_STAT(STAT_RPGToolkitBatchedCalls);
+
+FCriticalSection FRPGToolkitExecutor::Mutex;
+FRPGToolkitExecutor* FRPGToolkitExecutor::Instance = nullptr;
+int32 FRPGToolkitExecutor::RefCount = 0;
+
+namespace
+{
+    /** One pool work item. Abandoned work (pool shutdown) still runs so every promise is fulfilled */
+    class FRPGToolkitWork final : public IQueuedWork
+    {
+    public:
+        explicit FRPGToolkitWork(TUniqueFunction<void()>&& InTask)
+            : Task(MoveTemp(InTask))
+        {
+        }
+
+        virtual void DoThreadedWork() override
+        {
+            {
+                SCOPE_CYCLE_COUNTER(STAT_RPGToolkitWorkerCall);
+                Task();
+            }
+            delete this;
+        }
+
+        virtual void Abandon() override
+        {
+            Task();
+            delete this;
+        }
+
+    private:
+        TUniqueFunction<void()> Task;
+    };
+}
+
+FRPGToolkitExecutor* FRPGToolkitExecutor::Acquire(const TCHAR* OwnerName)
+{
+    FScopeLock Lock(&Mutex);
+
+    if (RefCount == 0)
+    {
+        // The executor holds its own reference so the function table outlives every queued call
+        const FRPGToolkitAPI* API = FRPGToolkitModule::Acquire(TEXT("RPGToolkitExecutor"));
+        if (!API)
+        {
+            UE_LOG(LogTemp, Error, TEXT("FRPGToolkitExecutor: %s could not acquire the executor - DLL not loaded"), OwnerName);
+            return nullptr;
+        }
+
+        Instance = new FRPGToolkitExecutor(API);
+    }
+
+    ++RefCount;
+    UE_LOG(LogTemp, Log, TEXT("FRPGToolkitExecutor: %s acquired executor (refs: %d)"), OwnerName, RefCount);
+
+    return Instance;
+}
+
+void FRPGToolkitExecutor::Release(const TCHAR* OwnerName)
+{
+    FScopeLock Lock(&Mutex);
+
+    if (RefCount <= 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FRPGToolkitExecutor: %s released executor without acquiring it"), OwnerName);
+        return;
+    }
+
+    --RefCount;
+    UE_LOG(LogTemp, Log, TEXT("FRPGToolkitExecutor: %s released executor (refs: %d)"), OwnerName, RefCount);
+
+    if (RefCount == 0)
+    {
+        delete Instance;
+        Instance = nullptr;
+        FRPGToolkitModule::Release(TEXT("RPGToolkitExecutor"));
+    }
+}
+
+FRPGToolkitExecutor::FRPGToolkitExecutor(const FRPGToolkitAPI* InToolkit)
+    : Toolkit(InToolkit)
+    , Pool(FQueuedThreadPool::Allocate())
+{
+    Pool->Create(NumWorkerThreads, 128 * 1024, TPri_Normal, TEXT("RPGToolkitPool"));
+    FlushHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FRPGToolkitExecutor::FlushBatch));
+}
+
+FRPGToolkitExecutor::~FRPGToolkitExecutor()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(FlushHandle);
+
+    // Send the unflushed batch, then let Destroy() run or abandon (which also runs) everything queued
+    FlushBatch(0.0f);
+    Pool->Destroy();
+    delete Pool;
+    Pool = nullptr;
+}
+
+int32 FRPGToolkitExecutor::GetPendingBatchSize() const
+{
+    FScopeLock Lock(&BatchMutex);
+    return PendingBatch.Num();
+}
+
+void FRPGToolkitExecutor::Dispatch(TUniqueFunction<void()>&& Task, bool bBatchPerFrame)
+{
+    if (bBatchPerFrame)
+    {
+        FScopeLock Lock(&BatchMutex);
+        PendingBatch.Add(MoveTemp(Task));
+        return;
+    }
+
+    Pool->AddQueuedWork(new FRPGToolkitWork(MoveTemp(Task)));
+}
+
+bool FRPGToolkitExecutor::FlushBatch(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitBatchFlush);
+
+    TArray<TUniqueFunction<void()>> Batch;
+    {
+        FScopeLock Lock(&BatchMutex);
+        Batch = MoveTemp(PendingBatch);
+    }
+
+    SET_DWORD_STAT(STAT_RPGToolkitBatchedCalls, Batch.Num());
+
+    if (Batch.Num() > 0)
+    {
+        // One pool hand-off per frame; calls keep their submission order
+        Pool->AddQueuedWork(new FRPGToolkitWork([Batch = MoveTemp(Batch)]()
+        {
+            for (const TUniqueFunction<void()>& Task : Batch)
+            {
+                Task();
+            }
+        }));
+    }
+
+    return true;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "Stats/Stats.h"
+
+// Forward declarations
+struct FRPGToolkitAPI;
+class FQueuedThreadPool;
+
+/** Toolkit (CGO) cost, split by the thread that paid it - "stat RPGToolkit" */
+DECLARE_STATS_GROUP(TEXT("RPG Toolkit"), STATGROUP_RPGToolkit, STATCAT_Advanced);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Toolkit Call (Game Thread)"), STAT_RPGToolkitGameThreadCall, STATGROUP_RPGToolkit, SESHAT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Toolkit Call (Worker)"), STAT_RPGToolkitWorkerCall, STATGROUP_RPGToolkit, SESHAT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Batch Flush"), STAT_RPGToolkitBatchFlush, STATGROUP_RPGToolkit, SESHAT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Calls"), STAT_RPGToolkitBatchedCalls, STATGROUP_RPGToolkit, SESHAT_API);
+
+/**
+ * Runs toolkit calls on a dedicated worker pool so Go GC pauses and JSON unmarshalling never stall the game thread
+ * Shared and ref-counted like FRPGToolkitModule: subsystems Acquire() it in Initialize and Release() it in Deinitialize
+ * Calls get the function table as a parameter; results come back as TFutures or as callbacks on the game thread
+ */
+class SESHAT_API FRPGToolkitExecutor
+{
+public:
+    /** Worker threads in the toolkit pool */
+    static constexpr int32 NumWorkerThreads = 2;
+
+    /**
+     * Borrow the executor, creating the worker pool on first use
+     * @param OwnerName Name of the borrowing subsystem (for logging)
+     * @return The shared executor, or nullptr if the toolkit DLL could not be loaded
+     */
+    static FRPGToolkitExecutor* Acquire(const TCHAR* OwnerName);
+
+    /** Return an executor borrowed with Acquire(). The last release runs every outstanding call before returning */
+    static void Release(const TCHAR* OwnerName);
+
+    /**
+     * Run Call on the toolkit pool
+     * @param bBatchPerFrame Hold the call until the end of the frame and send it with the rest of the frame's batch
+     */
+    template<typename ResultType>
+    TFuture<ResultType> Submit(TUniqueFunction<ResultType(const FRPGToolkitAPI&)> Call, bool bBatchPerFrame = false)
+    {
+        TSharedRef<TPromise<ResultType>> Promise = MakeShared<TPromise<ResultType>>();
+        TFuture<ResultType> Future = Promise->GetFuture();
+
+        const FRPGToolkitAPI* API = Toolkit;
+        Dispatch([API, Promise, Call = MoveTemp(Call)]() mutable
+        {
+            Promise->SetValue(Call(*API));
+        }, bBatchPerFrame);
+
+        return Future;
+    }
+
+    /** Run Call on the toolkit pool and hand its result to OnComplete on the game thread */
+    template<typename ResultType>
+    void SubmitThen(TUniqueFunction<ResultType(const FRPGToolkitAPI&)> Call, TUniqueFunction<void(ResultType)> OnComplete, bool bBatchPerFrame = false)
+    {
+        const FRPGToolkitAPI* API = Toolkit;
+        Dispatch([API, Call = MoveTemp(Call), OnComplete = MoveTemp(OnComplete)]() mutable
+        {
+            AsyncTask(ENamedThreads::GameThread, [Result = Call(*API), OnComplete = MoveTemp(OnComplete)]() mutable
+            {
+                OnComplete(MoveTemp(Result));
+            });
+        }, bBatchPerFrame);
+    }
+
+    /** Calls waiting for the end-of-frame flush */
+    int32 GetPendingBatchSize() const;
+
+private:
+    FRPGToolkitExecutor(const FRPGToolkitAPI* InToolkit);
+    ~FRPGToolkitExecutor();
+
+    /** Queue a task on the pool now, or append it to this frame's batch */
+    void Dispatch(TUniqueFunction<void()>&& Task, bool bBatchPerFrame);
+
+    /** End-of-frame flush: the whole batch goes to the pool as one work item */
+    bool FlushBatch(float DeltaTime);
+
+    const FRPGToolkitAPI* Toolkit;
+    FQueuedThreadPool* Pool;
+    FTSTicker::FDelegateHandle FlushHandle;
+
+    mutable FCriticalSection BatchMutex;
+    TArray<TUniqueFunction<void()>> PendingBatch;
+
+    static FCriticalSection Mutex;
+    static FRPGToolkitExecutor* Instance;
+    static int32 RefCount;
+};
@@ -0,0 +1,146 @@
+#include "RPGToolkitModule.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+FCriticalSection FRPGToolkitModule::Mutex;
+FRPGToolkitAPI FRPGToolkitModule::API;
+void* FRPGToolkitModule::ToolkitDLLHandle = nullptr;
+int32 FRPGToolkitModule::RefCount = 0;
+double FRPGToolkitModule::LoadTimeSeconds = 0.0;
+FRPGToolkitConstants FRPGToolkitModule::Constants;
+bool FRPGToolkitModule::bConstantsLoaded = false;
+
+const FRPGToolkitAPI* FRPGToolkitModule::Acquire(const TCHAR* OwnerName)
+{
+    FScopeLock Lock(&Mutex);
+    
+    if (RefCount == 0 && !LoadToolkitLibrary())
+    {
+        UE_LOG(LogTemp, Error, TEXT("FRPGToolkitModule: %s could not acquire the toolkit - DLL not loaded"), OwnerName);
+        return nullptr;
+    }
+    
+    ++RefCount;
+    UE_LOG(LogTemp, Log, TEXT("FRPGToolkitModule: %s acquired toolkit (refs: %d)"), OwnerName, RefCount);
+    
+    return &API;
+}
+
+void FRPGToolkitModule::Release(const TCHAR* OwnerName)
+{
+    FScopeLock Lock(&Mutex);
+    
+    if (RefCount <= 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FRPGToolkitModule: %s released toolkit without acquiring it"), OwnerName);
+        return;
+    }
+    
+    --RefCount;
+    UE_LOG(LogTemp, Log, TEXT("FRPGToolkitModule: %s released toolkit (refs: %d)"), OwnerName, RefCount);
+    
+    if (RefCount == 0)
+    {
+        // Last borrower is gone - clear the table so stale pointers fail the subsystems' null checks.
+        // The DLL itself stays mapped: the Go runtime in a c-shared library cannot be unloaded safely,
+        // so the handle is kept and reused if a new game instance acquires the toolkit again.
+        API = FRPGToolkitAPI();
+        UE_LOG(LogTemp, Warning, TEXT("FRPGToolkitModule: All subsystems released the toolkit"));
+    }
+}
+
+bool FRPGToolkitModule::IsLoaded()
+{
+    FScopeLock Lock(&Mutex);
+    return RefCount > 0 && ToolkitDLLHandle != nullptr;
+}
+
+int32 FRPGToolkitModule::GetRefCount()
+{
+    FScopeLock Lock(&Mutex);
+    return RefCount;
+}
+
+double FRPGToolkitModule::GetLoadTimeSeconds()
+{
+    FScopeLock Lock(&Mutex);
+    return LoadTimeSeconds;
+}
+
+bool FRPGToolkitModule::LoadToolkitLibrary()
+{
+    const double StartTime = FPlatformTime::Seconds();
+    
+    if (!ToolkitDLLHandle)
+    {
+        // Use proper UE binary directory (following established pattern)
+        FString BinariesDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("Binaries"), FPlatformProcess::GetBinariesSubdirectory());
+        FString LibraryPath = FPaths::Combine(BinariesDir, TEXT("rpg_toolkit.dll"));
+        LibraryPath = FPaths::ConvertRelativePathToFull(LibraryPath);
+        
+        UE_LOG(LogTemp, Warning, TEXT("FRPGToolkitModule: Attempting to load DLL from: %s"), *LibraryPath);
+        
+        // Check if the DLL exists
+        if (!FPaths::FileExists(LibraryPath))
+        {
+            UE_LOG(LogTemp, Error, TEXT("FRPGToolkitModule: DLL not found at path: %s (%.3f ms)"),
+                *LibraryPath, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+            return false;
+        }
+        
+        // Load the DLL
+        ToolkitDLLHandle = FPlatformProcess::GetDllHandle(*LibraryPath);
+        if (!ToolkitDLLHandle)
+        {
+            UE_LOG(LogTemp, Error, TEXT("FRPGToolkitModule: Failed to load DLL after %.3f ms"),
+                (FPlatformTime::Seconds() - StartTime) * 1000.0);
+            return false;
+        }
+        
+        UE_LOG(LogTemp, Warning, TEXT("FRPGToolkitModule: Mapped DLL in %.3f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+    
+    // Resolve every export in one pass
+    const double BindStartTime = FPlatformTime::Seconds();
+    int32 NumExports = 0;
+    int32 NumResolved = 0;
+    
+#define RPG_TOOLKIT_RESOLVE_EXPORT(ReturnType, Name, Params) \
+    API.Name = (FRPGToolkitAPI::Name##Func)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT(#Name)); \
+    ++NumExports; \
+    if (API.Name) { ++NumResolved; } \
+    else { UE_LOG(LogTemp, Warning, TEXT("FRPGToolkitModule: Export not found: %s"), TEXT(#Name)); }
+
+    RPG_TOOLKIT_EXPORTS(RPG_TOOLKIT_RESOLVE_EXPORT)
+
+#undef RPG_TOOLKIT_RESOLVE_EXPORT
+    
+    // Constants never change, so each is fetched (and its C string freed) once per process
+    if (!bConstantsLoaded && API.FreeString)
+    {
+#define RPG_TOOLKIT_FETCH_CONSTANT(Name, ExportName, Fallback) \
+        if (API.ExportName) \
+        { \
+            if (ANSICHAR* Value = API.ExportName()) \
+            { \
+                Constants.Name.Set(UTF8_TO_TCHAR(Value)); \
+                API.FreeString(Value); \
+            } \
+        }
+
+        RPG_TOOLKIT_CONSTANTS(RPG_TOOLKIT_FETCH_CONSTANT)
+
+#undef RPG_TOOLKIT_FETCH_CONSTANT
+        bConstantsLoaded = true;
+    }
+    
+    const double EndTime = FPlatformTime::Seconds();
+    LoadTimeSeconds = EndTime - StartTime;
+    
+    UE_LOG(LogTemp, Warning, TEXT("FRPGToolkitModule: Resolved %d/%d exports in %.3f ms (load + bind %.3f ms)"),
+        NumResolved, NumExports, (EndTime - BindStartTime) * 1000.0, LoadTimeSeconds * 1000.0);
+    
+    return true;
+}
@@ -0,0 +1,269 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+// Forward declarations
+struct FRPGDiceSpecPacked;
+struct FRPGEntityViewPacked;
+
+/** Go -> UE event callback (RegisterEventCallback): one wire-format event, returns 0 if it was dropped */
+typedef int32 (*FRPGToolkitEventCallback)(const uint8* Data, int32 Length, void* UserData);
+
+/**
+ * Every rpg_toolkit.dll export used by the subsystems
+ * X(ReturnType, ExportName, (ParameterTypes))
+ * Adding an export here is enough to have it resolved at load time
+ */
+#define RPG_TOOLKIT_EXPORTS(X) \
+    /* Dice - Roller interface (dice/roller.go) */ \
+    X(void*, CreateCryptoRoller, ()) \
+    X(int32, RollerRoll, (void*, int32)) \
+    X(int32, RollerRollN, (void*, int32, int32, int32*)) \
+    X(void*, GetDefaultRoller, ()) \
+    X(void, SetDefaultRoller, (void*)) \
+    /* Dice - Roll struct (dice/modifier.go) */ \
+    X(void*, CreateRoll, (int32, int32)) \
+    X(void*, CreateRollWithRoller, (int32, int32, void*)) \
+    X(int32, RollGetValue, (uintptr_t)) \
+    X(ANSICHAR*, RollGetDescription, (uintptr_t)) \
+    X(int32, RollHasError, (uintptr_t)) \
+    X(ANSICHAR*, RollGetError, (uintptr_t)) \
+    /* Dice - Automatic cleanup helpers */ \
+    X(int32, D4Complete, (int32, int32*, ANSICHAR**, ANSICHAR**)) \
+    X(int32, D6Complete, (int32, int32*, ANSICHAR**, ANSICHAR**)) \
+    X(int32, D8Complete, (int32, int32*, ANSICHAR**, ANSICHAR**)) \
+    X(int32, D10Complete, (int32, int32*, ANSICHAR**, ANSICHAR**)) \
+    X(int32, D12Complete, (int32, int32*, ANSICHAR**, ANSICHAR**)) \
+    X(int32, D20Complete, (int32, int32*, ANSICHAR**, ANSICHAR**)) \
+    X(int32, D100Complete, (int32, int32*, ANSICHAR**, ANSICHAR**)) \
+    /* Dice - Batched rolls */ \
+    X(int32, RollBatch, (const FRPGDiceSpecPacked*, int32, int32*, int32*)) \
+    /* Dice - Structured rolls */ \
+    X(int32, DiceRollStructured, (int32, int32, int32*, int32, int32*)) \
+    /* Dice - Legacy */ \
+    X(void*, CreateDiceRoller, ()) \
+    X(int32, RollDie, (void*, int32)) \
+    /* Core - Error constants (core/errors.go) */ \
+    X(ANSICHAR*, GetEntityNotFoundError, ()) \
+    X(ANSICHAR*, GetInvalidEntityError, ()) \
+    X(ANSICHAR*, GetDuplicateEntityError, ()) \
+    X(ANSICHAR*, GetNilEntityError, ()) \
+    X(ANSICHAR*, GetEmptyIDError, ()) \
+    X(ANSICHAR*, GetInvalidTypeError, ()) \
+    /* Core - Entity validation and errors */ \
+    X(int32, ValidateEntityID, (const ANSICHAR*)) \
+    X(int32, ValidateEntityType, (const ANSICHAR*)) \
+    X(int32, ValidateEntitiesBatch, (const FRPGEntityViewPacked*, int32, uint64*)) \
+    X(int32, CreateEntityErrorComplete, (const ANSICHAR*, const ANSICHAR*, const ANSICHAR*, const ANSICHAR*, ANSICHAR**, ANSICHAR**, ANSICHAR**, ANSICHAR**)) \
+    /* Events - EventBus (events/eventbus.go) */ \
+    X(ANSICHAR*, CreateEventBus, ()) \
+    X(int32, PublishEvent, (const ANSICHAR*, const ANSICHAR*, const ANSICHAR*, const ANSICHAR*)) \
+    X(ANSICHAR*, SubscribeEvent, (const ANSICHAR*, int32)) \
+    X(int32, UnsubscribeEvent, (const ANSICHAR*)) \
+    X(int32, RegisterEventCallback, (FRPGToolkitEventCallback, void*)) \
+    /* Events - Binary wire format (event_wire.go) */ \
+    X(int32, PublishEventBinary, (const uint8*, int32)) \
+    X(int32, EchoEventBinary, (const uint8*, int32, uint8*, int32)) \
+    /* Events - Event type constants (events/types.go) */ \
+    X(ANSICHAR*, GetEventBeforeAttackRoll, ()) \
+    X(ANSICHAR*, GetEventOnAttackRoll, ()) \
+    X(ANSICHAR*, GetEventAfterAttackRoll, ()) \
+    X(ANSICHAR*, GetEventBeforeDamageRoll, ()) \
+    X(ANSICHAR*, GetEventOnTakeDamage, ()) \
+    X(ANSICHAR*, GetEventCalculateDamage, ()) \
+    X(ANSICHAR*, GetEventAfterDamage, ()) \
+    X(ANSICHAR*, GetEventEntityPlaced, ()) \
+    X(ANSICHAR*, GetEventEntityMoved, ()) \
+    X(ANSICHAR*, GetEventRoomCreated, ()) \
+    X(ANSICHAR*, GetEventTurnStart, ()) \
+    X(ANSICHAR*, GetEventTurnEnd, ()) \
+    X(ANSICHAR*, GetEventRoundStart, ()) \
+    X(ANSICHAR*, GetEventRoundEnd, ()) \
+    X(ANSICHAR*, GetEventStatusApplied, ()) \
+    X(ANSICHAR*, GetEventStatusRemoved, ()) \
+    X(ANSICHAR*, GetEventStatusCheck, ()) \
+    /* Events - Context key constants (events/context.go) */ \
+    X(ANSICHAR*, GetContextKeyAttacker, ()) \
+    X(ANSICHAR*, GetContextKeyTarget, ()) \
+    X(ANSICHAR*, GetContextKeyWeapon, ()) \
+    X(ANSICHAR*, GetContextKeyDamageType, ()) \
+    X(ANSICHAR*, GetContextKeyAdvantage, ()) \
+    X(ANSICHAR*, GetContextKeyRoll, ()) \
+    X(ANSICHAR*, GetContextKeyOldPosition, ()) \
+    X(ANSICHAR*, GetContextKeyNewPosition, ()) \
+    X(ANSICHAR*, GetContextKeyRoomID, ()) \
+    /* Events - Modifier factories (events/modifier.go) */ \
+    X(ANSICHAR*, CreateModifier, (const ANSICHAR*, const ANSICHAR*, int32, int32)) \
+    X(ANSICHAR*, CreateIntModifier, (const ANSICHAR*, const ANSICHAR*, int32)) \
+    X(ANSICHAR*, CreateDiceModifier, (const ANSICHAR*, const ANSICHAR*, const ANSICHAR*)) \
+    /* Events - Duration constants (events/duration.go) */ \
+    X(ANSICHAR*, GetDurationPermanent, ()) \
+    X(ANSICHAR*, GetDurationRounds, ()) \
+    X(ANSICHAR*, GetDurationMinutes, ()) \
+    X(ANSICHAR*, GetDurationHours, ()) \
+    X(ANSICHAR*, GetDurationEncounter, ()) \
+    X(ANSICHAR*, GetDurationConcentration, ()) \
+    X(ANSICHAR*, GetDurationShortRest, ()) \
+    X(ANSICHAR*, GetDurationLongRest, ()) \
+    X(ANSICHAR*, GetDurationUntilDamaged, ()) \
+    X(ANSICHAR*, GetDurationUntilSave, ()) \
+    /* Character creation (rulebooks/dnd5e) */ \
+    X(int, CreateCharacterComplete, (const char*, const char*, const char*, const char*, \
+        int, int, int, int, int, int, \
+        char**, char**, int*, int*, \
+        char**, char**, char**, \
+        int*, int*, int*, int*, int*, int*, \
+        char**, int*, \
+        int*, int*, int*, int*, \
+        char**, char**, \
+        char**)) \
+    /* Memory management */ \
+    X(void, FreeString, (ANSICHAR*)) \
+    X(void, FreeEventString, (ANSICHAR*))
+
+/**
+ * Function table for rpg_toolkit.dll
+ * Resolved once by FRPGToolkitModule and borrowed by every subsystem
+ * Unresolved exports are left as nullptr so callers can keep their per-function checks
+ */
+struct FRPGToolkitAPI
+{
+#define RPG_TOOLKIT_DECLARE_EXPORT(ReturnType, Name, Params) \
+    typedef ReturnType (*Name##Func) Params; \
+    Name##Func Name = nullptr;
+
+    RPG_TOOLKIT_EXPORTS(RPG_TOOLKIT_DECLARE_EXPORT)
+
+#undef RPG_TOOLKIT_DECLARE_EXPORT
+};
+
+/**
+ * Immutable string constants exported by rpg_toolkit.dll
+ * X(Name, ExportName, Fallback) - the fallback stands in until the DLL loads, or if the export is missing
+ */
+#define RPG_TOOLKIT_CONSTANTS(X) \
+    /* Core - Error constants (core/errors.go) */ \
+    X(EntityNotFoundError, GetEntityNotFoundError, "Entity not found") \
+    X(InvalidEntityError, GetInvalidEntityError, "Invalid entity") \
+    X(DuplicateEntityError, GetDuplicateEntityError, "Duplicate entity") \
+    X(NilEntityError, GetNilEntityError, "Nil entity") \
+    X(EmptyIDError, GetEmptyIDError, "Empty entity ID") \
+    X(InvalidTypeError, GetInvalidTypeError, "Invalid entity type") \
+    /* Events - Event types (events/types.go) */ \
+    X(EventBeforeAttackRoll, GetEventBeforeAttackRoll, "before_attack_roll") \
+    X(EventOnAttackRoll, GetEventOnAttackRoll, "on_attack_roll") \
+    X(EventAfterAttackRoll, GetEventAfterAttackRoll, "after_attack_roll") \
+    X(EventBeforeDamageRoll, GetEventBeforeDamageRoll, "before_damage_roll") \
+    X(EventOnTakeDamage, GetEventOnTakeDamage, "on_take_damage") \
+    X(EventCalculateDamage, GetEventCalculateDamage, "calculate_damage") \
+    X(EventAfterDamage, GetEventAfterDamage, "after_damage") \
+    X(EventEntityPlaced, GetEventEntityPlaced, "spatial.entity.placed") \
+    X(EventEntityMoved, GetEventEntityMoved, "spatial.entity.moved") \
+    X(EventRoomCreated, GetEventRoomCreated, "spatial.room.created") \
+    X(EventTurnStart, GetEventTurnStart, "turn_start") \
+    X(EventTurnEnd, GetEventTurnEnd, "turn_end") \
+    X(EventRoundStart, GetEventRoundStart, "round_start") \
+    X(EventRoundEnd, GetEventRoundEnd, "round_end") \
+    X(EventStatusApplied, GetEventStatusApplied, "status_applied") \
+    X(EventStatusRemoved, GetEventStatusRemoved, "status_removed") \
+    X(EventStatusCheck, GetEventStatusCheck, "status_check") \
+    /* Events - Context keys (events/context.go) */ \
+    X(ContextKeyAttacker, GetContextKeyAttacker, "attacker") \
+    X(ContextKeyTarget, GetContextKeyTarget, "target") \
+    X(ContextKeyWeapon, GetContextKeyWeapon, "weapon") \
+    X(ContextKeyDamageType, GetContextKeyDamageType, "damage_type") \
+    X(ContextKeyAdvantage, GetContextKeyAdvantage, "advantage") \
+    X(ContextKeyRoll, GetContextKeyRoll, "roll") \
+    X(ContextKeyOldPosition, GetContextKeyOldPosition, "old_position") \
+    X(ContextKeyNewPosition, GetContextKeyNewPosition, "new_position") \
+    X(ContextKeyRoomID, GetContextKeyRoomID, "room_id") \
+    /* Events - Durations (events/duration.go) */ \
+    X(DurationPermanent, GetDurationPermanent, "permanent") \
+    X(DurationRounds, GetDurationRounds, "rounds") \
+    X(DurationMinutes, GetDurationMinutes, "minutes") \
+    X(DurationHours, GetDurationHours, "hours") \
+    X(DurationEncounter, GetDurationEncounter, "encounter") \
+    X(DurationConcentration, GetDurationConcentration, "concentration") \
+    X(DurationShortRest, GetDurationShortRest, "short_rest") \
+    X(DurationLongRest, GetDurationLongRest, "long_rest") \
+    X(DurationUntilDamaged, GetDurationUntilDamaged, "until_damaged") \
+    X(DurationUntilSave, GetDurationUntilSave, "until_save")
+
+/** One toolkit constant, also interned as an FName so it compares by index (e.g. against FRPGEventContext::EventName) */
+struct FRPGToolkitConstant
+{
+    FString String;
+    FName Name;
+
+    explicit FRPGToolkitConstant(const TCHAR* Value)
+        : String(Value)
+        , Name(Value)
+    {
+    }
+
+    void Set(const TCHAR* Value)
+    {
+        String = Value;
+        Name = FName(Value);
+    }
+
+    bool operator==(FName Other) const { return Name == Other; }
+};
+
+/** Every toolkit constant, filled once when the DLL first loads (see FRPGToolkitModule::GetConstants) */
+struct FRPGToolkitConstants
+{
+#define RPG_TOOLKIT_DECLARE_CONSTANT(Name, ExportName, Fallback) \
+    FRPGToolkitConstant Name{ TEXT(Fallback) };
+
+    RPG_TOOLKIT_CONSTANTS(RPG_TOOLKIT_DECLARE_CONSTANT)
+
+#undef RPG_TOOLKIT_DECLARE_CONSTANT
+};
+
+/**
+ * Shared, ref-counted loader for rpg_toolkit.dll
+ * Loads the library once and resolves all exports in one pass into a static function table
+ * Subsystems Acquire() the table in Initialize and Release() it in Deinitialize
+ */
+class SESHAT_API FRPGToolkitModule
+{
+public:
+    /**
+     * Borrow the toolkit function table, loading the DLL on first use
+     * @param OwnerName Name of the borrowing subsystem (for logging)
+     * @return The shared function table, or nullptr if the DLL could not be loaded
+     */
+    static const FRPGToolkitAPI* Acquire(const TCHAR* OwnerName);
+
+    /** Return a table borrowed with Acquire(). Only call after a successful Acquire */
+    static void Release(const TCHAR* OwnerName);
+
+    /** Whether the DLL is loaded and the function table is populated */
+    static bool IsLoaded();
+
+    /** Number of subsystems currently borrowing the function table */
+    static int32 GetRefCount();
+
+    /** Time spent loading the DLL and resolving exports on the last load, in seconds */
+    static double GetLoadTimeSeconds();
+
+    /**
+     * Toolkit string constants - a memory read instead of a CGO call and a string allocation per lookup
+     * Fetched from the DLL on its first load and kept for the life of the process (they never change)
+     */
+    static const FRPGToolkitConstants& GetConstants() { return Constants; }
+
+private:
+    /** Build the library path, load the DLL and resolve every export (called under Mutex) */
+    static bool LoadToolkitLibrary();
+
+    static FCriticalSection Mutex;
+    static FRPGToolkitAPI API;
+    static void* ToolkitDLLHandle;
+    static int32 RefCount;
+    static double LoadTimeSeconds;
+    static FRPGToolkitConstants Constants;
+    static bool bConstantsLoaded;
+};
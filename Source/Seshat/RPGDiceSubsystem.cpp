@@ -1,6 +1,121 @@
 #include "RPGDiceSubsystem.h"
+#include "RPGCore/Toolkit/RPGToolkitModule.h"
+#include "RPGCore/Toolkit/RPGToolkitExecutor.h"
+#include "RPGCore/Dice/RPGDiceEngine.h"
+#include "RPGCore/Dice/RPGDiceBulkGenerator.h"
+#include "RPGCore/Dice/RPGDiceDistribution.h"
+#include "RPGCore/Dice/RPGDiceStream.h"
+#include "RPGCore/Dice/RPGDiceRollPool.h"
+#include "HAL/PlatformTime.h"
 #include "HAL/PlatformProcess.h"
-#include "Misc/Paths.h"
+#include "Misc/StringBuilder.h"
+#include "RPGCore/RPGBenchCommands.h"
+
+const FName URPGDiceSubsystem::DefaultStreamName(TEXT("Session"));
+
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchRollBatchCommand(
+        TEXT("rpg.Bench.RollBatch"),
+        TEXT("rpg.Bench.RollBatch [NumRolls=1000] - D20Complete once per roll against one RollBatch call"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGDiceSubsystem* Dice = RPGBench::FindSubsystem<URPGDiceSubsystem>(World, Ar))
+            {
+                Ar.Log(Dice->BenchmarkRollBatch(RPGBench::IntArg(Args, 0, 1000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchStructuredRollsCommand(
+        TEXT("rpg.Bench.StructuredRolls"),
+        TEXT("rpg.Bench.StructuredRolls [NumRolls=1000] - Go-allocated roll strings against DiceRollStructured"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGDiceSubsystem* Dice = RPGBench::FindSubsystem<URPGDiceSubsystem>(World, Ar))
+            {
+                Ar.Log(Dice->BenchmarkStructuredRolls(RPGBench::IntArg(Args, 0, 1000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchDiceBackendsCommand(
+        TEXT("rpg.Bench.DiceBackends"),
+        TEXT("rpg.Bench.DiceBackends [NumRolls=100000] - rolls per second on the toolkit, native crypto and native fast backends"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGDiceSubsystem* Dice = RPGBench::FindSubsystem<URPGDiceSubsystem>(World, Ar))
+            {
+                Ar.Log(Dice->BenchmarkDiceBackends(RPGBench::IntArg(Args, 0, 100000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchBulkRollsCommand(
+        TEXT("rpg.Bench.BulkRolls"),
+        TEXT("rpg.Bench.BulkRolls [NumRolls=10000000] - throughput of each compiled bulk kernel against the scalar engine"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGDiceSubsystem* Dice = RPGBench::FindSubsystem<URPGDiceSubsystem>(World, Ar))
+            {
+                Ar.Log(Dice->BenchmarkBulkRolls(RPGBench::IntArg(Args, 0, 10000000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchCheckBulkRollUniformityCommand(
+        TEXT("rpg.Bench.CheckBulkRollUniformity"),
+        TEXT("rpg.Bench.CheckBulkRollUniformity [NumRolls=10000000] [Size=20] - chi-square test of the bulk kernel and cross-kernel agreement"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGDiceSubsystem* Dice = RPGBench::FindSubsystem<URPGDiceSubsystem>(World, Ar))
+            {
+                Ar.Log(Dice->CheckBulkRollUniformity(RPGBench::IntArg(Args, 0, 10000000), RPGBench::IntArg(Args, 1, 20)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchDiceExpressionsCommand(
+        TEXT("rpg.Bench.DiceExpressions"),
+        TEXT("rpg.Bench.DiceExpressions [Notation=2d6+3] [NumRolls=100000] - parsing the notation every roll against cached bytecode"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGDiceSubsystem* Dice = RPGBench::FindSubsystem<URPGDiceSubsystem>(World, Ar))
+            {
+                Ar.Log(Dice->BenchmarkDiceExpressions(RPGBench::StringArg(Args, 0, TEXT("2d6+3")), RPGBench::IntArg(Args, 1, 100000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchDiceDistributionCommand(
+        TEXT("rpg.Bench.DiceDistribution"),
+        TEXT("rpg.Bench.DiceDistribution [Notation=2d6+3] [Target=10] [NumSamples=100000] - exact probability (first and cached) against Monte Carlo sampling"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGDiceSubsystem* Dice = RPGBench::FindSubsystem<URPGDiceSubsystem>(World, Ar))
+            {
+                Ar.Log(Dice->BenchmarkDiceDistribution(RPGBench::StringArg(Args, 0, TEXT("2d6+3")), RPGBench::IntArg(Args, 1, 10), RPGBench::IntArg(Args, 2, 100000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchCheckSeededReplayCommand(
+        TEXT("rpg.Bench.CheckSeededReplay"),
+        TEXT("rpg.Bench.CheckSeededReplay [Seed=42] [NumRolls=1000] - Philox known-answer vector, replay, seek and roll verification"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGDiceSubsystem* Dice = RPGBench::FindSubsystem<URPGDiceSubsystem>(World, Ar))
+            {
+                Ar.Log(Dice->CheckSeededReplay(RPGBench::Int64Arg(Args, 0, 42), RPGBench::IntArg(Args, 1, 1000)));
+            }
+        }));
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice BenchRollPoolsCommand(
+        TEXT("rpg.Bench.RollPools"),
+        TEXT("rpg.Bench.RollPools [NumRolls=1000] - game-thread cost per d20 of a pool pop against a synchronous crypto roll"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+        {
+            if (URPGDiceSubsystem* Dice = RPGBench::FindSubsystem<URPGDiceSubsystem>(World, Ar))
+            {
+                Ar.Log(Dice->BenchmarkRollPools(RPGBench::IntArg(Args, 0, 1000)));
+            }
+        }));
+}
+#endif
 
 void URPGDiceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -8,48 +123,28 @@ void URPGDiceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
     
     UE_LOG(LogTemp, Warning, TEXT("RPGDiceSubsystem: Initializing"));
     
-    // Initialize all function pointers to nullptr
     bFunctionsLoaded = false;
-    ToolkitDLLHandle = nullptr;
+    Toolkit = nullptr;
     DiceRollerPtr = nullptr;
+    DiceBackend = ERPGDiceBackend::Toolkit;
+    
+    // Native engines are always available, even without the toolkit DLL
+    NativeCryptoEngine = MakeShared<FRPGDiceEngine>(MakeUnique<FRPGCryptoDiceGenerator>());
+    NativeFastEngine = MakeShared<FRPGDiceEngine>(MakeUnique<FRPGFastDiceGenerator>(FPlatformTime::Cycles64()));
+    NativeBulkGenerator = MakeShared<FRPGDiceBulkGenerator>(FPlatformTime::Cycles64());
+    SetSeededSession(0);
     
-    // Initialize all function pointers
-    CreateCryptoRollerFuncPtr = nullptr;
-    RollerRollFuncPtr = nullptr;
-    RollerRollNFuncPtr = nullptr;
-    GetDefaultRollerFuncPtr = nullptr;
-    SetDefaultRollerFuncPtr = nullptr;
-    
-    CreateRollFuncPtr = nullptr;
-    CreateRollWithRollerFuncPtr = nullptr;
-    RollGetValueFuncPtr = nullptr;
-    RollGetDescriptionFuncPtr = nullptr;
-    RollHasErrorFuncPtr = nullptr;
-    RollGetErrorFuncPtr = nullptr;
-    
-    D4CompleteFuncPtr = nullptr;
-    D6CompleteFuncPtr = nullptr;
-    D8CompleteFuncPtr = nullptr;
-    D10CompleteFuncPtr = nullptr;
-    D12CompleteFuncPtr = nullptr;
-    D20CompleteFuncPtr = nullptr;
-    D100CompleteFuncPtr = nullptr;
-    
-    CreateDiceRollerFuncPtr = nullptr;
-    RollDieFuncPtr = nullptr;
-    FreeStringFuncPtr = nullptr;
-    
-    // Load DLL functions
-    LoadDLLFunctions();
+    // Borrow the shared toolkit function table
+    BindToolkitFunctions();
     
     if (bFunctionsLoaded)
     {
         UE_LOG(LogTemp, Warning, TEXT("RPGDiceSubsystem: Successfully initialized"));
         
         // Create dice roller instance using the new function
-        if (CreateCryptoRollerFuncPtr)
+        if (Toolkit->CreateCryptoRoller)
         {
-            DiceRollerPtr = CreateCryptoRollerFuncPtr();
+            DiceRollerPtr = Toolkit->CreateCryptoRoller();
             UE_LOG(LogTemp, Warning, TEXT("RPGDiceSubsystem: CryptoRoller created: %s"), DiceRollerPtr ? TEXT("OK") : TEXT("FAILED"));
         }
     }
@@ -65,211 +160,454 @@ void URPGDiceSubsystem::Deinitialize()
     
     // No cleanup needed - automatic cleanup approach
     
-    // Clear all function pointers
-    CreateCryptoRollerFuncPtr = nullptr;
-    RollerRollFuncPtr = nullptr;
-    RollerRollNFuncPtr = nullptr;
-    GetDefaultRollerFuncPtr = nullptr;
-    SetDefaultRollerFuncPtr = nullptr;
-    
-    CreateRollFuncPtr = nullptr;
-    CreateRollWithRollerFuncPtr = nullptr;
-    RollGetValueFuncPtr = nullptr;
-    RollGetDescriptionFuncPtr = nullptr;
-    RollHasErrorFuncPtr = nullptr;
-    RollGetErrorFuncPtr = nullptr;
-    
-    D4CompleteFuncPtr = nullptr;
-    D6CompleteFuncPtr = nullptr;
-    D8CompleteFuncPtr = nullptr;
-    D10CompleteFuncPtr = nullptr;
-    D12CompleteFuncPtr = nullptr;
-    D20CompleteFuncPtr = nullptr;
-    D100CompleteFuncPtr = nullptr;
-    
-    CreateDiceRollerFuncPtr = nullptr;
-    RollDieFuncPtr = nullptr;
-    FreeStringFuncPtr = nullptr;
+    // Join the refill worker before its engine and pools go away
+    if (RollPoolWorker.IsValid())
+    {
+        RollPoolWorker->StopThread();
+        RollPoolWorker.Reset();
+    }
+    
+    // Release the executor before the function table - outstanding async rolls finish here
+    if (Executor)
+    {
+        FRPGToolkitExecutor::Release(TEXT("RPGDiceSubsystem"));
+        Executor = nullptr;
+    }
+    
+    // Return the shared function table
+    if (Toolkit)
+    {
+        FRPGToolkitModule::Release(TEXT("RPGDiceSubsystem"));
+    }
     
     bFunctionsLoaded = false;
-    ToolkitDLLHandle = nullptr;
+    Toolkit = nullptr;
     DiceRollerPtr = nullptr;
+    NativeCryptoEngine.Reset();
+    NativeFastEngine.Reset();
+    NativeBulkGenerator.Reset();
+    DistributionCache.Reset();
+    SeededEngine.Reset();
+    SeededStreams.Reset();
     
     Super::Deinitialize();
 }
 
-// Roller Interface Functions Implementation
-int32 URPGDiceSubsystem::RollerRoll(int32 Size)
+// Backend Selection Implementation
+void URPGDiceSubsystem::SetDiceBackend(ERPGDiceBackend NewBackend)
 {
-    if (!IsSafeToCallFunction() || !RollerRollFuncPtr || !DiceRollerPtr)
+    DiceBackend = NewBackend;
+    
+    if (DiceBackend == ERPGDiceBackend::PooledCrypto && !RollPoolWorker.IsValid())
     {
-        return -1;
+        ConfigureRollPools();
     }
     
-    return RollerRollFuncPtr(DiceRollerPtr, Size);
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem: Dice backend set to %s"), *UEnum::GetValueAsString(NewBackend));
 }
 
-TArray<int32> URPGDiceSubsystem::RollerRollN(int32 Count, int32 Size)
+void URPGDiceSubsystem::SetNativeSeed(int64 Seed)
 {
-    TArray<int32> Results;
+    if (NativeFastEngine.IsValid())
+    {
+        NativeFastEngine->Seed(static_cast<uint64>(Seed));
+    }
     
-    if (!IsSafeToCallFunction() || !RollerRollNFuncPtr || !DiceRollerPtr || Count <= 0)
+    if (NativeBulkGenerator.IsValid())
     {
-        return Results;
+        NativeBulkGenerator->Seed(static_cast<uint64>(Seed));
+    }
+}
+
+FRPGDiceEngine* URPGDiceSubsystem::GetNativeEngine() const
+{
+    switch (DiceBackend)
+    {
+        case ERPGDiceBackend::NativeCrypto: return NativeCryptoEngine.Get();
+        case ERPGDiceBackend::NativeFast: return NativeFastEngine.Get();
+        case ERPGDiceBackend::Seeded: return SeededEngine.Get();
+        default: return nullptr;
+    }
+}
+
+// Roll Pools Implementation
+void URPGDiceSubsystem::ConfigureRollPools(int32 Capacity, int32 LowWatermark)
+{
+    if (RollPoolWorker.IsValid())
+    {
+        RollPoolWorker->StopThread();
+        RollPoolWorker.Reset();
     }
     
-    Results.SetNum(Count);
-    int32 ReturnedCount = RollerRollNFuncPtr(DiceRollerPtr, Count, Size, Results.GetData());
+    const TArray<int32> DieSizes = { 4, 6, 8, 10, 12, 20, 100 };
+    RollPoolWorker = MakeShared<FRPGDiceRollPoolWorker>(DieSizes, Capacity, LowWatermark);
     
-    if (ReturnedCount != Count)
+    if (!RollPoolWorker->StartThread())
     {
-        UE_LOG(LogTemp, Warning, TEXT("RPGDiceSubsystem::RollerRollN: Expected %d results, got %d"), Count, ReturnedCount);
-        Results.Empty();
+        UE_LOG(LogTemp, Error, TEXT("RPGDiceSubsystem: Failed to start roll pool worker - pooled rolls will fall back to synchronous crypto"));
+        return;
     }
     
-    return Results;
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem: Roll pools ready (capacity %d, low watermark %d)"),
+        RollPoolWorker->GetCapacity(), RollPoolWorker->GetLowWatermark());
 }
 
-// Legacy Roll Struct Functions (Deprecated - Use FRollResult functions instead)
-// These functions remain for backward compatibility but should not be used
-// New Blueprint code should use D4(), D6(), D8(), D10(), D12(), D20(), D100() functions
-
-// Helper Functions Implementation
-FRollResult URPGDiceSubsystem::D4(int32 Count)
+FRPGDicePoolStats URPGDiceSubsystem::GetRollPoolStats() const
 {
-    if (!IsSafeToCallFunction() || !D4CompleteFuncPtr)
+    FRPGDicePoolStats Result;
+    if (!RollPoolWorker.IsValid())
     {
-        return FRollResult(TEXT("Function not available"));
+        return Result;
     }
     
-    int32 value;
-    ANSICHAR* desc;
-    ANSICHAR* error;
+    const FRPGDiceRollPoolWorker::FStats Stats = RollPoolWorker->GetStats();
+    Result.Hits = static_cast<int64>(Stats.Hits);
+    Result.Misses = static_cast<int64>(Stats.Misses);
+    Result.RefillPasses = static_cast<int64>(Stats.RefillPasses);
+    Result.FacesGenerated = static_cast<int64>(Stats.FacesGenerated);
+    Result.Capacity = RollPoolWorker->GetCapacity();
+    Result.LowWatermark = RollPoolWorker->GetLowWatermark();
+    Result.D20Level = RollPoolWorker->GetPoolLevel(20);
+    return Result;
+}
+
+int32 URPGDiceSubsystem::PopPooledFace(int32 Size)
+{
+    int32 Face;
+    if (RollPoolWorker.IsValid() && RollPoolWorker->TryPop(Size, Face))
+    {
+        return Face;
+    }
     
-    int32 success = D4CompleteFuncPtr(Count, &value, &desc, &error);
+    return NativeCryptoEngine->Roll(Size);
+}
+
+// Seeded Streams Implementation
+void URPGDiceSubsystem::SetSeededSession(int64 Seed)
+{
+    SeededSessionSeed = Seed;
+    SeededStreams.Reset();
+    SeededEngine = MakeShared<FRPGDiceEngine>(FindOrAddStream(DefaultStreamName));
+}
+
+FRPGDiceStream& URPGDiceSubsystem::FindOrAddStream(FName StreamName)
+{
+    if (TSharedPtr<FRPGDiceStream>* Existing = SeededStreams.Find(StreamName))
+    {
+        return **Existing;
+    }
     
-    FRollResult Result;
-    Result.Value = value;
-    Result.Description = ConvertAndFreeString(desc);
-    Result.HasError = (success == 0);
-    Result.ErrorMessage = ConvertAndFreeString(error);
+    TSharedPtr<FRPGDiceStream> Stream = MakeShared<FRPGDiceStream>(static_cast<uint64>(SeededSessionSeed), FRPGDiceStream::HashStreamName(StreamName));
+    SeededStreams.Add(StreamName, Stream);
+    return *Stream;
+}
+
+FRollResult URPGDiceSubsystem::RollOnStream(FName StreamName, int32 Count, int32 Size, FRPGDiceStreamPosition& OutStart)
+{
+    FRPGDiceStream& Stream = FindOrAddStream(StreamName);
+    OutStart.Stream = StreamName;
+    OutStart.Position = static_cast<int64>(Stream.GetPosition());
     
+    FRPGDiceEngine Engine(Stream);
+    return RollNative(Engine, Count, Size);
+}
+
+FRPGDiceStreamPosition URPGDiceSubsystem::GetStreamPosition(FName StreamName)
+{
+    FRPGDiceStreamPosition Result;
+    Result.Stream = StreamName;
+    Result.Position = static_cast<int64>(FindOrAddStream(StreamName).GetPosition());
     return Result;
 }
 
-FRollResult URPGDiceSubsystem::D6(int32 Count)
+void URPGDiceSubsystem::SeekStream(const FRPGDiceStreamPosition& NewPosition)
 {
-    if (!IsSafeToCallFunction() || !D6CompleteFuncPtr)
+    FindOrAddStream(NewPosition.Stream).SetPosition(static_cast<uint64>(NewPosition.Position));
+}
+
+bool URPGDiceSubsystem::VerifySeededRoll(int64 Seed, const FRPGDiceStreamPosition& Start, int32 Count, int32 Size, int32 ExpectedTotal)
+{
+    if (Count <= 0 || Size <= 0 || Start.Position < 0)
     {
-        return FRollResult(TEXT("Function not available"));
+        return false;
     }
     
-    int32 value;
-    ANSICHAR* desc;
-    ANSICHAR* error;
+    FRPGDiceStream Stream(static_cast<uint64>(Seed), FRPGDiceStream::HashStreamName(Start.Stream), static_cast<uint64>(Start.Position));
+    FRPGDiceEngine Engine(Stream);
+    
+    int64 Total = 0;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        Total += Engine.Roll(Size);
+    }
+    return Total == ExpectedTotal;
+}
+
+// Roller Interface Functions Implementation
+int32 URPGDiceSubsystem::RollerRoll(int32 Size)
+{
+    if (DiceBackend == ERPGDiceBackend::PooledCrypto)
+    {
+        return PopPooledFace(Size);
+    }
     
-    int32 success = D6CompleteFuncPtr(Count, &value, &desc, &error);
+    if (FRPGDiceEngine* Engine = GetNativeEngine())
+    {
+        return Engine->Roll(Size);
+    }
     
-    FRollResult Result;
-    Result.Value = value;
-    Result.Description = ConvertAndFreeString(desc);
-    Result.HasError = (success == 0);
-    Result.ErrorMessage = ConvertAndFreeString(error);
+    if (!IsSafeToCallFunction() || !Toolkit->RollerRoll || !DiceRollerPtr)
+    {
+        return -1;
+    }
     
-    return Result;
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitGameThreadCall);
+    return Toolkit->RollerRoll(DiceRollerPtr, Size);
 }
 
-FRollResult URPGDiceSubsystem::D8(int32 Count)
+TArray<int32> URPGDiceSubsystem::RollerRollN(int32 Count, int32 Size)
 {
-    if (!IsSafeToCallFunction() || !D8CompleteFuncPtr)
+    TArray<int32> Results;
+    
+    if (Count <= 0)
     {
-        return FRollResult(TEXT("Function not available"));
+        return Results;
     }
     
-    int32 value;
-    ANSICHAR* desc;
-    ANSICHAR* error;
-    
-    int32 success = D8CompleteFuncPtr(Count, &value, &desc, &error);
+    Results.SetNumUninitialized(Count);
+    int32 ReturnedCount = RollerRollN(Count, Size, Results.GetData());
     
-    FRollResult Result;
-    Result.Value = value;
-    Result.Description = ConvertAndFreeString(desc);
-    Result.HasError = (success == 0);
-    Result.ErrorMessage = ConvertAndFreeString(error);
+    if (ReturnedCount != Count)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RPGDiceSubsystem::RollerRollN: Expected %d results, got %d"), Count, ReturnedCount);
+        Results.Empty();
+    }
     
-    return Result;
+    return Results;
 }
 
-FRollResult URPGDiceSubsystem::D10(int32 Count)
+int32 URPGDiceSubsystem::RollerRollN(int32 Count, int32 Size, int32* OutResults)
 {
-    if (!IsSafeToCallFunction() || !D10CompleteFuncPtr)
+    if (Count <= 0 || !OutResults)
     {
-        return FRollResult(TEXT("Function not available"));
+        return -1;
     }
     
-    int32 value;
-    ANSICHAR* desc;
-    ANSICHAR* error;
+    // Bulk simulation path: vectorized kernel straight into the caller's buffer
+    if (DiceBackend == ERPGDiceBackend::NativeFast && NativeBulkGenerator.IsValid())
+    {
+        return NativeBulkGenerator->FillFaces(OutResults, Count, Size);
+    }
+    
+    if (DiceBackend == ERPGDiceBackend::PooledCrypto)
+    {
+        if (Size <= 0)
+        {
+            return -1;
+        }
+        
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            OutResults[Index] = PopPooledFace(Size);
+        }
+        return Count;
+    }
     
-    int32 success = D10CompleteFuncPtr(Count, &value, &desc, &error);
+    if (FRPGDiceEngine* Engine = GetNativeEngine())
+    {
+        return Engine->RollN(Count, Size, OutResults);
+    }
     
-    FRollResult Result;
-    Result.Value = value;
-    Result.Description = ConvertAndFreeString(desc);
-    Result.HasError = (success == 0);
-    Result.ErrorMessage = ConvertAndFreeString(error);
+    if (!IsSafeToCallFunction() || !Toolkit->RollerRollN || !DiceRollerPtr)
+    {
+        return -1;
+    }
     
-    return Result;
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitGameThreadCall);
+    return Toolkit->RollerRollN(DiceRollerPtr, Count, Size, OutResults);
+}
+
+// Legacy Roll Struct Functions (Deprecated - Use FRollResult functions instead)
+// These functions remain for backward compatibility but should not be used
+// New Blueprint code should use D4(), D6(), D8(), D10(), D12(), D20(), D100() functions
+
+// Helper Functions Implementation
+FRollResult URPGDiceSubsystem::D4(int32 Count)
+{
+    return RollDice(Count, 4);
+}
+
+FRollResult URPGDiceSubsystem::D6(int32 Count)
+{
+    return RollDice(Count, 6);
+}
+
+FRollResult URPGDiceSubsystem::D8(int32 Count)
+{
+    return RollDice(Count, 8);
+}
+
+FRollResult URPGDiceSubsystem::D10(int32 Count)
+{
+    return RollDice(Count, 10);
 }
 
 FRollResult URPGDiceSubsystem::D12(int32 Count)
 {
-    if (!IsSafeToCallFunction() || !D12CompleteFuncPtr)
+    return RollDice(Count, 12);
+}
+
+FRollResult URPGDiceSubsystem::D20(int32 Count)
+{
+    return RollDice(Count, 20);
+}
+
+FRollResult URPGDiceSubsystem::D100(int32 Count)
+{
+    return RollDice(Count, 100);
+}
+
+// Structured Rolls Implementation
+FRollResult URPGDiceSubsystem::RollDice(int32 Count, int32 Size)
+{
+    if (DiceBackend == ERPGDiceBackend::PooledCrypto)
+    {
+        return RollFromFaces([this](int32 FaceSize) { return PopPooledFace(FaceSize); }, Count, Size);
+    }
+    
+    if (FRPGDiceEngine* Engine = GetNativeEngine())
+    {
+        return RollNative(*Engine, Count, Size);
+    }
+    
+    if (!IsSafeToCallFunction())
     {
         return FRollResult(TEXT("Function not available"));
     }
     
-    int32 value;
-    ANSICHAR* desc;
-    ANSICHAR* error;
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitGameThreadCall);
+    return RollStructured(*Toolkit, Count, Size);
+}
+
+TFuture<FRollResult> URPGDiceSubsystem::RollDiceAsync(int32 Count, int32 Size, bool bBatchPerFrame)
+{
+    // Only the toolkit backend crosses CGO; everything else is cheap enough to answer now
+    if (DiceBackend != ERPGDiceBackend::Toolkit || !Executor)
+    {
+        return MakeFulfilledPromise<FRollResult>(RollDice(Count, Size)).GetFuture();
+    }
     
-    int32 success = D12CompleteFuncPtr(Count, &value, &desc, &error);
+    // The worker only touches the table the executor hands it, never this subsystem
+    return Executor->Submit<FRollResult>([Count, Size](const FRPGToolkitAPI& API)
+    {
+        return RollStructured(API, Count, Size);
+    }, bBatchPerFrame);
+}
+
+void URPGDiceSubsystem::RollDiceAsync(int32 Count, int32 Size, TUniqueFunction<void(FRollResult)> OnComplete, bool bBatchPerFrame)
+{
+    if (DiceBackend != ERPGDiceBackend::Toolkit || !Executor)
+    {
+        OnComplete(RollDice(Count, Size));
+        return;
+    }
     
+    // The continuation is dropped if the subsystem was torn down while the roll was in flight
+    TWeakObjectPtr<URPGDiceSubsystem> WeakThis(this);
+    Executor->SubmitThen<FRollResult>([Count, Size](const FRPGToolkitAPI& API)
+    {
+        return RollStructured(API, Count, Size);
+    }, [WeakThis, OnComplete = MoveTemp(OnComplete)](FRollResult Result) mutable
+    {
+        if (WeakThis.IsValid())
+        {
+            OnComplete(MoveTemp(Result));
+        }
+    }, bBatchPerFrame);
+}
+
+FRollResult URPGDiceSubsystem::RollNative(FRPGDiceEngine& Engine, int32 Count, int32 Size)
+{
+    return RollFromFaces([&Engine](int32 FaceSize) { return Engine.Roll(FaceSize); }, Count, Size);
+}
+
+FRollResult URPGDiceSubsystem::RollFromFaces(TFunctionRef<int32(int32 Size)> NextFace, int32 Count, int32 Size)
+{
     FRollResult Result;
-    Result.Value = value;
-    Result.Description = ConvertAndFreeString(desc);
-    Result.HasError = (success == 0);
-    Result.ErrorMessage = ConvertAndFreeString(error);
+    Result.DieCount = Count;
+    Result.DieSize = Size;
     
+    if (Count <= 0 || Size <= 0)
+    {
+        Result.HasError = true;
+        Result.Flags = RPGDiceRollFlags::InvalidSpec;
+        Result.ErrorMessage = TEXT("Invalid dice spec");
+        return Result;
+    }
+    
+    int32 Total = 0;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const int32 Face = NextFace(Size);
+        if (Index < FRollResult::MaxInlineFaces)
+        {
+            Result.Faces[Index] = Face;
+        }
+        Total += Face;
+    }
+    
+    Result.Value = Total;
+    Result.NumFaces = FMath::Min(Count, FRollResult::MaxInlineFaces);
+    Result.Flags = Count > FRollResult::MaxInlineFaces ? RPGDiceRollFlags::FacesTruncated : RPGDiceRollFlags::None;
     return Result;
 }
 
-FRollResult URPGDiceSubsystem::D20(int32 Count)
+FRollResult URPGDiceSubsystem::RollStructured(const FRPGToolkitAPI& API, int32 Count, int32 Size)
 {
-    if (!IsSafeToCallFunction() || !D20CompleteFuncPtr)
+    // Older toolkit builds only have the string-based exports
+    if (!API.DiceRollStructured)
     {
-        return FRollResult(TEXT("Function not available"));
+        return RollComplete(API, Count, Size);
     }
     
-    int32 value;
-    ANSICHAR* desc;
-    ANSICHAR* error;
-    
-    int32 success = D20CompleteFuncPtr(Count, &value, &desc, &error);
-    
     FRollResult Result;
-    Result.Value = value;
-    Result.Description = ConvertAndFreeString(desc);
-    Result.HasError = (success == 0);
-    Result.ErrorMessage = ConvertAndFreeString(error);
+    Result.DieCount = Count;
+    Result.DieSize = Size;
+    Result.Flags = API.DiceRollStructured(Count, Size, Result.Faces, FRollResult::MaxInlineFaces, &Result.Value);
+    Result.NumFaces = FMath::Clamp(Count, 0, FRollResult::MaxInlineFaces);
+    
+    if (Result.Flags & RPGDiceRollFlags::InvalidSpec)
+    {
+        Result.HasError = true;
+        Result.NumFaces = 0;
+        Result.ErrorMessage = TEXT("Invalid dice spec");
+    }
+    else if (Result.Flags & RPGDiceRollFlags::RollError)
+    {
+        Result.HasError = true;
+        Result.NumFaces = 0;
+        Result.ErrorMessage = TEXT("Roll failed");
+    }
     
     return Result;
 }
 
-FRollResult URPGDiceSubsystem::D100(int32 Count)
+FRollResult URPGDiceSubsystem::RollComplete(const FRPGToolkitAPI& API, int32 Count, int32 Size)
 {
-    if (!IsSafeToCallFunction() || !D100CompleteFuncPtr)
+    FRPGToolkitAPI::D20CompleteFunc CompleteFunc = nullptr;
+    switch (Size)
+    {
+        case 4: CompleteFunc = API.D4Complete; break;
+        case 6: CompleteFunc = API.D6Complete; break;
+        case 8: CompleteFunc = API.D8Complete; break;
+        case 10: CompleteFunc = API.D10Complete; break;
+        case 12: CompleteFunc = API.D12Complete; break;
+        case 20: CompleteFunc = API.D20Complete; break;
+        case 100: CompleteFunc = API.D100Complete; break;
+        default: break;
+    }
+    
+    if (!CompleteFunc)
     {
         return FRollResult(TEXT("Function not available"));
     }
@@ -278,113 +616,920 @@ FRollResult URPGDiceSubsystem::D100(int32 Count)
     ANSICHAR* desc;
     ANSICHAR* error;
     
-    int32 success = D100CompleteFuncPtr(Count, &value, &desc, &error);
+    int32 success = CompleteFunc(Count, &value, &desc, &error);
     
     FRollResult Result;
     Result.Value = value;
-    Result.Description = ConvertAndFreeString(desc);
+    Result.DieCount = Count;
+    Result.DieSize = Size;
+    Result.Description = ConvertAndFreeString(API, desc);
     Result.HasError = (success == 0);
-    Result.ErrorMessage = ConvertAndFreeString(error);
+    Result.ErrorMessage = ConvertAndFreeString(API, error);
+    Result.Flags = Result.HasError ? RPGDiceRollFlags::RollError : RPGDiceRollFlags::None;
     
     return Result;
 }
 
-
-
-// Toolkit Status
-bool URPGDiceSubsystem::IsToolkitLoaded() const
+FString URPGDiceSubsystem::GetRollDescription(const FRollResult& Roll)
 {
-    return bFunctionsLoaded;
+    return Roll.GetDescription();
 }
 
-// Private Implementation
-void URPGDiceSubsystem::LoadDLLFunctions()
+TArray<int32> URPGDiceSubsystem::GetRollFaces(const FRollResult& Roll)
 {
-    // Use proper UE binary directory (following established pattern)
-    FString BinariesDir = FPaths::Combine(FPaths::ProjectDir(), TEXT("Binaries"), FPlatformProcess::GetBinariesSubdirectory());
-    FString LibraryPath = FPaths::Combine(BinariesDir, TEXT("rpg_toolkit.dll"));
-    LibraryPath = FPaths::ConvertRelativePathToFull(LibraryPath);
+    return TArray<int32>(Roll.Faces, FMath::Clamp(Roll.NumFaces, 0, FRollResult::MaxInlineFaces));
+}
 
-    UE_LOG(LogTemp, Warning, TEXT("RPGDiceSubsystem: Attempting to load DLL from: %s"), *LibraryPath);
+FString FRollResult::GetDescription() const
+{
+    // Legacy string path (or a caller-supplied description)
+    if (!Description.IsEmpty() || HasError || NumFaces <= 0 || DieSize <= 0)
+    {
+        return Description;
+    }
+    
+    // Same layout as the toolkit's Roll.GetDescription: "+d20[15]=15", "+2d6[3,4]=7"
+    TStringBuilder<128> Builder;
+    Builder << TEXT('+');
+    if (DieCount > 1)
+    {
+        Builder << DieCount;
+    }
+    Builder << TEXT('d') << DieSize << TEXT('[');
+    
+    const int32 FaceCount = FMath::Min(NumFaces, MaxInlineFaces);
+    for (int32 Index = 0; Index < FaceCount; ++Index)
+    {
+        if (Index > 0)
+        {
+            Builder << TEXT(',');
+        }
+        Builder << Faces[Index];
+    }
+    if (Flags & RPGDiceRollFlags::FacesTruncated)
+    {
+        Builder << TEXT(",...");
+    }
+    Builder << TEXT("]=") << Value;
+    
+    return FString(Builder.ToView());
+}
 
-    // Check if the DLL exists
-    if (!FPaths::FileExists(LibraryPath))
+// Dice Expressions Implementation
+FRPGDiceExpressionHandle URPGDiceSubsystem::CompileDiceExpression(const FString& Notation, FString& OutError)
+{
+    FRPGDiceExpressionHandle Handle;
+    Handle.Generation = ExpressionCacheGeneration;
+    OutError.Reset();
+    
+    if (const int32* CachedIndex = ExpressionCache.Find(Notation))
     {
-        UE_LOG(LogTemp, Error, TEXT("RPGDiceSubsystem: DLL not found at path: %s"), *LibraryPath);
-        return;
+        Handle.Index = *CachedIndex;
+        return Handle;
+    }
+    
+    FRPGDiceExpression Expression;
+    if (!FRPGDiceExpression::Compile(Notation, Expression, OutError))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RPGDiceSubsystem::CompileDiceExpression: '%s' - %s"), *Notation, *OutError);
+        return Handle;
     }
+    
+    Handle.Index = CompiledExpressions.Add(MoveTemp(Expression));
+    ExpressionCache.Add(Notation, Handle.Index);
+    return Handle;
+}
 
-    // Load the DLL
-    ToolkitDLLHandle = FPlatformProcess::GetDllHandle(*LibraryPath);
-    if (!ToolkitDLLHandle)
+const FRPGDiceExpression* URPGDiceSubsystem::FindCompiledExpression(const FRPGDiceExpressionHandle& Handle) const
+{
+    if (Handle.Generation != ExpressionCacheGeneration || !CompiledExpressions.IsValidIndex(Handle.Index))
     {
-        UE_LOG(LogTemp, Error, TEXT("RPGDiceSubsystem: Failed to load DLL"));
-        return;
+        return nullptr;
+    }
+    return &CompiledExpressions[Handle.Index];
+}
+
+FRollResult URPGDiceSubsystem::EvaluateCompiled(const FRPGDiceExpressionHandle& Handle)
+{
+    const FRPGDiceExpression* Expression = FindCompiledExpression(Handle);
+    if (!Expression)
+    {
+        return FRollResult(TEXT("Invalid or stale dice expression handle"));
+    }
+    
+    return EvaluateExpression(*Expression);
+}
+
+FRollResult URPGDiceSubsystem::RollDiceExpression(const FString& Notation)
+{
+    FString Error;
+    const FRPGDiceExpressionHandle Handle = CompileDiceExpression(Notation, Error);
+    if (!Handle.IsValid())
+    {
+        return FRollResult(Error);
+    }
+    
+    return EvaluateCompiled(Handle);
+}
+
+void URPGDiceSubsystem::ClearDiceExpressionCache()
+{
+    CompiledExpressions.Reset();
+    ExpressionCache.Reset();
+    ++ExpressionCacheGeneration;
+}
+
+FRollResult URPGDiceSubsystem::EvaluateExpression(const FRPGDiceExpression& Expression)
+{
+    FRollResult Result;
+    Result.DieCount = Expression.GetTotalDice();
+    
+    // Single-term expressions keep the "+NdS[...]" description format
+    const TArray<FRPGDiceOp>& Ops = Expression.GetOps();
+    if (Ops.Num() == 1 && Ops[0].Code == ERPGDiceOpCode::Dice && Ops[0].Keep == ERPGDiceKeepMode::None && Ops[0].Sign > 0)
+    {
+        Result.DieSize = Ops[0].Size;
+    }
+    
+    auto RollFaces = [this](int32* OutFaces, int32 Count, int32 Size)
+    {
+        return RollerRollN(Count, Size, OutFaces) == Count;
+    };
+    
+    if (!Expression.Evaluate(RollFaces, Result.Value, Result.Faces, FRollResult::MaxInlineFaces, &Result.NumFaces))
+    {
+        Result.HasError = true;
+        Result.Flags = RPGDiceRollFlags::RollError;
+        Result.NumFaces = 0;
+        Result.ErrorMessage = TEXT("Roll failed");
+        return Result;
+    }
+    
+    if (Result.DieCount > FRollResult::MaxInlineFaces)
+    {
+        Result.Flags |= RPGDiceRollFlags::FacesTruncated;
     }
+    
+    return Result;
+}
 
-    UE_LOG(LogTemp, Warning, TEXT("RPGDiceSubsystem: Successfully loaded DLL"));
-    
-    // Load Roller interface functions
-    CreateCryptoRollerFuncPtr = (CreateCryptoRollerFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("CreateCryptoRoller"));
-    RollerRollFuncPtr = (RollerRollFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("RollerRoll"));
-    RollerRollNFuncPtr = (RollerRollNFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("RollerRollN"));
-    GetDefaultRollerFuncPtr = (GetDefaultRollerFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("GetDefaultRoller"));
-    SetDefaultRollerFuncPtr = (SetDefaultRollerFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("SetDefaultRoller"));
-    
-    // Load Roll struct functions
-    CreateRollFuncPtr = (CreateRollFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("CreateRoll"));
-    CreateRollWithRollerFuncPtr = (CreateRollWithRollerFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("CreateRollWithRoller"));
-    RollGetValueFuncPtr = (RollGetValueFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("RollGetValue"));
-    RollGetDescriptionFuncPtr = (RollGetDescriptionFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("RollGetDescription"));
-    RollHasErrorFuncPtr = (RollHasErrorFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("RollHasError"));
-    RollGetErrorFuncPtr = (RollGetErrorFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("RollGetError"));
-    
-    // Load automatic cleanup helper functions
-    D4CompleteFuncPtr = (D4CompleteFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("D4Complete"));
-    D6CompleteFuncPtr = (D6CompleteFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("D6Complete"));
-    D8CompleteFuncPtr = (D8CompleteFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("D8Complete"));
-    D10CompleteFuncPtr = (D10CompleteFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("D10Complete"));
-    D12CompleteFuncPtr = (D12CompleteFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("D12Complete"));
-    D20CompleteFuncPtr = (D20CompleteFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("D20Complete"));
-    D100CompleteFuncPtr = (D100CompleteFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("D100Complete"));
-    
-    // Load legacy functions
-    CreateDiceRollerFuncPtr = (CreateDiceRollerFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("CreateDiceRoller"));
-    RollDieFuncPtr = (RollDieFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("RollDie"));
-    FreeStringFuncPtr = (FreeStringFunc)FPlatformProcess::GetDllExport(ToolkitDLLHandle, TEXT("FreeString"));
+// Exact Probabilities Implementation
+TSharedPtr<const FRPGDiceDistribution> URPGDiceSubsystem::FindOrComputeDistribution(const FString& Notation, ERPGEventModifier RollModifier, FString* OutError)
+{
+    // Only advantage/disadvantage change the distribution
+    if (RollModifier != ERPGEventModifier::Advantage && RollModifier != ERPGEventModifier::Disadvantage)
+    {
+        RollModifier = ERPGEventModifier::None;
+    }
+    
+    const FString CacheKey = RollModifier == ERPGEventModifier::None ? Notation
+        : FString::Printf(TEXT("%s|%s"), *Notation, RollModifier == ERPGEventModifier::Advantage ? TEXT("adv") : TEXT("dis"));
+    
+    if (const TSharedPtr<const FRPGDiceDistribution>* Cached = DistributionCache.Find(CacheKey))
+    {
+        return *Cached;
+    }
+    
+    FString Error;
+    FRPGDiceExpression Expression;
+    TSharedRef<FRPGDiceDistribution> Distribution = MakeShared<FRPGDiceDistribution>();
+    
+    if (!FRPGDiceExpression::Compile(Notation, Expression, Error)
+        || !FRPGDiceDistribution::Compute(Expression, RollModifier, *Distribution, Error))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("RPGDiceSubsystem::FindOrComputeDistribution: '%s' - %s"), *Notation, *Error);
+        if (OutError)
+        {
+            *OutError = Error;
+        }
+        return nullptr;
+    }
+    
+    DistributionCache.Add(CacheKey, Distribution);
+    return Distribution;
+}
+
+double URPGDiceSubsystem::GetRollProbabilityAtLeast(const FString& Notation, int32 Target, ERPGEventModifier RollModifier)
+{
+    TSharedPtr<const FRPGDiceDistribution> Distribution = FindOrComputeDistribution(Notation, RollModifier);
+    return Distribution.IsValid() ? Distribution->GetProbabilityAtLeast(Target) : 0.0;
+}
+
+double URPGDiceSubsystem::GetRollProbabilityAtMost(const FString& Notation, int32 Target, ERPGEventModifier RollModifier)
+{
+    TSharedPtr<const FRPGDiceDistribution> Distribution = FindOrComputeDistribution(Notation, RollModifier);
+    return Distribution.IsValid() ? Distribution->GetProbabilityAtMost(Target) : 0.0;
+}
+
+double URPGDiceSubsystem::GetExpectedRollValue(const FString& Notation, ERPGEventModifier RollModifier)
+{
+    TSharedPtr<const FRPGDiceDistribution> Distribution = FindOrComputeDistribution(Notation, RollModifier);
+    return Distribution.IsValid() ? Distribution->GetMean() : 0.0;
+}
+
+bool URPGDiceSubsystem::GetRollDistribution(const FString& Notation, ERPGEventModifier RollModifier, TArray<int32>& OutValues, TArray<double>& OutProbabilities)
+{
+    OutValues.Reset();
+    OutProbabilities.Reset();
+    
+    TSharedPtr<const FRPGDiceDistribution> Distribution = FindOrComputeDistribution(Notation, RollModifier);
+    if (!Distribution.IsValid())
+    {
+        return false;
+    }
+    
+    OutProbabilities = Distribution->GetPMF();
+    OutValues.SetNumUninitialized(OutProbabilities.Num());
+    for (int32 Index = 0; Index < OutValues.Num(); ++Index)
+    {
+        OutValues[Index] = Distribution->GetMinValue() + Index;
+    }
+    return true;
+}
+
+// Batched Rolls Implementation
+TArray<FRollResult> URPGDiceSubsystem::RollBatch(const TArray<FDiceSpec>& Specs)
+{
+    TArray<FRollResult> Results;
+    
+    if (Specs.Num() == 0)
+    {
+        return Results;
+    }
+    
+    const int32 NumSpecs = Specs.Num();
+    
+    // Caller-owned buffers - the roller only writes values and flags into these
+    TArray<FRPGDiceSpecPacked, TInlineAllocator<64>> PackedSpecs;
+    TArray<int32, TInlineAllocator<64>> Values;
+    TArray<int32, TInlineAllocator<64>> Flags;
+    PackedSpecs.SetNumUninitialized(NumSpecs);
+    Values.SetNumUninitialized(NumSpecs);
+    Flags.SetNumUninitialized(NumSpecs);
+    
+    for (int32 Index = 0; Index < NumSpecs; ++Index)
+    {
+        PackedSpecs[Index] = { Specs[Index].Count, Specs[Index].Size, Specs[Index].Modifier };
+    }
+    
+    const bool bRolled = RollBatch(PackedSpecs.GetData(), NumSpecs, Values.GetData(), Flags.GetData()) >= 0;
+    
+    Results.SetNum(NumSpecs);
+    for (int32 Index = 0; Index < NumSpecs; ++Index)
+    {
+        FRollResult& Result = Results[Index];
+        Result.DieCount = Specs[Index].Count;
+        Result.DieSize = Specs[Index].Size;
+        
+        if (!bRolled)
+        {
+            Result.HasError = true;
+            Result.Flags = RPGDiceRollFlags::RollError;
+            Result.ErrorMessage = TEXT("Function not available");
+            continue;
+        }
+        
+        // Batch flag bits share their values with RPGDiceRollFlags; batches return totals only, so no faces
+        Result.Value = Values[Index];
+        Result.Flags = Flags[Index];
+        Result.HasError = Flags[Index] != RPGDiceBatchFlags::None;
+        
+        if (Flags[Index] & RPGDiceBatchFlags::InvalidSpec)
+        {
+            Result.ErrorMessage = TEXT("Invalid dice spec");
+        }
+        else if (Flags[Index] & RPGDiceBatchFlags::RollError)
+        {
+            Result.ErrorMessage = TEXT("Roll failed");
+        }
+    }
+    
+    return Results;
+}
+
+int32 URPGDiceSubsystem::RollBatch(const FRPGDiceSpecPacked* Specs, int32 NumSpecs, int32* OutValues, int32* OutFlags)
+{
+    if (!Specs || !OutValues || !OutFlags)
+    {
+        return -1;
+    }
+    
+    if (NumSpecs <= 0)
+    {
+        return 0;
+    }
+    
+    // In-process backends roll the batch here, with the same value/flag contract as the toolkit export
+    FRPGDiceEngine* Engine = GetNativeEngine();
+    if (Engine || DiceBackend == ERPGDiceBackend::PooledCrypto)
+    {
+        int32 Succeeded = 0;
+        for (int32 Index = 0; Index < NumSpecs; ++Index)
+        {
+            const FRPGDiceSpecPacked& Spec = Specs[Index];
+            if (Spec.Count <= 0 || Spec.Size <= 0)
+            {
+                OutValues[Index] = -1;
+                OutFlags[Index] = RPGDiceBatchFlags::InvalidSpec;
+                continue;
+            }
+            
+            int32 Total = Spec.Modifier;
+            for (int32 Die = 0; Die < Spec.Count; ++Die)
+            {
+                Total += Engine ? Engine->Roll(Spec.Size) : PopPooledFace(Spec.Size);
+            }
+            OutValues[Index] = Total;
+            OutFlags[Index] = RPGDiceBatchFlags::None;
+            ++Succeeded;
+        }
+        return Succeeded;
+    }
+    
+    if (!IsSafeToCallFunction() || !Toolkit->RollBatch)
+    {
+        return -1;
+    }
+    
+    SCOPE_CYCLE_COUNTER(STAT_RPGToolkitGameThreadCall);
+    return Toolkit->RollBatch(Specs, NumSpecs, OutValues, OutFlags);
+}
+
+#if !UE_BUILD_SHIPPING
+// Benchmarks
+FString URPGDiceSubsystem::BenchmarkRollBatch(int32 NumRolls)
+{
+    if (!IsSafeToCallFunction() || !Toolkit->D20Complete || !Toolkit->RollBatch || NumRolls <= 0)
+    {
+        return TEXT("BenchmarkRollBatch: toolkit functions not available");
+    }
+    
+    // Baseline: one CGO transition plus two CString allocations per roll
+    const double SingleStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        int32 Value;
+        ANSICHAR* Desc = nullptr;
+        ANSICHAR* Error = nullptr;
+        Toolkit->D20Complete(1, &Value, &Desc, &Error);
+        
+        if (Toolkit->FreeString)
+        {
+            Toolkit->FreeString(Desc);
+            Toolkit->FreeString(Error);
+        }
+    }
+    const double SingleSeconds = FPlatformTime::Seconds() - SingleStart;
+    
+    // Batched: one CGO transition for all rolls
+    TArray<FRPGDiceSpecPacked> Specs;
+    TArray<int32> Values;
+    TArray<int32> Flags;
+    Specs.Init({ 1, 20, 0 }, NumRolls);
+    Values.SetNumUninitialized(NumRolls);
+    Flags.SetNumUninitialized(NumRolls);
+    
+    const double BatchStart = FPlatformTime::Seconds();
+    Toolkit->RollBatch(Specs.GetData(), NumRolls, Values.GetData(), Flags.GetData());
+    const double BatchSeconds = FPlatformTime::Seconds() - BatchStart;
+    
+    FString Summary = FString::Printf(TEXT("%d x D20Complete: %.3f ms (%.2f us/roll) | RollBatch(%d): %.3f ms (%.2f us/roll) | speedup %.1fx"),
+        NumRolls, SingleSeconds * 1000.0, SingleSeconds * 1000000.0 / NumRolls,
+        NumRolls, BatchSeconds * 1000.0, BatchSeconds * 1000000.0 / NumRolls,
+        BatchSeconds > 0.0 ? SingleSeconds / BatchSeconds : 0.0);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem::BenchmarkRollBatch: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGDiceSubsystem::BenchmarkStructuredRolls(int32 NumRolls)
+{
+    if (!IsSafeToCallFunction() || !Toolkit->D20Complete || !Toolkit->DiceRollStructured || NumRolls <= 0)
+    {
+        return TEXT("BenchmarkStructuredRolls: toolkit functions not available");
+    }
+    
+    // Baseline: description and error strings allocated in Go, converted and freed per roll
+    int64 StringChecksum = 0;
+    const double StringStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        FRollResult Roll = RollComplete(*Toolkit, 1, 20);
+        StringChecksum += Roll.Value;
+    }
+    const double StringSeconds = FPlatformTime::Seconds() - StringStart;
+    
+    // Structured: faces and total written into the inline buffer
+    int64 StructuredChecksum = 0;
+    const double StructuredStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        FRollResult Roll = RollStructured(*Toolkit, 1, 20);
+        StructuredChecksum += Roll.Value;
+    }
+    const double StructuredSeconds = FPlatformTime::Seconds() - StructuredStart;
+    
+    FString Summary = FString::Printf(TEXT("%d x D20Complete: %.3f ms (%.2f us/roll) | %d x DiceRollStructured: %.3f ms (%.2f us/roll) | speedup %.1fx (checksums %lld/%lld)"),
+        NumRolls, StringSeconds * 1000.0, StringSeconds * 1000000.0 / NumRolls,
+        NumRolls, StructuredSeconds * 1000.0, StructuredSeconds * 1000000.0 / NumRolls,
+        StructuredSeconds > 0.0 ? StringSeconds / StructuredSeconds : 0.0,
+        StringChecksum, StructuredChecksum);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem::BenchmarkStructuredRolls: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGDiceSubsystem::BenchmarkDiceBackends(int32 NumRolls)
+{
+    if (NumRolls <= 0 || !NativeCryptoEngine.IsValid() || !NativeFastEngine.IsValid())
+    {
+        return TEXT("BenchmarkDiceBackends: invalid roll count or native engines not created");
+    }
+    
+    TArray<int32> Buffer;
+    Buffer.SetNumUninitialized(NumRolls);
+    
+    TArray<FString> Lines;
+    auto Report = [&Lines, NumRolls](const TCHAR* Label, double Seconds)
+    {
+        const double RollsPerSecond = Seconds > 0.0 ? NumRolls / Seconds : 0.0;
+        Lines.Add(FString::Printf(TEXT("%s: %.3f ms (%.2f M rolls/s)"), Label, Seconds * 1000.0, RollsPerSecond / 1000000.0));
+    };
+    
+    // Toolkit (Go) - one CGO call per roll, then one call for the whole block
+    if (IsSafeToCallFunction() && Toolkit->RollerRoll && Toolkit->RollerRollN && DiceRollerPtr)
+    {
+        double Start = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < NumRolls; ++Index)
+        {
+            Buffer[Index] = Toolkit->RollerRoll(DiceRollerPtr, 20);
+        }
+        Report(TEXT("Toolkit RollerRoll"), FPlatformTime::Seconds() - Start);
+        
+        Start = FPlatformTime::Seconds();
+        Toolkit->RollerRollN(DiceRollerPtr, NumRolls, 20, Buffer.GetData());
+        Report(TEXT("Toolkit RollerRollN"), FPlatformTime::Seconds() - Start);
+    }
+    else
+    {
+        Lines.Add(TEXT("Toolkit: not available"));
+    }
+    
+    // Native engines
+    for (FRPGDiceEngine* Engine : { NativeCryptoEngine.Get(), NativeFastEngine.Get() })
+    {
+        double Start = FPlatformTime::Seconds();
+        for (int32 Index = 0; Index < NumRolls; ++Index)
+        {
+            Buffer[Index] = Engine->Roll(20);
+        }
+        Report(*FString::Printf(TEXT("Native %s Roll"), Engine->GetGeneratorName()), FPlatformTime::Seconds() - Start);
+        
+        Start = FPlatformTime::Seconds();
+        Engine->RollN(NumRolls, 20, Buffer.GetData());
+        Report(*FString::Printf(TEXT("Native %s RollN"), Engine->GetGeneratorName()), FPlatformTime::Seconds() - Start);
+    }
+    
+    FString Summary = FString::Printf(TEXT("%d x d20 | %s"), NumRolls, *FString::Join(Lines, TEXT(" | ")));
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem::BenchmarkDiceBackends: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGDiceSubsystem::BenchmarkDiceExpressions(const FString& Notation, int32 NumRolls)
+{
+    if (NumRolls <= 0)
+    {
+        return TEXT("BenchmarkDiceExpressions: NumRolls must be positive");
+    }
+    
+    FString Error;
+    FRPGDiceExpression Expression;
+    if (!FRPGDiceExpression::Compile(Notation, Expression, Error))
+    {
+        return FString::Printf(TEXT("BenchmarkDiceExpressions: '%s' - %s"), *Notation, *Error);
+    }
+    
+    // Time parsing/evaluation only, not the dice source
+    FRPGDiceEngine Engine(MakeUnique<FRPGFastDiceGenerator>());
+    auto RollFaces = [&Engine](int32* OutFaces, int32 Count, int32 Size)
+    {
+        return Engine.RollN(Count, Size, OutFaces) == Count;
+    };
+    
+    int64 ParsedChecksum = 0;
+    const double ParseStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        FRPGDiceExpression Parsed;
+        FRPGDiceExpression::Compile(Notation, Parsed, Error);
+        int32 Total = 0;
+        Parsed.Evaluate(RollFaces, Total);
+        ParsedChecksum += Total;
+    }
+    const double ParseSeconds = FPlatformTime::Seconds() - ParseStart;
+    
+    int64 CompiledChecksum = 0;
+    const double CompiledStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        int32 Total = 0;
+        Expression.Evaluate(RollFaces, Total);
+        CompiledChecksum += Total;
+    }
+    const double CompiledSeconds = FPlatformTime::Seconds() - CompiledStart;
+    
+    FString Summary = FString::Printf(TEXT("'%s' x %d | parse+evaluate: %.3f ms (%.3f us/roll) | compiled: %.3f ms (%.3f us/roll) | speedup %.1fx (checksums %lld/%lld)"),
+        *Notation, NumRolls,
+        ParseSeconds * 1000.0, ParseSeconds * 1000000.0 / NumRolls,
+        CompiledSeconds * 1000.0, CompiledSeconds * 1000000.0 / NumRolls,
+        CompiledSeconds > 0.0 ? ParseSeconds / CompiledSeconds : 0.0,
+        ParsedChecksum, CompiledChecksum);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem::BenchmarkDiceExpressions: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGDiceSubsystem::BenchmarkDiceDistribution(const FString& Notation, int32 Target, int32 NumSamples)
+{
+    if (NumSamples <= 0)
+    {
+        return TEXT("BenchmarkDiceDistribution: NumSamples must be positive");
+    }
+    
+    FString Error;
+    FRPGDiceExpression Expression;
+    if (!FRPGDiceExpression::Compile(Notation, Expression, Error))
+    {
+        return FString::Printf(TEXT("BenchmarkDiceDistribution: '%s' - %s"), *Notation, *Error);
+    }
+    
+    // Exact: first computation (uncached), then a cached query
+    FRPGDiceDistribution Distribution;
+    const double ComputeStart = FPlatformTime::Seconds();
+    if (!FRPGDiceDistribution::Compute(Expression, ERPGEventModifier::None, Distribution, Error))
+    {
+        return FString::Printf(TEXT("BenchmarkDiceDistribution: '%s' - %s"), *Notation, *Error);
+    }
+    const double ComputeSeconds = FPlatformTime::Seconds() - ComputeStart;
+    
+    FindOrComputeDistribution(Notation, ERPGEventModifier::None);
+    const double QueryStart = FPlatformTime::Seconds();
+    const double ExactProbability = GetRollProbabilityAtLeast(Notation, Target);
+    const double QuerySeconds = FPlatformTime::Seconds() - QueryStart;
+    
+    // Sampling on the fast native engine
+    FRPGDiceEngine Engine(MakeUnique<FRPGFastDiceGenerator>(FPlatformTime::Cycles64()));
+    auto RollFaces = [&Engine](int32* OutFaces, int32 Count, int32 Size)
+    {
+        return Engine.RollN(Count, Size, OutFaces) == Count;
+    };
+    
+    int32 Hits = 0;
+    const double SampleStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        int32 Total = 0;
+        Expression.Evaluate(RollFaces, Total);
+        Hits += Total >= Target ? 1 : 0;
+    }
+    const double SampleSeconds = FPlatformTime::Seconds() - SampleStart;
+    const double SampledProbability = static_cast<double>(Hits) / NumSamples;
+    
+    FString Summary = FString::Printf(TEXT("P(%s >= %d) exact %.6f (compute %.3f us, cached query %.3f us) | sampled %.6f from %d rolls (%.3f ms) | mean %.4f, variance %.4f"),
+        *Notation, Target, ExactProbability, ComputeSeconds * 1000000.0, QuerySeconds * 1000000.0,
+        SampledProbability, NumSamples, SampleSeconds * 1000.0, Distribution.GetMean(), Distribution.GetVariance());
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem::BenchmarkDiceDistribution: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGDiceSubsystem::CheckSeededReplay(int64 Seed, int32 NumRolls)
+{
+    if (NumRolls <= 0)
+    {
+        return TEXT("CheckSeededReplay: NumRolls must be positive");
+    }
+    
+    TArray<FString> Failures;
+    
+    // Philox4x32-10 known-answer test (Random123: counter = 0, key = 0)
+    {
+        const uint32 Counter[4] = { 0, 0, 0, 0 };
+        const uint32 Key[2] = { 0, 0 };
+        uint32 Out[4];
+        FRPGDiceStream::PhiloxBlock(Counter, Key, Out);
+        if (Out[0] != 0x6627e8d5u || Out[1] != 0xe169c58du || Out[2] != 0xbc57ac4cu || Out[3] != 0x9b00dbd8u)
+        {
+            Failures.Add(TEXT("Philox known-answer mismatch"));
+        }
+    }
+    
+    const FName StreamA(TEXT("Replay.Attacker"));
+    const FName StreamB(TEXT("Replay.Defender"));
+    
+    // Run on a scratch session and restore the caller's streams afterwards
+    const int64 PreviousSeed = SeededSessionSeed;
+    TMap<FName, TSharedPtr<FRPGDiceStream>> PreviousStreams = MoveTemp(SeededStreams);
+    TSharedPtr<FRPGDiceEngine> PreviousEngine = MoveTemp(SeededEngine);
+    
+    // Record: interleave two streams with mixed die sizes
+    SetSeededSession(Seed);
+    TArray<FRollResult> RecordedA;
+    TArray<FRollResult> RecordedB;
+    TArray<FRPGDiceStreamPosition> StartsA;
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        FRPGDiceStreamPosition Start;
+        RecordedA.Add(RollOnStream(StreamA, 1 + Index % 3, 20, Start));
+        StartsA.Add(Start);
+        RecordedB.Add(RollOnStream(StreamB, 2, 6 + Index % 7, Start));
+    }
+    
+    // Replay: fresh session, streams in the opposite order - results must not depend on interleaving
+    SetSeededSession(Seed);
+    int32 Mismatches = 0;
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        FRPGDiceStreamPosition Start;
+        Mismatches += RollOnStream(StreamB, 2, 6 + Index % 7, Start).Value != RecordedB[Index].Value ? 1 : 0;
+    }
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        FRPGDiceStreamPosition Start;
+        Mismatches += RollOnStream(StreamA, 1 + Index % 3, 20, Start).Value != RecordedA[Index].Value ? 1 : 0;
+    }
+    if (Mismatches > 0)
+    {
+        Failures.Add(FString::Printf(TEXT("%d replayed rolls differ"), Mismatches));
+    }
+    
+    // O(1) seek: jump straight to the middle roll and reproduce it
+    const int32 Middle = NumRolls / 2;
+    SeekStream(StartsA[Middle]);
+    FRPGDiceStreamPosition Ignored;
+    if (RollOnStream(StreamA, 1 + Middle % 3, 20, Ignored).Value != RecordedA[Middle].Value)
+    {
+        Failures.Add(TEXT("Seek did not reproduce the recorded roll"));
+    }
+    
+    // Server-side validation from (seed, stream, position) and a tampered total
+    int32 Rejected = 0;
+    int32 Accepted = 0;
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        const int32 Count = 1 + Index % 3;
+        Accepted += VerifySeededRoll(Seed, StartsA[Index], Count, 20, RecordedA[Index].Value) ? 1 : 0;
+        Rejected += VerifySeededRoll(Seed, StartsA[Index], Count, 20, RecordedA[Index].Value + 1) ? 0 : 1;
+    }
+    if (Accepted != NumRolls || Rejected != NumRolls)
+    {
+        Failures.Add(FString::Printf(TEXT("Verification accepted %d/%d genuine and rejected %d/%d tampered rolls"), Accepted, NumRolls, Rejected, NumRolls));
+    }
+    
+    // A different seed must give a different sequence
+    SetSeededSession(Seed + 1);
+    int32 SameUnderOtherSeed = 0;
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        FRPGDiceStreamPosition Start;
+        SameUnderOtherSeed += RollOnStream(StreamA, 1 + Index % 3, 20, Start).Value == RecordedA[Index].Value ? 1 : 0;
+    }
+    if (SameUnderOtherSeed == NumRolls)
+    {
+        Failures.Add(TEXT("Changing the seed did not change the rolls"));
+    }
+    
+    SeededSessionSeed = PreviousSeed;
+    SeededStreams = MoveTemp(PreviousStreams);
+    SeededEngine = MoveTemp(PreviousEngine);
+    
+    FString Summary = Failures.Num() == 0
+        ? FString::Printf(TEXT("PASS: %d rolls on 2 streams replayed, seeked and verified (seed %lld)"), NumRolls, Seed)
+        : FString::Printf(TEXT("FAIL: %s"), *FString::Join(Failures, TEXT("; ")));
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem::CheckSeededReplay: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGDiceSubsystem::CheckBulkRollUniformity(int32 NumRolls, int32 Size)
+{
+    if (NumRolls <= 0 || Size < 2 || Size > 100000)
+    {
+        return TEXT("CheckBulkRollUniformity: NumRolls must be positive and Size in 2..100000");
+    }
+    
+    using EKernel = FRPGDiceBulkGenerator::EKernel;
+    const uint64 Seed = FPlatformTime::Cycles64();
+    
+    TArray<int32> Faces;
+    Faces.SetNumUninitialized(NumRolls);
+    FRPGDiceBulkGenerator Generator(Seed);
+    Generator.FillFaces(Faces.GetData(), NumRolls, Size);
+    
+    // Range check and face histogram
+    TArray<int64> Counts;
+    Counts.SetNumZeroed(Size);
+    int64 OutOfRange = 0;
+    for (int32 Face : Faces)
+    {
+        if (Face < 1 || Face > Size)
+        {
+            ++OutOfRange;
+            continue;
+        }
+        ++Counts[Face - 1];
+    }
+    
+    // Pearson chi-square against the uniform distribution
+    const double Expected = static_cast<double>(NumRolls) / Size;
+    double ChiSquare = 0.0;
+    for (int64 Count : Counts)
+    {
+        const double Delta = static_cast<double>(Count) - Expected;
+        ChiSquare += Delta * Delta / Expected;
+    }
+    
+    // Critical value at p = 0.001 (Wilson-Hilferty approximation)
+    const double DegreesOfFreedom = Size - 1;
+    const double Z = 3.090;
+    const double Term = 2.0 / (9.0 * DegreesOfFreedom);
+    const double Critical = DegreesOfFreedom * FMath::Pow(1.0 - Term + Z * FMath::Sqrt(Term), 3.0);
+    
+    // Every compiled kernel must produce the same stream as the scalar reference
+    TArray<int32> Reference;
+    TArray<int32> Candidate;
+    const int32 CompareCount = FMath::Min(NumRolls, 1 << 16) + 3;
+    Reference.SetNumUninitialized(CompareCount);
+    Candidate.SetNumUninitialized(CompareCount);
+    FRPGDiceBulkGenerator(Seed).FillFacesWithKernel(EKernel::Scalar, Reference.GetData(), CompareCount, Size);
+    
+    bool bKernelsMatch = true;
+    for (EKernel Kernel : { EKernel::SSE2, EKernel::AVX2 })
+    {
+        if (FRPGDiceBulkGenerator::IsKernelAvailable(Kernel))
+        {
+            FRPGDiceBulkGenerator(Seed).FillFacesWithKernel(Kernel, Candidate.GetData(), CompareCount, Size);
+            bKernelsMatch &= (Candidate == Reference);
+        }
+    }
+    
+    const bool bPassed = OutOfRange == 0 && ChiSquare < Critical && bKernelsMatch;
+    FString Summary = FString::Printf(TEXT("%s: %d x d%d (%s kernel) chi2 = %.2f (critical %.2f, df %d), out of range %lld, kernels match: %s"),
+        bPassed ? TEXT("PASS") : TEXT("FAIL"), NumRolls, Size,
+        FRPGDiceBulkGenerator::GetKernelName(FRPGDiceBulkGenerator::GetBestKernel()),
+        ChiSquare, Critical, Size - 1, OutOfRange, bKernelsMatch ? TEXT("yes") : TEXT("no"));
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem::CheckBulkRollUniformity: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGDiceSubsystem::BenchmarkBulkRolls(int32 NumRolls)
+{
+    if (NumRolls <= 0 || !NativeFastEngine.IsValid())
+    {
+        return TEXT("BenchmarkBulkRolls: invalid roll count or native engine not created");
+    }
+    
+    using EKernel = FRPGDiceBulkGenerator::EKernel;
+    
+    TArray<int32> Buffer;
+    Buffer.SetNumUninitialized(NumRolls);
+    
+    TArray<FString> Lines;
+    auto Report = [&Lines, NumRolls](const TCHAR* Label, double Seconds)
+    {
+        const double RollsPerSecond = Seconds > 0.0 ? NumRolls / Seconds : 0.0;
+        Lines.Add(FString::Printf(TEXT("%s: %.3f ms (%.1f M rolls/s)"), Label, Seconds * 1000.0, RollsPerSecond / 1000000.0));
+    };
+    
+    // Baseline: one-at-a-time native engine
+    double Start = FPlatformTime::Seconds();
+    NativeFastEngine->RollN(NumRolls, 20, Buffer.GetData());
+    Report(TEXT("Engine RollN"), FPlatformTime::Seconds() - Start);
+    
+    FRPGDiceBulkGenerator Generator(FPlatformTime::Cycles64());
+    for (EKernel Kernel : { EKernel::Scalar, EKernel::SSE2, EKernel::AVX2 })
+    {
+        if (FRPGDiceBulkGenerator::IsKernelAvailable(Kernel))
+        {
+            Start = FPlatformTime::Seconds();
+            Generator.FillFacesWithKernel(Kernel, Buffer.GetData(), NumRolls, 20);
+            Report(*FString::Printf(TEXT("Bulk %s"), FRPGDiceBulkGenerator::GetKernelName(Kernel)), FPlatformTime::Seconds() - Start);
+        }
+    }
+    
+    FString Summary = FString::Printf(TEXT("%d x d20 | %s"), NumRolls, *FString::Join(Lines, TEXT(" | ")));
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem::BenchmarkBulkRolls: %s"), *Summary);
+    return Summary;
+}
+
+FString URPGDiceSubsystem::BenchmarkRollPools(int32 NumRolls)
+{
+    if (NumRolls <= 0 || !NativeCryptoEngine.IsValid())
+    {
+        return TEXT("BenchmarkRollPools: invalid roll count or native engine not created");
+    }
+    
+    if (!RollPoolWorker.IsValid())
+    {
+        ConfigureRollPools();
+    }
+    
+    // Let the worker fill the pools so the timed loop measures the pop, not the fallback
+    const double WarmupDeadline = FPlatformTime::Seconds() + 0.5;
+    while (RollPoolWorker->GetPoolLevel(20) < RollPoolWorker->GetCapacity() && FPlatformTime::Seconds() < WarmupDeadline)
+    {
+        FPlatformProcess::Sleep(0.001f);
+    }
+    
+    const FRPGDiceRollPoolWorker::FStats Before = RollPoolWorker->GetStats();
+    
+    int64 PooledChecksum = 0;
+    double Start = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        PooledChecksum += PopPooledFace(20);
+    }
+    const double PooledSeconds = FPlatformTime::Seconds() - Start;
+    
+    const FRPGDiceRollPoolWorker::FStats After = RollPoolWorker->GetStats();
+    
+    int64 DirectChecksum = 0;
+    Start = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumRolls; ++Index)
+    {
+        DirectChecksum += NativeCryptoEngine->Roll(20);
+    }
+    const double DirectSeconds = FPlatformTime::Seconds() - Start;
+    
+    FString Summary = FString::Printf(TEXT("%d x d20 | Pooled: %.1f ns/roll (%lld hits, %lld misses) | Direct crypto: %.1f ns/roll | Speedup: %.1fx | Checksums: %lld/%lld"),
+        NumRolls,
+        PooledSeconds * 1e9 / NumRolls,
+        After.Hits - Before.Hits, After.Misses - Before.Misses,
+        DirectSeconds * 1e9 / NumRolls,
+        PooledSeconds > 0.0 ? DirectSeconds / PooledSeconds : 0.0,
+        PooledChecksum, DirectChecksum);
+    
+    UE_LOG(LogTemp, Log, TEXT("RPGDiceSubsystem::BenchmarkRollPools: %s"), *Summary);
+    return Summary;
+}
+#endif
+
+// Toolkit Status
+bool URPGDiceSubsystem::IsToolkitLoaded() const
+{
+    return bFunctionsLoaded;
+}
+
+// Private Implementation
+void URPGDiceSubsystem::BindToolkitFunctions()
+{
+    Toolkit = FRPGToolkitModule::Acquire(TEXT("RPGDiceSubsystem"));
+    if (!Toolkit)
+    {
+        UE_LOG(LogTemp, Error, TEXT("RPGDiceSubsystem: Toolkit DLL not available"));
+        return;
+    }
     
     // Check if critical functions were loaded
-    bool bCriticalFunctionsLoaded = (CreateCryptoRollerFuncPtr != nullptr) && 
-                                   (RollerRollFuncPtr != nullptr) && 
-                                   (CreateRollFuncPtr != nullptr) &&
-                                   (RollGetValueFuncPtr != nullptr) &&
-                                   (FreeStringFuncPtr != nullptr);
+    bool bCriticalFunctionsLoaded = (Toolkit->CreateCryptoRoller != nullptr) && 
+                                   (Toolkit->RollerRoll != nullptr) && 
+                                   (Toolkit->CreateRoll != nullptr) &&
+                                   (Toolkit->RollGetValue != nullptr) &&
+                                   (Toolkit->FreeString != nullptr);
     
     if (bCriticalFunctionsLoaded)
     {
         bFunctionsLoaded = true;
+        Executor = FRPGToolkitExecutor::Acquire(TEXT("RPGDiceSubsystem"));
         UE_LOG(LogTemp, Warning, TEXT("RPGDiceSubsystem: All critical dice functions loaded successfully"));
         
         // Log status of all functions
         UE_LOG(LogTemp, Log, TEXT("=== Dice Function Loading Status ==="));
         UE_LOG(LogTemp, Log, TEXT("Roller Functions:"));
-        UE_LOG(LogTemp, Log, TEXT("  CreateCryptoRoller: %s"), CreateCryptoRollerFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  RollerRoll: %s"), RollerRollFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  RollerRollN: %s"), RollerRollNFuncPtr ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  CreateCryptoRoller: %s"), Toolkit->CreateCryptoRoller ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  RollerRoll: %s"), Toolkit->RollerRoll ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  RollerRollN: %s"), Toolkit->RollerRollN ? TEXT("OK") : TEXT("FAILED"));
         
         UE_LOG(LogTemp, Log, TEXT("Roll Functions:"));
-        UE_LOG(LogTemp, Log, TEXT("  CreateRoll: %s"), CreateRollFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  RollGetValue: %s"), RollGetValueFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  RollGetDescription: %s"), RollGetDescriptionFuncPtr ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  CreateRoll: %s"), Toolkit->CreateRoll ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  RollGetValue: %s"), Toolkit->RollGetValue ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  RollGetDescription: %s"), Toolkit->RollGetDescription ? TEXT("OK") : TEXT("FAILED"));
         
         UE_LOG(LogTemp, Log, TEXT("Automatic Cleanup Helper Functions:"));
-        UE_LOG(LogTemp, Log, TEXT("  D4Complete: %s"), D4CompleteFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  D6Complete: %s"), D6CompleteFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  D8Complete: %s"), D8CompleteFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  D10Complete: %s"), D10CompleteFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  D12Complete: %s"), D12CompleteFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  D20Complete: %s"), D20CompleteFuncPtr ? TEXT("OK") : TEXT("FAILED"));
-        UE_LOG(LogTemp, Log, TEXT("  D100Complete: %s"), D100CompleteFuncPtr ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  D4Complete: %s"), Toolkit->D4Complete ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  D6Complete: %s"), Toolkit->D6Complete ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  D8Complete: %s"), Toolkit->D8Complete ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  D10Complete: %s"), Toolkit->D10Complete ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  D12Complete: %s"), Toolkit->D12Complete ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  D20Complete: %s"), Toolkit->D20Complete ? TEXT("OK") : TEXT("FAILED"));
+        UE_LOG(LogTemp, Log, TEXT("  D100Complete: %s"), Toolkit->D100Complete ? TEXT("OK") : TEXT("FAILED"));
+        
+        UE_LOG(LogTemp, Log, TEXT("Structured Roll Functions:"));
+        UE_LOG(LogTemp, Log, TEXT("  DiceRollStructured: %s"), Toolkit->DiceRollStructured ? TEXT("OK") : TEXT("FAILED"));
+        
+        UE_LOG(LogTemp, Log, TEXT("Batched Roll Functions:"));
+        UE_LOG(LogTemp, Log, TEXT("  RollBatch: %s"), Toolkit->RollBatch ? TEXT("OK") : TEXT("FAILED"));
         UE_LOG(LogTemp, Log, TEXT("================================"));
     }
     else
@@ -394,7 +1539,7 @@ void URPGDiceSubsystem::LoadDLLFunctions()
 }
 
 
-FString URPGDiceSubsystem::ConvertAndFreeString(ANSICHAR* CStr) const
+FString URPGDiceSubsystem::ConvertAndFreeString(const FRPGToolkitAPI& API, ANSICHAR* CStr)
 {
     if (!CStr)
     {
@@ -404,9 +1549,9 @@ FString URPGDiceSubsystem::ConvertAndFreeString(ANSICHAR* CStr) const
     FString Result = FString(ANSI_TO_TCHAR(CStr));
     
     // Free the C string memory
-    if (FreeStringFuncPtr)
+    if (API.FreeString)
     {
-        FreeStringFuncPtr(CStr);
+        API.FreeString(CStr);
     }
     
     return Result;
@@ -415,6 +1560,6 @@ FString URPGDiceSubsystem::ConvertAndFreeString(ANSICHAR* CStr) const
 bool URPGDiceSubsystem::IsSafeToCallFunction() const
 {
     // Following established pattern for shutdown safety
-    return bFunctionsLoaded && ToolkitDLLHandle != nullptr;
+    return bFunctionsLoaded && Toolkit != nullptr;
 }
 
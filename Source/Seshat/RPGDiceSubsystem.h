@@ -3,25 +3,116 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "UObject/ScriptInterface.h"
+#include "Async/Future.h"
 #include "RPGCore/Entity/RPGEntity.h"
 #include "RPGCore/Events/RPGEventTypes.h"
 #include "RPGCore/Events/RPGEventContext.h"
+#include "RPGCore/Dice/RPGDiceExpression.h"
 #include "RPGDiceSubsystem.generated.h"
 
+/**
+ * Which roller backs RollerRoll/RollerRollN and the D4..D100 helpers
+ */
+UENUM(BlueprintType)
+enum class ERPGDiceBackend : uint8
+{
+    /** Go toolkit CryptoRoller across the CGO boundary (default) */
+    Toolkit      UMETA(DisplayName = "Toolkit (Go)"),
+    /** In-process crypto-backed generator for player-facing rolls */
+    NativeCrypto UMETA(DisplayName = "Native Crypto"),
+    /** In-process seeded xoshiro256** generator for bulk simulation */
+    NativeFast   UMETA(DisplayName = "Native Fast"),
+    /** Philox session stream - reproducible from (seed, stream, position) for replay and lockstep */
+    Seeded       UMETA(DisplayName = "Seeded (Replayable)"),
+    /** Crypto-quality faces pre-rolled by a background worker; the game thread only pops */
+    PooledCrypto UMETA(DisplayName = "Pooled Crypto")
+};
+
+/**
+ * Roll pool counters for the PooledCrypto backend
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGDicePoolStats
+{
+    GENERATED_BODY()
+
+    /** Faces served from a pool */
+    UPROPERTY(BlueprintReadOnly, Category = "Dice Pool")
+    int64 Hits = 0;
+
+    /** Pooled die sizes that found their pool empty (rolled synchronously instead) */
+    UPROPERTY(BlueprintReadOnly, Category = "Dice Pool")
+    int64 Misses = 0;
+
+    /** Worker passes that generated faces */
+    UPROPERTY(BlueprintReadOnly, Category = "Dice Pool")
+    int64 RefillPasses = 0;
+
+    /** Faces generated by the worker */
+    UPROPERTY(BlueprintReadOnly, Category = "Dice Pool")
+    int64 FacesGenerated = 0;
+
+    /** Capacity of each pool */
+    UPROPERTY(BlueprintReadOnly, Category = "Dice Pool")
+    int32 Capacity = 0;
+
+    /** Pools below this level wake the worker */
+    UPROPERTY(BlueprintReadOnly, Category = "Dice Pool")
+    int32 LowWatermark = 0;
+
+    /** Current d20 pool level */
+    UPROPERTY(BlueprintReadOnly, Category = "Dice Pool")
+    int32 D20Level = 0;
+};
+
+/**
+ * Where a roll started on a named seeded stream
+ * Together with the session seed this is enough to recompute the roll
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGDiceStreamPosition
+{
+    GENERATED_BODY()
+
+    /** Stream name (e.g. "Session", "Combat.Goblin_3") */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dice Stream")
+    FName Stream;
+
+    /** Number of 32-bit words consumed on the stream before the roll */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dice Stream")
+    int64 Position = 0;
+};
+
+/** Per-roll flag bits written by DiceRollStructured (mirrored in dice_bindings.go) */
+namespace RPGDiceRollFlags
+{
+    constexpr int32 None = 0;
+    constexpr int32 InvalidSpec = 1 << 0;
+    constexpr int32 RollError = 1 << 1;
+    constexpr int32 FacesTruncated = 1 << 2;
+}
+
 /**
  * Blueprint-friendly dice roll result with automatic memory management
+ * Individual faces are kept in a fixed inline buffer; the description is built on demand
  */
 USTRUCT(BlueprintType)
 struct SESHAT_API FRollResult
 {
     GENERATED_BODY()
 
+    /** Maximum number of individual die faces kept inline */
+    static constexpr int32 MaxInlineFaces = 16;
+
     /** The numeric result of the dice roll */
     UPROPERTY(BlueprintReadOnly, Category = "Roll Result")
     int32 Value = -1;
 
-    /** Human-readable description (e.g., "+d20[15]=15") */
-    UPROPERTY(BlueprintReadOnly, Category = "Roll Result")
+    /**
+     * Human-readable description (e.g., "+d20[15]=15") when the toolkit provided one
+     * Deprecated for Blueprint reads: the structured roll path leaves it empty, use GetRollDescription instead
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Roll Result", meta = (DeprecatedProperty, DeprecationMessage = "Empty for structured rolls - use Get Roll Description, which builds it from the faces"))
     FString Description;
 
     /** Whether this roll had an error */
@@ -32,6 +123,24 @@ struct SESHAT_API FRollResult
     UPROPERTY(BlueprintReadOnly, Category = "Roll Result")
     FString ErrorMessage;
 
+    /** RPGDiceRollFlags bits for this roll */
+    UPROPERTY(BlueprintReadOnly, Category = "Roll Result")
+    int32 Flags = 0;
+
+    /** Number of dice rolled */
+    UPROPERTY(BlueprintReadOnly, Category = "Roll Result")
+    int32 DieCount = 0;
+
+    /** Number of sides on each die */
+    UPROPERTY(BlueprintReadOnly, Category = "Roll Result")
+    int32 DieSize = 0;
+
+    /** Number of valid entries in Faces (at most MaxInlineFaces) */
+    int32 NumFaces = 0;
+
+    /** Individual die faces - no heap allocation */
+    int32 Faces[MaxInlineFaces] = {};
+
     /** Default constructor */
     FRollResult()
         : Value(-1), HasError(false)
@@ -49,10 +158,87 @@ struct SESHAT_API FRollResult
         : Value(-1), HasError(true), ErrorMessage(InErrorMessage)
     {
     }
+
+    /** Description in the toolkit format, built from the faces if it was not provided */
+    FString GetDescription() const;
 };
 
+/**
+ * Blueprint-friendly dice spec for batched rolls (e.g., 2d6+3)
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FDiceSpec
+{
+    GENERATED_BODY()
+
+    /** Number of dice to roll */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dice Spec")
+    int32 Count = 1;
+
+    /** Number of sides on each die */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dice Spec")
+    int32 Size = 20;
+
+    /** Flat modifier added to the total */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dice Spec")
+    int32 Modifier = 0;
+
+    FDiceSpec() = default;
+
+    FDiceSpec(int32 InCount, int32 InSize, int32 InModifier = 0)
+        : Count(InCount), Size(InSize), Modifier(InModifier)
+    {
+    }
+};
+
+/**
+ * Handle to a dice expression compiled and cached by URPGDiceSubsystem
+ */
+USTRUCT(BlueprintType)
+struct SESHAT_API FRPGDiceExpressionHandle
+{
+    GENERATED_BODY()
+
+    /** Slot in the subsystem's compiled expression table */
+    UPROPERTY(BlueprintReadOnly, Category = "Dice Expression")
+    int32 Index = INDEX_NONE;
+
+    /** Cache generation the handle was issued in (handles die with ClearDiceExpressionCache) */
+    UPROPERTY(BlueprintReadOnly, Category = "Dice Expression")
+    int32 Generation = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+/**
+ * Packed dice spec passed across the CGO boundary to RollBatch
+ * Layout must match RPGDiceSpec in dice_bindings.go
+ */
+struct FRPGDiceSpecPacked
+{
+    int32 Count;
+    int32 Size;
+    int32 Modifier;
+};
+static_assert(sizeof(FRPGDiceSpecPacked) == 3 * sizeof(int32), "FRPGDiceSpecPacked must match the packed RPGDiceSpec layout");
+
+/** Per-roll flag bits written by RollBatch (mirrored in dice_bindings.go) */
+namespace RPGDiceBatchFlags
+{
+    constexpr int32 None = 0;
+    constexpr int32 InvalidSpec = 1 << 0;
+    constexpr int32 RollError = 1 << 1;
+}
+
 // Forward declarations
 class URPGEventBusSubsystem;
+class FRPGDiceEngine;
+class FRPGDiceBulkGenerator;
+class FRPGDiceDistribution;
+class FRPGDiceStream;
+class FRPGDiceRollPoolWorker;
+class FRPGToolkitExecutor;
+struct FRPGToolkitAPI;
 
 /**
  * Subsystem that provides dice rolling functionality using the rpg-toolkit
@@ -76,6 +262,69 @@ public:
     UFUNCTION(BlueprintCallable, Category = "RPG Dice")
     TArray<int32> RollerRollN(int32 Count, int32 Size);
 
+    /**
+     * Native bulk entry point - writes Count faces directly into OutResults
+     * Uses the vectorized kernel when the NativeFast backend is selected
+     * @return Number of dice rolled, or -1 on error
+     */
+    int32 RollerRollN(int32 Count, int32 Size, int32* OutResults);
+
+    // Backend Selection
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice")
+    void SetDiceBackend(ERPGDiceBackend NewBackend);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Dice")
+    ERPGDiceBackend GetDiceBackend() const { return DiceBackend; }
+
+    /** Reseed the native fast generator so simulations can be reproduced */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice")
+    void SetNativeSeed(int64 Seed);
+
+    // Seeded Streams - deterministic rolls for replay, lockstep and server validation
+    /** Start a seeded session: every named stream restarts at position 0 under the new seed */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Seeded")
+    void SetSeededSession(int64 Seed);
+
+    UFUNCTION(BlueprintPure, Category = "RPG Dice|Seeded")
+    int64 GetSeededSessionSeed() const { return SeededSessionSeed; }
+
+    /**
+     * Roll Count dice on a named stream (created on first use)
+     * OutStart records where the roll began so it can be replayed or validated
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Seeded")
+    FRollResult RollOnStream(FName StreamName, int32 Count, int32 Size, FRPGDiceStreamPosition& OutStart);
+
+    /** Current position of a named stream */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Seeded")
+    FRPGDiceStreamPosition GetStreamPosition(FName StreamName);
+
+    /** Jump a named stream to any position in O(1) (rewind for replay, or skip ahead) */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Seeded")
+    void SeekStream(const FRPGDiceStreamPosition& NewPosition);
+
+    /**
+     * Recompute a roll from (seed, stream, position) and compare the total
+     * Lets a server validate client rolls without receiving every die face
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Seeded")
+    static bool VerifySeededRoll(int64 Seed, const FRPGDiceStreamPosition& Start, int32 Count, int32 Size, int32 ExpectedTotal);
+
+    /** Named stream used by the Seeded backend and unnamed rolls */
+    static const FName DefaultStreamName;
+
+    // Roll Pools - background pre-rolled faces for the PooledCrypto backend
+    /**
+     * (Re)create the d4..d100 pools and start the refill worker
+     * @param Capacity Faces per die size (rounded up to a power of two)
+     * @param LowWatermark Popping below this level wakes the worker
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Pool")
+    void ConfigureRollPools(int32 Capacity = 4096, int32 LowWatermark = 1024);
+
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Pool")
+    FRPGDicePoolStats GetRollPoolStats() const;
+
     // Legacy Roll Struct Functions (deprecated - use FRollResult functions)
     // These remain for backward compatibility but should not be used in new code
 
@@ -101,6 +350,121 @@ public:
     UFUNCTION(BlueprintCallable, Category = "RPG Dice")
     FRollResult D100(int32 Count = 1);
 
+    /**
+     * Roll Count dice of any size into a structured result
+     * Faces and total come back in a fixed buffer - no Go strings, no UTF conversion
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice")
+    FRollResult RollDice(int32 Count, int32 Size);
+
+    /**
+     * RollDice without blocking the caller on the toolkit - the CGO call runs on the toolkit worker pool
+     * Native backends complete immediately. Blueprint callers use the "Roll Dice Async" latent node
+     * @param bBatchPerFrame Send with the rest of this frame's toolkit calls instead of on its own
+     */
+    TFuture<FRollResult> RollDiceAsync(int32 Count, int32 Size, bool bBatchPerFrame = false);
+
+    /** RollDiceAsync with the result delivered to OnComplete on the game thread */
+    void RollDiceAsync(int32 Count, int32 Size, TUniqueFunction<void(FRollResult)> OnComplete, bool bBatchPerFrame = false);
+
+    /** Build the description for a roll on demand (e.g., "+2d6[3,4]=7"); replaces reading FRollResult.Description */
+    UFUNCTION(BlueprintPure, Category = "RPG Dice")
+    static FString GetRollDescription(const FRollResult& Roll);
+
+    /** Individual die faces of a roll */
+    UFUNCTION(BlueprintPure, Category = "RPG Dice")
+    static TArray<int32> GetRollFaces(const FRollResult& Roll);
+
+    // Dice Expressions - compiled once, cached by notation
+    /**
+     * Compile a notation such as "2d6+3" or "4d6kh3", reusing the cached bytecode if seen before
+     * Returns an invalid handle and fills OutError if the notation does not parse
+     */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice")
+    FRPGDiceExpressionHandle CompileDiceExpression(const FString& Notation, FString& OutError);
+
+    /** Roll a compiled expression - no parsing, dice come from the active backend */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice")
+    FRollResult EvaluateCompiled(const FRPGDiceExpressionHandle& Handle);
+
+    /** Compile (or fetch from the cache) and evaluate in one call */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice")
+    FRollResult RollDiceExpression(const FString& Notation);
+
+    /** Drop every compiled expression; outstanding handles become invalid */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice")
+    void ClearDiceExpressionCache();
+
+    UFUNCTION(BlueprintPure, Category = "RPG Dice")
+    int32 GetDiceExpressionCacheSize() const { return CompiledExpressions.Num(); }
+
+    /** Compiled expression behind a handle, or nullptr if the handle is stale */
+    const FRPGDiceExpression* FindCompiledExpression(const FRPGDiceExpressionHandle& Handle) const;
+
+    // Exact Probabilities - computed once per notation/modifier, then answered from the cache
+    /** P(total >= Target), e.g. hit chance of "1d20+5" against AC 15 */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Probability")
+    double GetRollProbabilityAtLeast(const FString& Notation, int32 Target, ERPGEventModifier RollModifier = ERPGEventModifier::None);
+
+    /** P(total <= Target) */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Probability")
+    double GetRollProbabilityAtMost(const FString& Notation, int32 Target, ERPGEventModifier RollModifier = ERPGEventModifier::None);
+
+    /** Expected total of a notation */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Probability")
+    double GetExpectedRollValue(const FString& Notation, ERPGEventModifier RollModifier = ERPGEventModifier::None);
+
+    /** Full PMF: every reachable total and its probability */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice|Probability")
+    bool GetRollDistribution(const FString& Notation, ERPGEventModifier RollModifier, TArray<int32>& OutValues, TArray<double>& OutProbabilities);
+
+    /**
+     * Cached exact distribution for a notation (Advantage/Disadvantage apply to the first single-die term)
+     * @return nullptr (and OutError) if the notation does not parse or is too large to evaluate exactly
+     */
+    TSharedPtr<const FRPGDiceDistribution> FindOrComputeDistribution(const FString& Notation, ERPGEventModifier RollModifier, FString* OutError = nullptr);
+
+    // Batched Rolls - one toolkit call for the whole batch, no Go string allocations
+    /** Roll every spec on the active backend; results carry totals, flags and the spec, but no faces */
+    UFUNCTION(BlueprintCallable, Category = "RPG Dice")
+    TArray<FRollResult> RollBatch(const TArray<FDiceSpec>& Specs);
+
+    /**
+     * Native batch entry point for hot paths (combat sim, AoE resolution)
+     * Writes one value and one RPGDiceBatchFlags word per spec into caller-owned buffers
+     * The toolkit backend rolls the whole batch in one call; in-process backends roll it directly
+     * @return Number of specs rolled successfully, or -1 if the toolkit is selected but unavailable
+     */
+    int32 RollBatch(const FRPGDiceSpecPacked* Specs, int32 NumSpecs, int32* OutValues, int32* OutFlags);
+
+#if !UE_BUILD_SHIPPING
+    // Benchmarks - development builds only, run from the console (rpg.Bench.*)
+    FString BenchmarkRollBatch(int32 NumRolls = 1000);
+
+    FString BenchmarkStructuredRolls(int32 NumRolls = 1000);
+
+    /** Reports rolls per second for each backend (toolkit, native crypto, native fast) */
+    FString BenchmarkDiceBackends(int32 NumRolls = 100000);
+
+    /** Throughput of the bulk kernels (scalar, SSE2, AVX2 where compiled) against the scalar engine */
+    FString BenchmarkBulkRolls(int32 NumRolls = 10000000);
+
+    /** Parse-every-time versus cached bytecode for a notation */
+    FString BenchmarkDiceExpressions(const FString& Notation = TEXT("2d6+3"), int32 NumRolls = 100000);
+
+    /** Exact probability (first computation and cached lookup) versus Monte Carlo sampling */
+    FString BenchmarkDiceDistribution(const FString& Notation = TEXT("2d6+3"), int32 Target = 10, int32 NumSamples = 100000);
+
+    /** Replay test: Philox known-answer vector, interleaved replay, O(1) seek and roll verification */
+    FString CheckSeededReplay(int64 Seed = 42, int32 NumRolls = 1000);
+
+    /** Game-thread cost per d20: pool pop versus synchronous crypto roll */
+    FString BenchmarkRollPools(int32 NumRolls = 1000);
+
+    /** Chi-square uniformity test of the bulk kernel, plus a check that all compiled kernels agree */
+    FString CheckBulkRollUniformity(int32 NumRolls = 10000000, int32 Size = 20);
+#endif
+
     // Toolkit Status
     UFUNCTION(BlueprintCallable, Category = "RPG Dice")
     bool IsToolkitLoaded() const;
@@ -108,79 +472,81 @@ public:
     // Legacy Functions (for backward compatibility) - implemented in .cpp as inline mapping
 
 private:
-    /** Function pointers to actual toolkit DLL functions */
-    // Roller interface functions
-    typedef void* (*CreateCryptoRollerFunc)();
-    typedef int32 (*RollerRollFunc)(void*, int32);
-    typedef int32 (*RollerRollNFunc)(void*, int32, int32, int32*);
-    typedef void* (*GetDefaultRollerFunc)();
-    typedef void (*SetDefaultRollerFunc)(void*);
-    
-    // Roll struct functions
-    typedef void* (*CreateRollFunc)(int32, int32);
-    typedef void* (*CreateRollWithRollerFunc)(int32, int32, void*);
-    typedef int32 (*RollGetValueFunc)(uintptr_t);
-    typedef ANSICHAR* (*RollGetDescriptionFunc)(uintptr_t);
-    typedef int32 (*RollHasErrorFunc)(uintptr_t);
-    typedef ANSICHAR* (*RollGetErrorFunc)(uintptr_t);
-    
-    // Automatic cleanup helper functions
-    typedef int32 (*D4CompleteFunc)(int32, int32*, ANSICHAR**, ANSICHAR**);
-    typedef int32 (*D6CompleteFunc)(int32, int32*, ANSICHAR**, ANSICHAR**);
-    typedef int32 (*D8CompleteFunc)(int32, int32*, ANSICHAR**, ANSICHAR**);
-    typedef int32 (*D10CompleteFunc)(int32, int32*, ANSICHAR**, ANSICHAR**);
-    typedef int32 (*D12CompleteFunc)(int32, int32*, ANSICHAR**, ANSICHAR**);
-    typedef int32 (*D20CompleteFunc)(int32, int32*, ANSICHAR**, ANSICHAR**);
-    typedef int32 (*D100CompleteFunc)(int32, int32*, ANSICHAR**, ANSICHAR**);
-    
-    // Legacy functions
-    typedef void* (*CreateDiceRollerFunc)();
-    typedef int32 (*RollDieFunc)(void*, int32);
-    typedef void (*FreeStringFunc)(ANSICHAR*);
-    
-    
-    // Function pointer instances
-    CreateCryptoRollerFunc CreateCryptoRollerFuncPtr;
-    RollerRollFunc RollerRollFuncPtr;
-    RollerRollNFunc RollerRollNFuncPtr;
-    GetDefaultRollerFunc GetDefaultRollerFuncPtr;
-    SetDefaultRollerFunc SetDefaultRollerFuncPtr;
-    
-    CreateRollFunc CreateRollFuncPtr;
-    CreateRollWithRollerFunc CreateRollWithRollerFuncPtr;
-    RollGetValueFunc RollGetValueFuncPtr;
-    RollGetDescriptionFunc RollGetDescriptionFuncPtr;
-    RollHasErrorFunc RollHasErrorFuncPtr;
-    RollGetErrorFunc RollGetErrorFuncPtr;
-    
-    D4CompleteFunc D4CompleteFuncPtr;
-    D6CompleteFunc D6CompleteFuncPtr;
-    D8CompleteFunc D8CompleteFuncPtr;
-    D10CompleteFunc D10CompleteFuncPtr;
-    D12CompleteFunc D12CompleteFuncPtr;
-    D20CompleteFunc D20CompleteFuncPtr;
-    D100CompleteFunc D100CompleteFuncPtr;
-    
-    CreateDiceRollerFunc CreateDiceRollerFuncPtr;
-    RollDieFunc RollDieFuncPtr;
-    FreeStringFunc FreeStringFuncPtr;
+    /** Shared toolkit function table (borrowed from FRPGToolkitModule) */
+    const FRPGToolkitAPI* Toolkit;
 
-    /** Whether the DLL functions were successfully loaded */
+    /** Whether the critical toolkit functions are available */
     bool bFunctionsLoaded;
 
-    /** Handle to the loaded DLL */
-    void* ToolkitDLLHandle;
-
     /** Dice roller instance from the toolkit */
     void* DiceRollerPtr;
+
+    /** Shared worker pool for off-game-thread toolkit rolls */
+    FRPGToolkitExecutor* Executor = nullptr;
+
+    /** Active roller backend */
+    ERPGDiceBackend DiceBackend = ERPGDiceBackend::Toolkit;
+
+    /** In-process engines (game thread only) */
+    TSharedPtr<FRPGDiceEngine> NativeCryptoEngine;
+    TSharedPtr<FRPGDiceEngine> NativeFastEngine;
+    TSharedPtr<FRPGDiceBulkGenerator> NativeBulkGenerator;
+
+    /** Compiled dice expressions, indexed by FRPGDiceExpressionHandle::Index */
+    TArray<FRPGDiceExpression> CompiledExpressions;
+
+    /** Notation -> slot in CompiledExpressions */
+    TMap<FString, int32> ExpressionCache;
+
+    /** Bumped by ClearDiceExpressionCache to invalidate outstanding handles */
+    int32 ExpressionCacheGeneration = 0;
+
+    /** Memoized distributions keyed by notation plus roll modifier */
+    TMap<FString, TSharedPtr<const FRPGDiceDistribution>> DistributionCache;
+
+    /** Evaluate a compiled expression against the active backend */
+    FRollResult EvaluateExpression(const FRPGDiceExpression& Expression);
+
+    /** Seed shared by every named stream */
+    int64 SeededSessionSeed = 0;
+
+    /** Named Philox streams (created on first use) */
+    TMap<FName, TSharedPtr<FRPGDiceStream>> SeededStreams;
+
+    /** Engine borrowing the default stream, used by the Seeded backend */
+    TSharedPtr<FRPGDiceEngine> SeededEngine;
+
+    /** Named stream, created at position 0 on first use */
+    FRPGDiceStream& FindOrAddStream(FName StreamName);
+
+    /** Refill worker and pools (created by ConfigureRollPools or on first PooledCrypto use) */
+    TSharedPtr<FRPGDiceRollPoolWorker> RollPoolWorker;
+
+    /** Pooled face, falling back to the synchronous crypto engine on a miss or unpooled size */
+    int32 PopPooledFace(int32 Size);
+
+    /** Native engine for the active backend, or nullptr when the toolkit is selected */
+    FRPGDiceEngine* GetNativeEngine() const;
     
 
-    /** Load the DLL and function pointers */
-    void LoadDLLFunctions();
+    /** Borrow the shared toolkit function table and check critical functions */
+    void BindToolkitFunctions();
+    
+    
+    /** Structured roll on an in-process engine */
+    FRollResult RollNative(FRPGDiceEngine& Engine, int32 Count, int32 Size);
+
+    /** Structured roll from any in-process face source */
+    static FRollResult RollFromFaces(TFunctionRef<int32(int32 Size)> NextFace, int32 Count, int32 Size);
+    
+    /** Structured roll through the toolkit's DiceRollStructured export (static so worker threads never touch the subsystem) */
+    static FRollResult RollStructured(const FRPGToolkitAPI& API, int32 Count, int32 Size);
     
+    /** Legacy string-based roll through the D*Complete exports (used when DiceRollStructured is missing) */
+    static FRollResult RollComplete(const FRPGToolkitAPI& API, int32 Count, int32 Size);
     
     /** Helper to convert C string and free memory */
-    FString ConvertAndFreeString(ANSICHAR* CStr) const;
+    static FString ConvertAndFreeString(const FRPGToolkitAPI& API, ANSICHAR* CStr);
     
     /** Shutdown safety check (following existing pattern) */
     bool IsSafeToCallFunction() const;
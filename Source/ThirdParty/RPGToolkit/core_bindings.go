@@ -2,6 +2,15 @@ package main
 
 /*
 #include <stdlib.h>
+#include <stdint.h>
+
+// Packed (id, type) UTF-8 views for ValidateEntitiesBatch - layout must match FRPGEntityViewPacked in RPGEntitySubsystem.h
+typedef struct {
+	const char* id;
+	const char* entityType;
+	int idLen;
+	int typeLen;
+} RPGEntityView;
 */
 import "C"
 import (
@@ -114,8 +123,7 @@ func CreateEntityErrorComplete(op, entityType, entityID, errMsg *C.char,
 
 //export ValidateEntityID
 func ValidateEntityID(id *C.char) C.int {
-	idStr := C.GoString(id)
-	if idStr == "" {
+	if !isValidEntityID(C.GoString(id)) {
 		return 0 // false
 	}
 	return 1 // true
@@ -123,13 +131,70 @@ func ValidateEntityID(id *C.char) C.int {
 
 //export ValidateEntityType
 func ValidateEntityType(entityType *C.char) C.int {
-	typeStr := C.GoString(entityType)
-	if typeStr == "" {
+	if !isValidEntityType(C.GoString(entityType)) {
 		return 0 // false
 	}
 	return 1 // true
 }
 
+// Per-entity bits in the ValidateEntitiesBatch mask (mirrored in RPGEntitySubsystem.h)
+const (
+	entityBatchValidID      = 1 << 0
+	entityBatchValidType    = 1 << 1
+	entityBatchBitsPerEntry = 2
+	entityBatchPerWord      = 64 / entityBatchBitsPerEntry
+)
+
+// ValidateEntitiesBatch validates count (id, type) pairs in one call, e.g. every entity in a streamed level.
+// outMask must hold (count+31)/32 words; entity i gets entityBatchValid* bits at bit 2*(i%32) of word i/32.
+// Returns the number of entities whose ID and type are both valid.
+//
+//export ValidateEntitiesBatch
+func ValidateEntitiesBatch(entities *C.RPGEntityView, count C.int, outMask *C.uint64_t) C.int {
+	if entities == nil || outMask == nil || count <= 0 {
+		return 0
+	}
+
+	views := unsafe.Slice(entities, int(count))
+	mask := unsafe.Slice((*uint64)(unsafe.Pointer(outMask)), (int(count)+entityBatchPerWord-1)/entityBatchPerWord)
+	for i := range mask {
+		mask[i] = 0
+	}
+
+	valid := 0
+	for i := range views {
+		bits := uint64(0)
+		if isValidEntityID(borrowString(views[i].id, views[i].idLen)) {
+			bits |= entityBatchValidID
+		}
+		if isValidEntityType(borrowString(views[i].entityType, views[i].typeLen)) {
+			bits |= entityBatchValidType
+		}
+		if bits == entityBatchValidID|entityBatchValidType {
+			valid++
+		}
+		mask[i/entityBatchPerWord] |= bits << (entityBatchBitsPerEntry * uint(i%entityBatchPerWord))
+	}
+	return C.int(valid)
+}
+
+// isValidEntityID and isValidEntityType are the core.Entity rules shared by the single and batch exports
+func isValidEntityID(id string) bool {
+	return id != ""
+}
+
+func isValidEntityType(entityType string) bool {
+	return entityType != ""
+}
+
+// borrowString views caller-owned UTF-8 without copying - it must not outlive the export call
+func borrowString(p *C.char, n C.int) string {
+	if p == nil || n <= 0 {
+		return ""
+	}
+	return unsafe.String((*byte)(unsafe.Pointer(p)), int(n))
+}
+
 // Memory Management
 // String cleanup function for C interop
 
@@ -2,6 +2,13 @@ package main
 
 /*
 #include <stdlib.h>
+
+// Packed dice spec for RollBatch - layout must match FRPGDiceSpecPacked in RPGDiceSubsystem.h
+typedef struct {
+	int count;
+	int size;
+	int modifier;
+} RPGDiceSpec;
 */
 import "C"
 import (
@@ -297,6 +304,104 @@ func D100Complete(count C.int, outValue *C.int, outDesc **C.char, outError **C.c
 	}
 }
 
+// Batched Roll Functions
+// One CGO transition for N rolls - values and flags are written into caller-owned
+// buffers, so no Go strings are allocated and nothing needs to be freed by the caller
+
+// Batch flag bits (mirrored by RPGDiceBatchFlags in RPGDiceSubsystem.h)
+const (
+	batchFlagInvalidSpec = 1 << 0
+	batchFlagRollError   = 1 << 1
+)
+
+//export RollBatch
+func RollBatch(specs *C.RPGDiceSpec, count C.int, outValues *C.int, outFlags *C.int) C.int {
+	if specs == nil || outValues == nil || outFlags == nil || count <= 0 {
+		return 0
+	}
+
+	specSlice := (*[1 << 28]C.RPGDiceSpec)(unsafe.Pointer(specs))[:count:count]
+	valueSlice := (*[1 << 30]C.int)(unsafe.Pointer(outValues))[:count:count]
+	flagSlice := (*[1 << 30]C.int)(unsafe.Pointer(outFlags))[:count:count]
+
+	succeeded := 0
+	for i := range specSlice {
+		total, flags := rollSpec(int(specSlice[i].count), int(specSlice[i].size))
+		if flags == 0 {
+			total += int(specSlice[i].modifier)
+			succeeded++
+		}
+		valueSlice[i] = C.int(total)
+		flagSlice[i] = C.int(flags)
+	}
+	return C.int(succeeded)
+}
+
+// rollSpec rolls count dice of the given size with the default roller and returns
+// the sum plus batch flag bits (0 on success)
+func rollSpec(count, size int) (int, int) {
+	if count <= 0 || size <= 0 {
+		return -1, batchFlagInvalidSpec
+	}
+
+	total := 0
+	for n := 0; n < count; n++ {
+		face, err := dice.DefaultRoller.Roll(size)
+		if err != nil {
+			return -1, batchFlagRollError
+		}
+		total += face
+	}
+	return total, 0
+}
+
+// Structured Roll Functions
+// Faces and total are written into caller-owned buffers and the result is a flags word,
+// so the hot path allocates no Go strings - descriptions are built by the caller on demand
+
+// Structured roll flag bits (mirrored by RPGDiceRollFlags in RPGDiceSubsystem.h)
+// The first two bits share their values with the batch flags
+const (
+	rollFlagInvalidSpec    = batchFlagInvalidSpec
+	rollFlagRollError      = batchFlagRollError
+	rollFlagFacesTruncated = 1 << 2
+)
+
+//export DiceRollStructured
+func DiceRollStructured(count C.int, size C.int, outFaces *C.int, maxFaces C.int, outTotal *C.int) C.int {
+	if outTotal == nil {
+		return rollFlagInvalidSpec
+	}
+	*outTotal = -1
+
+	if count <= 0 || size <= 0 {
+		return rollFlagInvalidSpec
+	}
+
+	var faceSlice []C.int
+	if outFaces != nil && maxFaces > 0 {
+		faceSlice = (*[1 << 30]C.int)(unsafe.Pointer(outFaces))[:maxFaces:maxFaces]
+	}
+
+	flags := 0
+	total := 0
+	for n := 0; n < int(count); n++ {
+		face, err := dice.DefaultRoller.Roll(int(size))
+		if err != nil {
+			return rollFlagRollError
+		}
+		if n < len(faceSlice) {
+			faceSlice[n] = C.int(face)
+		} else {
+			flags |= rollFlagFacesTruncated
+		}
+		total += face
+	}
+
+	*outTotal = C.int(total)
+	return C.int(flags)
+}
+
 // Memory Management Functions
 
 //export RollCleanup
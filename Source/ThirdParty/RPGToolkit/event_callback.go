@@ -0,0 +1,207 @@
+package main
+
+/*
+#include <stdint.h>
+
+// Registered by URPGEventBusSubsystem - copies the event into its inbox ring and returns 0 if the ring is full
+typedef int (*RPGEventCallback)(const uint8_t* data, int length, void* userData);
+
+static int rpgInvokeEventCallback(void* callback, const uint8_t* data, int length, void* userData) {
+	return ((RPGEventCallback)callback)(data, length, userData);
+}
+*/
+import "C"
+import (
+	"fmt"
+	"log"
+	"sync"
+	"sync/atomic"
+	"unicode/utf8"
+	"unsafe"
+
+	"github.com/KirkDiggler/rpg-toolkit/core"
+	"github.com/KirkDiggler/rpg-toolkit/events"
+)
+
+// Go -> UE Event Callback
+// Toolkit subscribers forward events to UE through the registered C callback, encoded
+// in the binary wire format (event_wire.go). The callback only copies the bytes into a
+// lock-free ring that the game thread drains once per tick, so it is safe to call from
+// any goroutine.
+
+// ueOriginKey marks events that were published from UE so they are not forwarded back
+const ueOriginKey = "ue_origin"
+
+// ueMaxEventBytes is the largest event a UE inbox slot holds (FRPGToolkitEventInbox::MaxEventBytes)
+const ueMaxEventBytes = 488
+
+// droppedOversize counts events too large for the UE inbox, which are skipped here instead
+var droppedOversize atomic.Int64
+
+// Context keys forwarded to UE (the toolkit context cannot be enumerated)
+var forwardedContextKeys = [...]string{
+	"attacker", "target", "weapon", "damage_type", "advantage",
+	"roll", "old_position", "new_position", "room_id",
+}
+
+// eventCallback is read by every forwarding goroutine and replaced by RegisterEventCallback;
+// holding the read lock across the call guarantees UE never sees a callback after unregistering.
+// There is one bus per process, so only one UE owner (userData) may be registered at a time
+var eventCallback struct {
+	sync.RWMutex
+	fn       unsafe.Pointer
+	userData unsafe.Pointer
+}
+
+// Wire type index by toolkit event type name, the reverse of eventWireTypeNames
+var eventWireTypeIndex = func() map[string]uint8 {
+	index := make(map[string]uint8, len(eventWireTypeNames))
+	for i, name := range eventWireTypeNames {
+		index[name] = uint8(i)
+	}
+	return index
+}()
+
+var eventWireBufferPool = sync.Pool{
+	New: func() any {
+		buf := make([]byte, 0, 512)
+		return &buf
+	},
+}
+
+// setEventCallback registers fn for userData, or unregisters userData's callback when fn is nil
+// Returns false if another owner's callback is registered (e.g. a second PIE world), leaving it in place
+func setEventCallback(fn unsafe.Pointer, userData unsafe.Pointer) bool {
+	eventCallback.Lock()
+	defer eventCallback.Unlock()
+
+	if fn == nil {
+		if eventCallback.userData != userData {
+			return false
+		}
+		eventCallback.fn = nil
+		eventCallback.userData = nil
+		return true
+	}
+
+	if eventCallback.fn != nil && eventCallback.userData != userData {
+		log.Printf("rpg_toolkit: RegisterEventCallback refused - another owner is already registered")
+		return false
+	}
+	eventCallback.fn = fn
+	eventCallback.userData = userData
+	return true
+}
+
+// forwardEventToUE encodes event and hands it to the registered callback
+// Returns false if no callback is registered, the event came from UE or the UE ring was full
+func forwardEventToUE(event events.Event) bool {
+	eventCallback.RLock()
+	defer eventCallback.RUnlock()
+
+	if eventCallback.fn == nil || event == nil {
+		return false
+	}
+	if origin, ok := event.Context().Get(ueOriginKey); ok && origin == true {
+		return false
+	}
+
+	ev := wireEventFromGameEvent(event)
+
+	bufPtr := eventWireBufferPool.Get().(*[]byte)
+	defer eventWireBufferPool.Put(bufPtr)
+
+	size := ev.encodedSize()
+	if size > ueMaxEventBytes {
+		// Logged on the first drop and then at each power of two so a flood stays quiet
+		if dropped := droppedOversize.Add(1); dropped&(dropped-1) == 0 {
+			log.Printf("rpg_toolkit: dropped %q event of %d bytes, UE inbox slots hold %d (%d dropped so far)",
+				event.Type(), size, ueMaxEventBytes, dropped)
+		}
+		return false
+	}
+	if cap(*bufPtr) < size {
+		*bufPtr = make([]byte, 0, size)
+	}
+	buf := (*bufPtr)[:size]
+	written := encodeEventWire(ev, buf)
+	if written <= 0 {
+		return false
+	}
+
+	return C.rpgInvokeEventCallback(eventCallback.fn, (*C.uint8_t)(unsafe.Pointer(&buf[0])), C.int(written), eventCallback.userData) != 0
+}
+
+// wireEventFromGameEvent converts a toolkit event to the wire layout
+// Types without an ERPGEventType counterpart travel as Custom with the type as the event name
+func wireEventFromGameEvent(event events.Event) *wireEvent {
+	ev := &wireEvent{}
+
+	if index, ok := eventWireTypeIndex[event.Type()]; ok {
+		ev.eventType = index
+	} else {
+		ev.eventType = uint8(len(eventWireTypeNames) - 1)
+		ev.name = clampWireString(event.Type(), wireMaxStringBytes)
+	}
+
+	if source := event.Source(); source != nil {
+		ev.sourceID = clampWireString(source.GetID(), wireMaxStringBytes)
+		ev.sourceType = clampWireString(source.GetType(), wireMaxStringBytes)
+	}
+	if target := event.Target(); target != nil {
+		ev.targetID = clampWireString(target.GetID(), wireMaxStringBytes)
+		ev.targetType = clampWireString(target.GetType(), wireMaxStringBytes)
+	}
+
+	ctx := event.Context()
+	for _, key := range forwardedContextKeys {
+		value, ok := ctx.Get(key)
+		if !ok {
+			continue
+		}
+		if entry, ok := wireEntryFromValue(key, value); ok {
+			ev.entries = append(ev.entries, entry)
+		}
+	}
+	return ev
+}
+
+// wireEntryFromValue maps a context value to a wire entry; unsupported types are skipped
+func wireEntryFromValue(key string, value any) (wireEntry, bool) {
+	entry := wireEntry{key: key}
+	switch v := value.(type) {
+	case int:
+		entry.kind, entry.intValue = wireValueInt, int32(v)
+	case int32:
+		entry.kind, entry.intValue = wireValueInt, v
+	case int64:
+		entry.kind, entry.intValue = wireValueInt, int32(v)
+	case float32:
+		entry.kind, entry.floatValue = wireValueFloat, v
+	case float64:
+		entry.kind, entry.floatValue = wireValueFloat, float32(v)
+	case bool:
+		entry.kind, entry.boolValue = wireValueBool, v
+	case string:
+		entry.kind, entry.stringValue = wireValueString, clampWireString(v, wireMaxStringBytes)
+	case core.Entity:
+		entry.kind, entry.stringValue = wireValueObject, clampWireString(v.GetID(), wireMaxStringBytes)
+	case fmt.Stringer:
+		entry.kind, entry.stringValue = wireValueString, clampWireString(v.String(), wireMaxStringBytes)
+	default:
+		return entry, false
+	}
+	return entry, true
+}
+
+func clampWireString(s string, maxBytes int) string {
+	if len(s) <= maxBytes {
+		return s
+	}
+	// Back up to a rune start so a truncated string never ends in half a codepoint
+	cut := maxBytes
+	for cut > 0 && !utf8.RuneStart(s[cut]) {
+		cut--
+	}
+	return s[:cut]
+}
@@ -0,0 +1,403 @@
+package main
+
+/*
+#include <stdlib.h>
+*/
+import "C"
+import (
+	"context"
+	"encoding/binary"
+	"errors"
+	"math"
+	"unsafe"
+
+	"github.com/KirkDiggler/rpg-toolkit/events"
+)
+
+// Binary Event Wire Format
+// Decoded without encoding/json - layout must match RPGEventWireFormat.h
+//
+// Header (52 bytes, little-endian):
+//   0  uint32  magic "RPGE"
+//   4  uint16  version
+//   6  uint8   event type (ERPGEventType)
+//   7  uint8   priority (ERPGEventPriority)
+//   8  uint32  flags (bit 0 cancelled, bit 1 handled)
+//   12 uint32  modifier mask (bit per ERPGEventModifier)
+//   16 [16]byte event id (FGuid A, B, C, D as uint32)
+//   32 float64 timestamp
+//   40 uint16  event name length
+//   42 uint16  source id length
+//   44 uint16  source type length
+//   46 uint16  target id length
+//   48 uint16  target type length
+//   50 uint16  entry count
+// Then event name, source id, source type, target id and target type as UTF-8,
+// then per entry: uint8 value type, uint8 key length, key, value
+//   int: int32 | float: float32 | bool: uint8 | string, object: uint16 length + UTF-8
+
+const (
+	eventWireMagic      = 0x45475052
+	eventWireVersion    = 1
+	eventWireHeaderSize = 52
+
+	eventWireFlagCancelled = 1 << 0
+	eventWireFlagHandled   = 1 << 1
+
+	// Length field limits; longer values are truncated like the C++ encoder does
+	wireMaxKeyBytes    = math.MaxUint8
+	wireMaxStringBytes = math.MaxUint16
+	wireMaxEntries     = math.MaxUint16
+)
+
+// Value type tags (mirrored by ERPGEventValueType in RPGEventPayload.h)
+const (
+	wireValueInt = iota
+	wireValueFloat
+	wireValueBool
+	wireValueString
+	wireValueObject
+)
+
+// Names indexed by ERPGEventType (mirrored by RPGEventTypes::EventTypeToString)
+var eventWireTypeNames = [...]string{
+	"Unknown",
+	"EntityCreated", "EntityDestroyed", "EntityModified",
+	"DiceRolled", "RandomSelection",
+	"EntityMoved", "EntityPositioned", "AreaEntered", "AreaExited",
+	"AttackInitiated", "AttackResolved", "DamageDealt", "DamageReceived",
+	"ConditionApplied", "ConditionRemoved", "ConditionTriggered",
+	"ResourceChanged", "ResourceDepleted", "ResourceRestored",
+	"TurnStarted", "TurnEnded", "RoundStarted", "RoundEnded",
+	"Custom",
+}
+
+// validWirePriority reports whether p is one of the ERPGEventPriority values
+func validWirePriority(p uint8) bool {
+	switch p {
+	case 0, 25, 50, 75, 100, 255:
+		return true
+	}
+	return false
+}
+
+var errEventWireTruncated = errors.New("event wire: truncated buffer")
+
+type wireEntry struct {
+	key         string
+	kind        uint8
+	intValue    int32
+	floatValue  float32
+	boolValue   bool
+	stringValue string
+}
+
+type wireEvent struct {
+	eventType  uint8
+	priority   uint8
+	flags      uint32
+	modifiers  uint32
+	id         [16]byte
+	timestamp  float64
+	name       string
+	sourceID   string
+	sourceType string
+	targetID   string
+	targetType string
+	entries    []wireEntry
+}
+
+// wireEntity adapts a decoded entity reference to core.Entity
+type wireEntity struct {
+	id         string
+	entityType string
+}
+
+func (e *wireEntity) GetID() string   { return e.id }
+func (e *wireEntity) GetType() string { return e.entityType }
+
+// wireReader walks a buffer, latching the first out-of-bounds read as an error
+type wireReader struct {
+	buf []byte
+	pos int
+	err error
+}
+
+func (r *wireReader) take(n int) []byte {
+	if r.err != nil {
+		return nil
+	}
+	if n < 0 || r.pos+n > len(r.buf) {
+		r.err = errEventWireTruncated
+		return nil
+	}
+	b := r.buf[r.pos : r.pos+n]
+	r.pos += n
+	return b
+}
+
+func (r *wireReader) u8() uint8 {
+	if b := r.take(1); b != nil {
+		return b[0]
+	}
+	return 0
+}
+
+func (r *wireReader) u16() uint16 {
+	if b := r.take(2); b != nil {
+		return binary.LittleEndian.Uint16(b)
+	}
+	return 0
+}
+
+func (r *wireReader) u32() uint32 {
+	if b := r.take(4); b != nil {
+		return binary.LittleEndian.Uint32(b)
+	}
+	return 0
+}
+
+func (r *wireReader) str(n int) string {
+	return string(r.take(n))
+}
+
+func decodeEventWire(buf []byte) (*wireEvent, error) {
+	if len(buf) < eventWireHeaderSize {
+		return nil, errEventWireTruncated
+	}
+
+	r := &wireReader{buf: buf}
+	if r.u32() != eventWireMagic {
+		return nil, errors.New("event wire: bad magic")
+	}
+	if r.u16() != eventWireVersion {
+		return nil, errors.New("event wire: unsupported version")
+	}
+
+	ev := &wireEvent{}
+	ev.eventType = r.u8()
+	ev.priority = r.u8()
+	if !validWirePriority(ev.priority) {
+		return nil, errors.New("event wire: bad priority")
+	}
+	ev.flags = r.u32()
+	ev.modifiers = r.u32()
+	copy(ev.id[:], r.take(16))
+	ev.timestamp = math.Float64frombits(binary.LittleEndian.Uint64(r.take(8)))
+
+	nameLen := int(r.u16())
+	sourceIDLen := int(r.u16())
+	sourceTypeLen := int(r.u16())
+	targetIDLen := int(r.u16())
+	targetTypeLen := int(r.u16())
+	entryCount := int(r.u16())
+
+	ev.name = r.str(nameLen)
+	ev.sourceID = r.str(sourceIDLen)
+	ev.sourceType = r.str(sourceTypeLen)
+	ev.targetID = r.str(targetIDLen)
+	ev.targetType = r.str(targetTypeLen)
+
+	ev.entries = make([]wireEntry, 0, entryCount)
+	for i := 0; i < entryCount && r.err == nil; i++ {
+		entry := wireEntry{kind: r.u8()}
+		entry.key = r.str(int(r.u8()))
+		switch entry.kind {
+		case wireValueInt:
+			entry.intValue = int32(r.u32())
+		case wireValueFloat:
+			entry.floatValue = math.Float32frombits(r.u32())
+		case wireValueBool:
+			entry.boolValue = r.u8() != 0
+		case wireValueString, wireValueObject:
+			entry.stringValue = r.str(int(r.u16()))
+		default:
+			return nil, errors.New("event wire: unknown value type")
+		}
+		ev.entries = append(ev.entries, entry)
+	}
+
+	if r.err != nil {
+		return nil, r.err
+	}
+	return ev, nil
+}
+
+// encodedEntries is the number of entries encodeEventWire writes
+func (ev *wireEvent) encodedEntries() []wireEntry {
+	if len(ev.entries) > wireMaxEntries {
+		return ev.entries[:wireMaxEntries]
+	}
+	return ev.entries
+}
+
+// encodedSize is the byte count encodeEventWire needs for ev
+func (ev *wireEvent) encodedSize() int {
+	size := eventWireHeaderSize
+	for _, s := range []string{ev.name, ev.sourceID, ev.sourceType, ev.targetID, ev.targetType} {
+		size += len(clampWireString(s, wireMaxStringBytes))
+	}
+	for _, entry := range ev.encodedEntries() {
+		size += 2 + len(clampWireString(entry.key, wireMaxKeyBytes))
+		switch entry.kind {
+		case wireValueInt, wireValueFloat:
+			size += 4
+		case wireValueBool:
+			size++
+		default:
+			size += 2 + len(clampWireString(entry.stringValue, wireMaxStringBytes))
+		}
+	}
+	return size
+}
+
+// encodeEventWire writes ev into out and returns the byte count, or -1 if out is too small
+func encodeEventWire(ev *wireEvent, out []byte) int {
+	if ev.encodedSize() > len(out) {
+		return -1
+	}
+
+	le := binary.LittleEndian
+	le.PutUint32(out[0:], eventWireMagic)
+	le.PutUint16(out[4:], eventWireVersion)
+	out[6] = ev.eventType
+	out[7] = ev.priority
+	le.PutUint32(out[8:], ev.flags)
+	le.PutUint32(out[12:], ev.modifiers)
+	copy(out[16:32], ev.id[:])
+	le.PutUint64(out[32:], math.Float64bits(ev.timestamp))
+
+	entries := ev.encodedEntries()
+	le.PutUint16(out[50:], uint16(len(entries)))
+
+	pos := eventWireHeaderSize
+	for i, s := range []string{ev.name, ev.sourceID, ev.sourceType, ev.targetID, ev.targetType} {
+		s = clampWireString(s, wireMaxStringBytes)
+		le.PutUint16(out[40+2*i:], uint16(len(s)))
+		pos += copy(out[pos:], s)
+	}
+
+	for i := range entries {
+		entry := &entries[i]
+		key := clampWireString(entry.key, wireMaxKeyBytes)
+		out[pos] = entry.kind
+		out[pos+1] = uint8(len(key))
+		pos += 2
+		pos += copy(out[pos:], key)
+		switch entry.kind {
+		case wireValueInt:
+			le.PutUint32(out[pos:], uint32(entry.intValue))
+			pos += 4
+		case wireValueFloat:
+			le.PutUint32(out[pos:], math.Float32bits(entry.floatValue))
+			pos += 4
+		case wireValueBool:
+			out[pos] = 0
+			if entry.boolValue {
+				out[pos] = 1
+			}
+			pos++
+		default:
+			value := clampWireString(entry.stringValue, wireMaxStringBytes)
+			le.PutUint16(out[pos:], uint16(len(value)))
+			pos += 2
+			pos += copy(out[pos:], value)
+		}
+	}
+	return pos
+}
+
+// toGameEvent builds a toolkit event carrying every payload entry in its context
+func (ev *wireEvent) toGameEvent() *events.GameEvent {
+	eventType := "Unknown"
+	if int(ev.eventType) < len(eventWireTypeNames) {
+		eventType = eventWireTypeNames[ev.eventType]
+	}
+	// Named custom events publish under their own name
+	if eventType == "Custom" && ev.name != "" {
+		eventType = ev.name
+	}
+
+	var source, target *wireEntity
+	if ev.sourceID != "" {
+		source = &wireEntity{id: ev.sourceID, entityType: ev.sourceType}
+	}
+	if ev.targetID != "" {
+		target = &wireEntity{id: ev.targetID, entityType: ev.targetType}
+	}
+
+	var event *events.GameEvent
+	switch {
+	case source != nil && target != nil:
+		event = events.NewGameEvent(eventType, source, target)
+	case source != nil:
+		event = events.NewGameEvent(eventType, source, nil)
+	case target != nil:
+		event = events.NewGameEvent(eventType, nil, target)
+	default:
+		event = events.NewGameEvent(eventType, nil, nil)
+	}
+	if event == nil {
+		return nil
+	}
+
+	ctx := event.Context()
+	ctx.Set(ueOriginKey, true)
+	ctx.Set("event_name", ev.name)
+	ctx.Set("timestamp", ev.timestamp)
+	ctx.Set("priority", int(ev.priority))
+	ctx.Set("modifiers", int(ev.modifiers))
+	for i := range ev.entries {
+		entry := &ev.entries[i]
+		switch entry.kind {
+		case wireValueInt:
+			ctx.Set(entry.key, int(entry.intValue))
+		case wireValueFloat:
+			ctx.Set(entry.key, float64(entry.floatValue))
+		case wireValueBool:
+			ctx.Set(entry.key, entry.boolValue)
+		default:
+			ctx.Set(entry.key, entry.stringValue)
+		}
+	}
+	return event
+}
+
+//export PublishEventBinary
+func PublishEventBinary(data unsafe.Pointer, length C.int) C.int {
+	if globalEventBus == nil || data == nil || length <= 0 {
+		return 0
+	}
+
+	ev, err := decodeEventWire(unsafe.Slice((*byte)(data), int(length)))
+	if err != nil {
+		return 0
+	}
+
+	event := ev.toGameEvent()
+	if event == nil {
+		return 0
+	}
+
+	if err := globalEventBus.Publish(context.Background(), event); err != nil {
+		return 0
+	}
+	return 1
+}
+
+// EchoEventBinary decodes an event and re-encodes it into out, returning the bytes
+// written (0 on a decode error, -1 if out is too small) - used to verify both codecs agree
+//
+//export EchoEventBinary
+func EchoEventBinary(data unsafe.Pointer, length C.int, out unsafe.Pointer, outCapacity C.int) C.int {
+	if data == nil || out == nil || length <= 0 || outCapacity <= 0 {
+		return 0
+	}
+
+	ev, err := decodeEventWire(unsafe.Slice((*byte)(data), int(length)))
+	if err != nil {
+		return 0
+	}
+
+	return C.int(encodeEventWire(ev, unsafe.Slice((*byte)(out), int(outCapacity))))
+}
@@ -38,6 +38,8 @@ func PublishEvent(eventType *C.char, sourceID *C.char, targetID *C.char, context
 	if event == nil {
 		return 0
 	}
+	// Published from UE - keep toolkit subscribers from forwarding it back
+	event.Context().Set(ueOriginKey, true)
 	
 	err := globalEventBus.Publish(context.Background(), event)
 	if err != nil {
@@ -56,7 +58,8 @@ func SubscribeEvent(eventType *C.char, priority C.int) *C.char {
 	
 	// Create handler function with correct signature: func(context.Context, Event) error
 	handlerFunc := events.HandlerFunc(func(ctx context.Context, event events.Event) error {
-		// Handler implementation managed by UE subsystem callback
+		// Delivered to UE through the registered event callback (event_callback.go)
+		forwardEventToUE(event)
 		return nil
 	})
 	
@@ -65,6 +68,20 @@ func SubscribeEvent(eventType *C.char, priority C.int) *C.char {
 	return C.CString(subscriptionID)
 }
 
+// RegisterEventCallback sets the UE function toolkit subscribers forward events to
+// (RPGEventCallback in event_callback.go); pass nil with the same userData to unregister.
+// Returns 0 if a different userData already owns the callback, or does not own it when
+// unregistering. Once it returns, the previous callback is no longer running and will
+// not be called again.
+//
+//export RegisterEventCallback
+func RegisterEventCallback(callback unsafe.Pointer, userData unsafe.Pointer) C.int {
+	if !setEventCallback(callback, userData) {
+		return 0
+	}
+	return 1
+}
+
 //export UnsubscribeEvent
 func UnsubscribeEvent(subscriptionID *C.char) C.int {
 	if globalEventBus == nil {
@@ -23,6 +23,15 @@ typedef struct { const char *p; ptrdiff_t n; } _GoString_;
 #line 3 "core_bindings.go"
 
 #include <stdlib.h>
+#include <stdint.h>
+
+// Packed (id, type) UTF-8 views for ValidateEntitiesBatch - layout must match FRPGEntityViewPacked in RPGEntitySubsystem.h
+typedef struct {
+	const char* id;
+	const char* entityType;
+	int idLen;
+	int typeLen;
+} RPGEntityView;
 
 #line 1 "cgo-generated-wrapper"
 
@@ -30,6 +39,13 @@ typedef struct { const char *p; ptrdiff_t n; } _GoString_;
 
 #include <stdlib.h>
 
+// Packed dice spec for RollBatch - layout must match FRPGDiceSpecPacked in RPGDiceSubsystem.h
+typedef struct {
+	int count;
+	int size;
+	int modifier;
+} RPGDiceSpec;
+
 #line 1 "cgo-generated-wrapper"
 
 #line 3 "events_bindings.go"
@@ -114,6 +130,7 @@ extern __declspec(dllexport) char* GetEntityErrorOp(void* errPtr);
 extern __declspec(dllexport) int CreateEntityErrorComplete(char* op, char* entityType, char* entityID, char* errMsg, char** outOp, char** outType, char** outID, char** outMessage);
 extern __declspec(dllexport) int ValidateEntityID(char* id);
 extern __declspec(dllexport) int ValidateEntityType(char* entityType);
+extern __declspec(dllexport) int ValidateEntitiesBatch(RPGEntityView* entities, int count, uint64_t* outMask);
 extern __declspec(dllexport) void FreeString(char* str);
 extern __declspec(dllexport) void* CreateCryptoRoller();
 extern __declspec(dllexport) int RollerRoll(void* rollerPtr, int size);
@@ -133,12 +150,17 @@ extern __declspec(dllexport) int D10Complete(int count, int* outValue, char** ou
 extern __declspec(dllexport) int D12Complete(int count, int* outValue, char** outDesc, char** outError);
 extern __declspec(dllexport) int D20Complete(int count, int* outValue, char** outDesc, char** outError);
 extern __declspec(dllexport) int D100Complete(int count, int* outValue, char** outDesc, char** outError);
+extern __declspec(dllexport) int RollBatch(RPGDiceSpec* specs, int count, int* outValues, int* outFlags);
+extern __declspec(dllexport) int DiceRollStructured(int count, int size, int* outFaces, int maxFaces, int* outTotal);
 extern __declspec(dllexport) void RollCleanup(uintptr_t handle);
 extern __declspec(dllexport) void* CreateDiceRoller();
 extern __declspec(dllexport) int RollDie(void* rollerPtr, int sides);
 extern __declspec(dllexport) char* CreateEventBus();
 extern __declspec(dllexport) int PublishEvent(char* eventType, char* sourceID, char* targetID, char* contextData);
+extern __declspec(dllexport) int PublishEventBinary(void* data, int length);
+extern __declspec(dllexport) int EchoEventBinary(void* data, int length, void* out, int outCapacity);
 extern __declspec(dllexport) char* SubscribeEvent(char* eventType, int priority);
+extern __declspec(dllexport) int RegisterEventCallback(void* callback, void* userData);
 extern __declspec(dllexport) int UnsubscribeEvent(char* subscriptionID);
 
 // Event Type Constants - Direct exposure of toolkit constants